@@ -99,47 +99,90 @@ namespace QuantLib {
 
         if (fixingDate_ > today){
             swapTenor_ = swapIndex->tenor();
-            ext::shared_ptr<VanillaSwap> swap = swapIndex->underlyingSwap(fixingDate_);
-
-            swapRateValue_ = swap->fairRate();
-
-            static const Spread bp = 1.0e-4;
-            annuity_ = std::fabs(swap->fixedLegBPS()/bp);
-
-            Size q = swapIndex->fixedLegTenor().frequency();
-            const Schedule& schedule = swap->fixedSchedule();
-            const DayCounter& dc = swapIndex->dayCounter();
-            //const DayCounter dc = coupon.dayCounter();
-            Time startTime = dc.yearFraction(rateCurve_->referenceDate(),
-                                             swap->startDate());
-            Time swapFirstPaymentTime =
-                dc.yearFraction(rateCurve_->referenceDate(), schedule.date(1));
-            Time paymentTime = dc.yearFraction(rateCurve_->referenceDate(),
-                                               paymentDate_);
-            Real delta = (paymentTime-startTime) / (swapFirstPaymentTime-startTime);
-
-            switch (modelOfYieldCurve_) {
-                case GFunctionFactory::Standard:
-                    gFunction_ = GFunctionFactory::newGFunctionStandard(q, delta, swapTenor_.length());
-                    break;
-                case GFunctionFactory::ExactYield:
-                    gFunction_ = GFunctionFactory::newGFunctionExactYield(*coupon_);
-                    break;
-                case GFunctionFactory::ParallelShifts: {
-                    Handle<Quote> nullMeanReversionQuote(ext::shared_ptr<Quote>(new SimpleQuote(0.0)));
-                    gFunction_ = GFunctionFactory::newGFunctionWithShifts(*coupon_, nullMeanReversionQuote);
-                    }
-                    break;
-                case GFunctionFactory::NonParallelShifts:
-                    gFunction_ = GFunctionFactory::newGFunctionWithShifts(*coupon_, meanReversion_);
-                    break;
-                default:
-                    QL_FAIL("unknown/illegal gFunction type");
+
+            FixingData& fixing = fixingData(swapIndex, fixingDate_);
+            swapRateValue_ = fixing.swapRateValue;
+            annuity_ = fixing.annuity;
+            vanillaOptionPricer_ = fixing.vanillaOptionPricer;
+
+            // the G-function only depends on the payment date
+            payment_ = &fixing.payments[paymentDate_];
+            if (payment_->gFunction == nullptr) {
+                Size q = swapIndex->fixedLegTenor().frequency();
+                const Schedule& schedule = fixing.swap->fixedSchedule();
+                const DayCounter& dc = swapIndex->dayCounter();
+                //const DayCounter dc = coupon.dayCounter();
+                Time startTime = dc.yearFraction(rateCurve_->referenceDate(),
+                                                 fixing.swap->startDate());
+                Time swapFirstPaymentTime =
+                    dc.yearFraction(rateCurve_->referenceDate(), schedule.date(1));
+                Time paymentTime = dc.yearFraction(rateCurve_->referenceDate(),
+                                                   paymentDate_);
+                Real delta = (paymentTime-startTime) / (swapFirstPaymentTime-startTime);
+
+                switch (modelOfYieldCurve_) {
+                    case GFunctionFactory::Standard:
+                        payment_->gFunction = GFunctionFactory::newGFunctionStandard(q, delta, swapTenor_.length());
+                        break;
+                    case GFunctionFactory::ExactYield:
+                        payment_->gFunction = GFunctionFactory::newGFunctionExactYield(*coupon_);
+                        break;
+                    case GFunctionFactory::ParallelShifts: {
+                        Handle<Quote> nullMeanReversionQuote(ext::shared_ptr<Quote>(new SimpleQuote(0.0)));
+                        payment_->gFunction = GFunctionFactory::newGFunctionWithShifts(*coupon_, nullMeanReversionQuote);
+                        }
+                        break;
+                    case GFunctionFactory::NonParallelShifts:
+                        payment_->gFunction = GFunctionFactory::newGFunctionWithShifts(*coupon_, meanReversion_);
+                        break;
+                    default:
+                        QL_FAIL("unknown/illegal gFunction type");
+                }
             }
-            vanillaOptionPricer_= ext::shared_ptr<VanillaOptionPricer>(new
-                BlackVanillaOptionPricer(swapRateValue_, fixingDate_, swapTenor_,
-                                        *swaptionVolatility()));
-         }
+            gFunction_ = payment_->gFunction;
+        } else {
+            payment_ = nullptr;
+        }
+    }
+
+    HaganPricer::FixingData&
+    HaganPricer::fixingData(const ext::shared_ptr<SwapIndex>& swapIndex,
+                            const Date& fixingDate) {
+
+        const Date today = Settings::instance().evaluationDate();
+        if (today != fixingsDate_) {
+            fixings_.clear();
+            fixingsDate_ = today;
+        }
+
+        const auto key = std::make_pair(fixingDate, swapIndex.get());
+        const auto iter = fixings_.find(key);
+        if (iter != fixings_.end())
+            return iter->second;
+
+        FixingData data;
+        data.swapIndex = swapIndex;
+        data.swap = swapIndex->underlyingSwap(fixingDate);
+
+        data.swapRateValue = data.swap->fairRate();
+
+        static const Spread bp = 1.0e-4;
+        data.annuity = std::fabs(data.swap->fixedLegBPS()/bp);
+
+        data.vanillaOptionPricer = ext::shared_ptr<VanillaOptionPricer>(new
+            BlackVanillaOptionPricer(data.swapRateValue, fixingDate,
+                                     swapIndex->tenor(), *swaptionVolatility()));
+
+        // changes to the index curves must clear the shared data
+        registerWith(swapIndex);
+
+        return fixings_.emplace(key, std::move(data)).first->second;
+    }
+
+    void HaganPricer::update() {
+        fixings_.clear();
+        payment_ = nullptr;
+        CmsCouponPricer::update();
     }
 
     Real HaganPricer::meanReversion() const { return meanReversion_->value();}
@@ -310,6 +353,15 @@ namespace QuantLib {
     Real NumericHaganPricer::optionletPrice(
                                 Option::Type optionType, Real strike) const {
 
+        // the replication only depends on the fixing and payment date
+        const auto key = std::make_pair(optionType, strike);
+        if (payment_ != nullptr) {
+            const auto iter = payment_->replications.find(key);
+            if (iter != payment_->replications.end())
+                return coupon_->accrualPeriod() * (discount_/annuity_) *
+                    iter->second;
+        }
+
         ext::shared_ptr<ConundrumIntegrand> integrand(new
             ConundrumIntegrand(vanillaOptionPricer_, rateCurve_, gFunction_,
                                fixingDate_, paymentDate_, annuity_,
@@ -335,8 +387,11 @@ namespace QuantLib {
             (*vanillaOptionPricer_)(strike, optionType, annuity_);
 
         // v. HAGAN, Conundrums..., formule 2.17a, 2.18a
-        return coupon_->accrualPeriod() * (discount_/annuity_) *
-            ((1 + dFdK) * swaptionPrice + Integer(optionType) * integralValue);
+        const Real replication =
+            (1 + dFdK) * swaptionPrice + Integer(optionType) * integralValue;
+        if (payment_ != nullptr)
+            payment_->replications[key] = replication;
+        return coupon_->accrualPeriod() * (discount_/annuity_) * replication;
     }
 
     Real NumericHaganPricer::swapletPrice() const {
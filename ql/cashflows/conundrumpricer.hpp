@@ -25,10 +25,13 @@
 
 #include <ql/cashflows/couponpricer.hpp>
 #include <ql/instruments/payoffs.hpp>
+#include <map>
 
 namespace QuantLib {
 
     class CmsCoupon;
+    class SwapIndex;
+    class VanillaSwap;
     class YieldTermStructure;
     class Quote;
 
@@ -191,10 +194,18 @@ namespace QuantLib {
     //! CMS-coupon pricer
     /*! Base class for the pricing of a CMS coupon via static replication
         as in Hagan's "Conundrums..." article
+
+        The underlying swap, its fair rate and annuity and the vanilla
+        option pricer are kept per fixing date and swap index, and the
+        G-function per payment date, so that coupons with the same
+        fixing (different gearings, spreads, caps or floors, or other
+        legs on the same schedule) reuse them.  The data are dropped
+        when the pricer is notified or the evaluation date changes.
     */
     class HaganPricer: public CmsCouponPricer, public MeanRevertingPricer {
       public:
         /* */
+        void update() override;
         Real swapletPrice() const override = 0;
         Rate swapletRate() const override;
         Real capletPrice(Rate effectiveCap) const override;
@@ -234,6 +245,31 @@ namespace QuantLib {
         Handle<Quote> meanReversion_;
         Period swapTenor_;
         ext::shared_ptr<VanillaOptionPricer> vanillaOptionPricer_;
+
+        //! data shared by the coupons with the same payment date
+        struct PaymentData {
+            ext::shared_ptr<GFunction> gFunction;
+            //! replications by option type and strike, see NumericHaganPricer
+            std::map<std::pair<Option::Type, Real>, Real> replications;
+        };
+        //! data shared by the coupons with the same fixing
+        struct FixingData {
+            ext::shared_ptr<SwapIndex> swapIndex;
+            ext::shared_ptr<VanillaSwap> swap;
+            Rate swapRateValue;
+            Real annuity;
+            ext::shared_ptr<VanillaOptionPricer> vanillaOptionPricer;
+            std::map<Date, PaymentData> payments;
+        };
+        //! shared data of the current coupon, null if already fixed
+        PaymentData* payment_ = nullptr;
+
+      private:
+        FixingData& fixingData(const ext::shared_ptr<SwapIndex>& swapIndex,
+                               const Date& fixingDate);
+
+        std::map<std::pair<Date, const SwapIndex*>, FixingData> fixings_;
+        Date fixingsDate_;
     };
 
 
@@ -241,6 +277,9 @@ namespace QuantLib {
     /*! Prices a cms coupon via static replication as in Hagan's
         "Conundrums..." article via numerical integration based on
         prices of vanilla swaptions
+
+        The replication integrals are shared by the coupons with the
+        same fixing and payment date.
     */
     class NumericHaganPricer : public HaganPricer {
       public:
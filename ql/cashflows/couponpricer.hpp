@@ -133,6 +133,8 @@ namespace QuantLib {
         Real floorletPrice(Rate effectiveFloor) const override;
         Rate floorletRate(Rate effectiveFloor) const override;
 
+        TimingAdjustment timingAdjustment() const { return timingAdjustment_; }
+
       protected:
         Real optionletPrice(Option::Type optionType, Real effStrike) const;
         Real optionletRate(Option::Type optionType, Real effStrike) const;
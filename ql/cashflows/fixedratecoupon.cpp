@@ -60,10 +60,14 @@ namespace QuantLib {
       rate_(std::move(interestRate)) {}
 
     Real FixedRateCoupon::amount() const {
-        return nominal()*(rate_.compoundFactor(accrualStartDate_,
-                                               accrualEndDate_,
-                                               refPeriodStart_,
-                                               refPeriodEnd_) - 1.0);
+        // all the inputs are fixed at construction, so the
+        // day-count arithmetic is only performed once
+        if (amount_ == Null<Real>())
+            amount_ = nominal()*(rate_.compoundFactor(accrualStartDate_,
+                                                      accrualEndDate_,
+                                                      refPeriodStart_,
+                                                      refPeriodEnd_) - 1.0);
+        return amount_;
     }
 
     Real FixedRateCoupon::accruedAmount(const Date& d) const {
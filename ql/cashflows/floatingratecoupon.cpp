@@ -77,10 +77,14 @@ namespace QuantLib {
     }
 
     Date FloatingRateCoupon::fixingDate() const {
-        // if isInArrears_ fix at the end of period
-        Date refDate = isInArrears_ ? accrualEndDate_ : accrualStartDate_;
-        return index_->fixingCalendar().advance(refDate,
-            -static_cast<Integer>(fixingDays_), Days, Preceding);
+        // the calendar adjustment is only needed once
+        if (fixingDate_ == Date()) {
+            // if isInArrears_ fix at the end of period
+            Date refDate = isInArrears_ ? accrualEndDate_ : accrualStartDate_;
+            fixingDate_ = index_->fixingCalendar().advance(refDate,
+                -static_cast<Integer>(fixingDays_), Days, Preceding);
+        }
+        return fixingDate_;
     }
 
     Rate FloatingRateCoupon::rate() const {
@@ -115,6 +115,7 @@ namespace QuantLib {
         Spread spread_;
         bool isInArrears_;
         ext::shared_ptr<FloatingRateCouponPricer> pricer_;
+        mutable Date fixingDate_;
     };
 
     // inline definitions
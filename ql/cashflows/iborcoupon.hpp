@@ -89,7 +89,6 @@ namespace QuantLib {
       private:
         friend class IborCouponPricer;
         ext::shared_ptr<IborIndex> iborIndex_;
-        Date fixingDate_;
         // computed by coupon pricer (depending on par coupon flag) and stored here
         void initializeCachedData() const;
         mutable bool cachedDataIsInitialized_ = false;
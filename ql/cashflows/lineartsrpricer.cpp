@@ -21,6 +21,7 @@
 /*! \file lineartsrpricer.cpp
 */
 
+#include <ql/cashflows/capflooredcoupon.hpp>
 #include <ql/cashflows/cmscoupon.hpp>
 #include <ql/cashflows/fixedratecoupon.hpp>
 #include <ql/cashflows/iborcoupon.hpp>
@@ -34,19 +35,13 @@
 #include <ql/termstructures/volatility/atmsmilesection.hpp>
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <ql/time/schedule.hpp>
+#include <set>
+#include <string>
+#include <tuple>
 #include <utility>
 
 namespace QuantLib {
 
-    class LinearTsrPricer::integrand_f {
-        const LinearTsrPricer* pricer;
-      public:
-        explicit integrand_f(const LinearTsrPricer* pricer) : pricer(pricer) {}
-        Real operator()(Real x) const {
-            return pricer->integrand(x);
-        }
-    };
-
     const Real LinearTsrPricer::defaultLowerBound = 0.0001,
              LinearTsrPricer::defaultUpperBound = 2.0000;
 
@@ -62,14 +57,17 @@ namespace QuantLib {
         if (!couponDiscountCurve_.empty())
             registerWith(couponDiscountCurve_);
 
+        // the shared fixing data depend on the mean reversion
+        registerWith(meanReversion_);
+
         if (integrator_ == nullptr)
             integrator_ =
                 ext::make_shared<GaussKronrodNonAdaptive>(1E-10, 5000, 1E-10);
     }
 
-    Real LinearTsrPricer::GsrG(const Date &d) const {
+    Real LinearTsrPricer::GsrG(const Date& fixingDate, const Date& d) const {
 
-        Real yf = volDayCounter_.yearFraction(fixingDate_, d);
+        Real yf = volDayCounter_.yearFraction(fixingDate, d);
         if (std::fabs(meanReversion_->value()) < 1.0E-4)
             return yf;
         else
@@ -90,12 +88,6 @@ namespace QuantLib {
         return s1 + s2;
     }
 
-    Real LinearTsrPricer::integrand(const Real strike) const {
-        return 2.0 * a_ * smileSection_->optionPrice(
-                              strike, strike < swapRateValue_ ? Option::Put
-                                                              : Option::Call);
-    }
-
     void LinearTsrPricer::initialize(const FloatingRateCoupon &coupon) {
 
         coupon_ = dynamic_cast<const CmsCoupon *>(&coupon);
@@ -136,82 +128,217 @@ namespace QuantLib {
         if (fixingDate_ > today_) {
 
             swapTenor_ = swapIndex_->tenor();
-            swap_ = swapIndex_->underlyingSwap(fixingDate_);
 
-            swapRateValue_ = swap_->fairRate();
-            annuity_ = 1.0E4 * std::fabs(swap_->fixedLegBPS());
+            fixing_ = &fixingData(*coupon_);
+            swap_ = fixing_->swap;
+            swapRateValue_ = fixing_->swapRateValue;
+            annuity_ = fixing_->annuity;
+            smileSection_ = fixing_->smileSection;
+            adjustedLowerBound_ = fixing_->adjustedLowerBound;
+            adjustedUpperBound_ = fixing_->adjustedUpperBound;
 
-            ext::shared_ptr<SmileSection> sectionTmp =
-                swaptionVolatility()->smileSection(fixingDate_, swapTenor_);
+            // compute linear model's parameters; only the dependence
+            // on the payment date is coupon specific
 
-            adjustedLowerBound_ = settings_.lowerRateBound_;
-            adjustedUpperBound_ = settings_.upperRateBound_;
+            a_ = discountCurve_->discount(paymentDate_) *
+                 (fixing_->gamma - GsrG(fixingDate_, paymentDate_)) /
+                 fixing_->denominator;
 
-            if(sectionTmp->volatilityType() == Normal) {
-                // adjust lower bound if it was not set explicitly
-                if(settings_.defaultBounds_)
-                    adjustedLowerBound_ = std::min(adjustedLowerBound_, -adjustedUpperBound_);
-            } else {
-                // adjust bounds by section's shift
-                adjustedLowerBound_ -= sectionTmp->shift();
-                adjustedUpperBound_ -= sectionTmp->shift();
-            }
+            b_ = discountCurve_->discount(paymentDate_) / fixing_->gy -
+                 a_ * swapRateValue_;
+        }
+    }
 
-            // if the section does not provide an atm level, we enhance it to
-            // have one, no need to exit with an exception ...
+    LinearTsrPricer::FixingData&
+    LinearTsrPricer::fixingData(const CmsCoupon& coupon) {
 
-            if (sectionTmp->atmLevel() == Null<Real>())
-                smileSection_ = ext::make_shared<AtmSmileSection>(
-                    sectionTmp, swapRateValue_);
-            else
-                smileSection_ = sectionTmp;
-
-            // compute linear model's parameters
-
-            Real gx = 0.0, gy = 0.0;
-            for (const auto& i : swap_->fixedLeg()) {
-                ext::shared_ptr<Coupon> c = ext::dynamic_pointer_cast<Coupon>(i);
-                Real yf = c->accrualPeriod();
-                Date d = c->date();
-                Real pv = yf * discountCurve_->discount(d);
-                gx += pv * GsrG(d);
-                gy += pv;
-            }
+        const Date today = QuantLib::Settings::instance().evaluationDate();
+        if (today != fixingsDate_) {
+            fixings_.clear();
+            fixingsDate_ = today;
+        }
 
-            Real gamma = gx / gy;
-            Date lastd = swap_->fixedLeg().back()->date();
+        const Date fixingDate = coupon.fixingDate();
+        const ext::shared_ptr<SwapIndex> swapIndex = coupon.swapIndex();
 
-            a_ = discountCurve_->discount(paymentDate_) *
-                 (gamma - GsrG(paymentDate_)) /
-                 (discountCurve_->discount(lastd) * GsrG(lastd) +
-                  swapRateValue_ * gy * gamma);
+        const auto key = std::make_pair(fixingDate, swapIndex.get());
+        const auto iter = fixings_.find(key);
+        if (iter != fixings_.end())
+            return iter->second;
 
-            b_ = discountCurve_->discount(paymentDate_) / gy -
-                 a_ * swapRateValue_;
+        FixingData data;
+        data.swapIndex = swapIndex;
+        data.swap = swapIndex->underlyingSwap(fixingDate);
+
+        data.swapRateValue = data.swap->fairRate();
+        data.annuity = 1.0E4 * std::fabs(data.swap->fixedLegBPS());
+
+        ext::shared_ptr<SmileSection> sectionTmp =
+            swaptionVolatility()->smileSection(fixingDate, swapIndex->tenor());
+
+        data.adjustedLowerBound = settings_.lowerRateBound_;
+        data.adjustedUpperBound = settings_.upperRateBound_;
+
+        if(sectionTmp->volatilityType() == Normal) {
+            // adjust lower bound if it was not set explicitly
+            if(settings_.defaultBounds_)
+                data.adjustedLowerBound = std::min(data.adjustedLowerBound,
+                                                   -data.adjustedUpperBound);
+        } else {
+            // adjust bounds by section's shift
+            data.adjustedLowerBound -= sectionTmp->shift();
+            data.adjustedUpperBound -= sectionTmp->shift();
         }
+
+        // if the section does not provide an atm level, we enhance it to
+        // have one, no need to exit with an exception ...
+
+        if (sectionTmp->atmLevel() == Null<Real>())
+            data.smileSection = ext::make_shared<AtmSmileSection>(
+                sectionTmp, data.swapRateValue);
+        else
+            data.smileSection = sectionTmp;
+
+        // compute the linear model's parameters not depending on the
+        // payment date
+
+        const Handle<YieldTermStructure> discountCurve =
+            swapIndex->exogenousDiscount()
+                ? swapIndex->discountingTermStructure()
+                : swapIndex->forwardingTermStructure();
+
+        Real gx = 0.0, gy = 0.0;
+        for (const auto& i : data.swap->fixedLeg()) {
+            ext::shared_ptr<Coupon> c = ext::dynamic_pointer_cast<Coupon>(i);
+            Real yf = c->accrualPeriod();
+            Date d = c->date();
+            Real pv = yf * discountCurve->discount(d);
+            gx += pv * GsrG(fixingDate, d);
+            gy += pv;
+        }
+
+        data.gamma = gx / gy;
+        data.gy = gy;
+        Date lastd = data.swap->fixedLeg().back()->date();
+        data.denominator = discountCurve->discount(lastd) * GsrG(fixingDate, lastd) +
+                           data.swapRateValue * gy * data.gamma;
+
+        // changes to the index curves must clear the shared data
+        registerWith(swapIndex);
+
+        return fixings_.emplace(key, std::move(data)).first->second;
+    }
+
+    void LinearTsrPricer::update() {
+        fixings_.clear();
+        CmsCouponPricer::update();
     }
 
-    Real LinearTsrPricer::strikeFromVegaRatio(Real ratio,
+    void LinearTsrPricer::precompute(const Leg& leg) {
+
+        const Date today = QuantLib::Settings::instance().evaluationDate();
+
+        // the shared data are calculated serially, together with any
+        // lazy object they depend on; only the integrals are left
+        struct Task {
+            FixingData* data;
+            Option::Type type;
+            Real strike;
+        };
+        std::vector<Task> tasks;
+        std::set<std::tuple<FixingData*, Option::Type, Real> > scheduled;
+
+        const auto schedule = [&](FixingData& data, Option::Type type,
+                                  Real strike) {
+            if ((type == Option::Call && strike >= data.adjustedUpperBound) ||
+                (type == Option::Put && strike <= data.adjustedLowerBound) ||
+                data.integrals.count(std::make_pair(type, strike)) != 0 ||
+                !scheduled.insert(std::make_tuple(&data, type, strike)).second)
+                return;
+            tasks.push_back({&data, type, strike});
+        };
+
+        for (const auto& cf : leg) {
+            ext::shared_ptr<CmsCoupon> coupon =
+                ext::dynamic_pointer_cast<CmsCoupon>(cf);
+            Rate cap = Null<Rate>(), floor = Null<Rate>();
+            if (coupon == nullptr) {
+                ext::shared_ptr<CappedFlooredCmsCoupon> cfCoupon =
+                    ext::dynamic_pointer_cast<CappedFlooredCmsCoupon>(cf);
+                if (cfCoupon == nullptr)
+                    continue;
+                coupon = ext::dynamic_pointer_cast<CmsCoupon>(
+                    cfCoupon->underlying());
+                cap = cfCoupon->effectiveCap();
+                floor = cfCoupon->effectiveFloor();
+            }
+            if (coupon == nullptr || coupon->fixingDate() <= today)
+                continue;
+
+            FixingData& data = fixingData(*coupon);
+            data.smileSection->optionPrice(data.swapRateValue);
+
+            schedule(data, Option::Call, data.swapRateValue);
+            schedule(data, Option::Put, data.swapRateValue);
+            if (cap != Null<Rate>())
+                schedule(data, Option::Call, cap);
+            if (floor != Null<Rate>())
+                schedule(data, Option::Put, floor);
+        }
+
+        const ext::shared_ptr<GaussKronrodNonAdaptive> gaussKronrod =
+            ext::dynamic_pointer_cast<GaussKronrodNonAdaptive>(integrator_);
+
+        std::vector<Real> integrals(tasks.size());
+        std::vector<std::string> failures(tasks.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(parallelIntegration_ && gaussKronrod != nullptr)
+#endif
+        for (long i=0; i < static_cast<long>(tasks.size()); ++i) {
+            const Task& task = tasks[i];
+            try {
+                if (gaussKronrod != nullptr) {
+                    const GaussKronrodNonAdaptive integrator(*gaussKronrod);
+                    integrals[i] = replicationIntegral(
+                        *task.data, task.type, task.strike, integrator);
+                } else {
+                    integrals[i] = replicationIntegral(
+                        *task.data, task.type, task.strike, *integrator_);
+                }
+            } catch (std::exception& e) {
+                failures[i] = e.what();
+            }
+        }
+
+        for (Size i=0; i < tasks.size(); ++i) {
+            QL_REQUIRE(failures[i].empty(), failures[i]);
+            tasks[i].data->integrals.emplace(
+                std::make_pair(tasks[i].type, tasks[i].strike), integrals[i]);
+        }
+    }
+
+    Real LinearTsrPricer::strikeFromVegaRatio(const FixingData& data,
+                                              Real ratio,
                                               Option::Type optionType,
                                               Real referenceStrike) const {
 
         Real a, b, min, max, k;
         if (optionType == Option::Call) {
-            a = swapRateValue_;
+            a = data.swapRateValue;
             min = referenceStrike;
             // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
             b = max = k =
-                std::min(smileSection_->maxStrike(), adjustedUpperBound_);
+                std::min(data.smileSection->maxStrike(), data.adjustedUpperBound);
         } else {
             // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
             a = min = k =
-                std::max(smileSection_->minStrike(), adjustedLowerBound_);
-            b = swapRateValue_;
+                std::max(data.smileSection->minStrike(), data.adjustedLowerBound);
+            b = data.swapRateValue;
             max = referenceStrike;
         }
 
-        VegaRatioHelper h(&*smileSection_,
-                          smileSection_->vega(swapRateValue_) * ratio);
+        VegaRatioHelper h(&*data.smileSection,
+                          data.smileSection->vega(data.swapRateValue) * ratio);
         Brent solver;
 
         try {
@@ -224,29 +351,31 @@ namespace QuantLib {
         return std::min(std::max(k, min), max);
     }
 
-    Real LinearTsrPricer::strikeFromPrice(Real price, Option::Type optionType,
+    Real LinearTsrPricer::strikeFromPrice(const FixingData& data,
+                                          Real price,
+                                          Option::Type optionType,
                                           Real referenceStrike) const {
 
         Real a, b, min, max, k;
         if (optionType == Option::Call) {
-            a = swapRateValue_;
+            a = data.swapRateValue;
             min = referenceStrike;
             // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
             b = max = k =
-                std::min(smileSection_->maxStrike(), adjustedUpperBound_);
+                std::min(data.smileSection->maxStrike(), data.adjustedUpperBound);
         } else {
             // NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
             a = min = k =
-                std::max(smileSection_->minStrike(), adjustedLowerBound_);
-            b = swapRateValue_;
+                std::max(data.smileSection->minStrike(), data.adjustedLowerBound);
+            b = data.swapRateValue;
             max = referenceStrike;
         }
 
-        PriceHelper h(&*smileSection_, optionType, price);
+        PriceHelper h(&*data.smileSection, optionType, price);
         Brent solver;
 
         try {
-            k = solver.solve(h, 1.0E-5, swapRateValue_, a, b);
+            k = solver.solve(h, 1.0E-5, data.swapRateValue, a, b);
         }
         catch (...) {
             // use default value set above
@@ -255,13 +384,10 @@ namespace QuantLib {
         return std::min(std::max(k, min), max);
     }
 
-    Real LinearTsrPricer::optionletPrice(Option::Type optionType,
-                                         Real strike) const {
-
-        if (optionType == Option::Call && strike >= adjustedUpperBound_)
-            return 0.0;
-        if (optionType == Option::Put && strike <= adjustedLowerBound_)
-            return 0.0;
+    Real LinearTsrPricer::replicationIntegral(const FixingData& data,
+                                              Option::Type optionType,
+                                              Real strike,
+                                              const Integrator& integrator) const {
 
         // determine lower or upper integration bound (depending on option type)
 
@@ -271,9 +397,9 @@ namespace QuantLib {
 
         case Settings::RateBound: {
             if (optionType == Option::Call)
-                upper = adjustedUpperBound_;
+                upper = data.adjustedUpperBound;
             else
-                lower = adjustedLowerBound_;
+                lower = data.adjustedLowerBound;
             break;
         }
 
@@ -281,11 +407,12 @@ namespace QuantLib {
             // strikeFromVegaRatio ensures that returned strike is on the
             // expected side of strike
             Real bound =
-                strikeFromVegaRatio(settings_.vegaRatio_, optionType, strike);
+                strikeFromVegaRatio(data, settings_.vegaRatio_, optionType,
+                                    strike);
             if (optionType == Option::Call)
-                upper = std::min(bound, adjustedUpperBound_);
+                upper = std::min(bound, data.adjustedUpperBound);
             else
-                lower = std::max(bound, adjustedLowerBound_);
+                lower = std::max(bound, data.adjustedLowerBound);
             break;
         }
 
@@ -293,38 +420,39 @@ namespace QuantLib {
             // strikeFromPrice ensures that returned strike is on the expected
             // side of strike
             Real bound =
-                strikeFromPrice(settings_.vegaRatio_, optionType, strike);
+                strikeFromPrice(data, settings_.vegaRatio_, optionType,
+                                strike);
             if (optionType == Option::Call)
-                upper = std::min(bound, adjustedUpperBound_);
+                upper = std::min(bound, data.adjustedUpperBound);
             else
-                lower = std::max(bound, adjustedLowerBound_);
+                lower = std::max(bound, data.adjustedLowerBound);
             break;
         }
 
         case Settings::BSStdDevs : {
-            Real atm = smileSection_->atmLevel();
-            Real atmVol = smileSection_->volatility(atm);
-            Real shift = smileSection_->shift();
+            Real atm = data.smileSection->atmLevel();
+            Real atmVol = data.smileSection->volatility(atm);
+            Real shift = data.smileSection->shift();
             Real lowerTmp, upperTmp;
-            if (smileSection_->volatilityType() == ShiftedLognormal) {
+            if (data.smileSection->volatilityType() == ShiftedLognormal) {
                 upperTmp = (atm + shift) *
                                std::exp(settings_.stdDevs_ * atmVol -
                                         0.5 * atmVol * atmVol *
-                                            smileSection_->exerciseTime()) -
+                                            data.smileSection->exerciseTime()) -
                            shift;
                 lowerTmp = (atm + shift) *
                                std::exp(-settings_.stdDevs_ * atmVol -
                                         0.5 * atmVol * atmVol *
-                                            smileSection_->exerciseTime()) -
+                                            data.smileSection->exerciseTime()) -
                            shift;
             } else {
                 Real tmp = settings_.stdDevs_ * atmVol *
-                           std::sqrt(smileSection_->exerciseTime());
+                           std::sqrt(data.smileSection->exerciseTime());
                 upperTmp = atm + tmp;
                 lowerTmp = atm - tmp;
             }
-            upper = std::min(upperTmp - shift, adjustedUpperBound_);
-            lower = std::max(lowerTmp - shift, adjustedLowerBound_);
+            upper = std::min(upperTmp - shift, data.adjustedUpperBound);
+            lower = std::max(lowerTmp - shift, data.adjustedLowerBound);
             break;
         }
 
@@ -332,25 +460,48 @@ namespace QuantLib {
             QL_FAIL("Unknown strategy (" << settings_.strategy_ << ")");
         }
 
-        // compute the relevant integral
+        // compute the relevant integral; the slope of the linear
+        // model is applied by the caller, so that the result can be
+        // shared by coupons with different payment dates
+
+        const auto integrand = [&data](Real k) {
+            return 2.0 * data.smileSection->optionPrice(
+                k, k < data.swapRateValue ? Option::Put : Option::Call);
+        };
 
         Real result = 0.0;
         Real tmpBound;
         if (upper > lower) {
-            tmpBound = std::min(upper, swapRateValue_);
+            tmpBound = std::min(upper, data.swapRateValue);
             if (tmpBound > lower) {
-                result += (*integrator_)(integrand_f(this),
-                                         lower, tmpBound);
+                result += integrator(integrand, lower, tmpBound);
             }
-            tmpBound = std::max(lower, swapRateValue_);
+            tmpBound = std::max(lower, data.swapRateValue);
             if (upper > tmpBound) {
-                result += (*integrator_)(integrand_f(this),
-                                         tmpBound, upper);
+                result += integrator(integrand, tmpBound, upper);
             }
             result *= (optionType == Option::Call ? 1.0 : -1.0);
         }
 
-        result += singularTerms(optionType, strike);
+        return result;
+    }
+
+    Real LinearTsrPricer::optionletPrice(Option::Type optionType,
+                                         Real strike) const {
+
+        if (optionType == Option::Call && strike >= adjustedUpperBound_)
+            return 0.0;
+        if (optionType == Option::Put && strike <= adjustedLowerBound_)
+            return 0.0;
+
+        const auto key = std::make_pair(optionType, strike);
+        auto iter = fixing_->integrals.find(key);
+        if (iter == fixing_->integrals.end())
+            iter = fixing_->integrals.emplace(
+                key, replicationIntegral(*fixing_, optionType, strike,
+                                         *integrator_)).first;
+
+        Real result = a_ * iter->second + singularTerms(optionType, strike);
 
         return annuity_ * result * couponDiscountRatio_ *
                coupon_->accrualPeriod();
@@ -29,6 +29,7 @@
 #include <ql/instruments/payoffs.hpp>
 #include <ql/indexes/swapindex.hpp>
 #include <ql/math/integrals/integral.hpp>
+#include <map>
 
 namespace QuantLib {
 
@@ -180,16 +181,58 @@ namespace QuantLib {
             update();
         }
 
+        //! \name Observer interface
+        //@{
+        void update() override;
+        //@}
+
+        //! \name Batch pricing
+        /*! The underlying swap, the smile section and the replication
+            integrals only depend on the fixing date and the swap
+            index of a coupon.  They are computed once and shared by
+            all coupons with the same fixing, whatever their payment
+            date, gearing or spread, until the pricer is notified of a
+            change.
+
+            precompute() evaluates the integrals needed by the CMS and
+            capped/floored CMS coupons of a leg in one go, so that
+            subsequent pricing of the leg only looks them up.  If
+            enabled and OpenMP is available, the integrals for
+            distinct fixings are evaluated concurrently; this requires
+            the default GaussKronrodNonAdaptive integrator, which is
+            copied for each of them.  The results do not change.
+
+            \warning the smile sections must be safe to use from
+                     several threads once calculated.
+        */
+        //@{
+        void precompute(const Leg& leg);
+        void enableParallelIntegration(bool b = true) { parallelIntegration_ = b; }
+        void disableParallelIntegration(bool b = true) { parallelIntegration_ = !b; }
+        bool allowsParallelIntegration() const { return parallelIntegration_; }
+        //@}
 
       private:
 
-        Real GsrG(const Date &d) const;
+        struct FixingData {
+            ext::shared_ptr<SwapIndex> swapIndex;
+            ext::shared_ptr<VanillaSwap> swap;
+            ext::shared_ptr<SmileSection> smileSection;
+            Real swapRateValue, annuity;
+            Real gamma, gy, denominator;
+            Real adjustedLowerBound, adjustedUpperBound;
+            std::map<std::pair<Option::Type, Real>, Real> integrals;
+        };
+
+        Real GsrG(const Date& fixingDate, const Date& d) const;
         Real singularTerms(Option::Type type, Real strike) const;
-        Real integrand(Real strike) const;
+        FixingData& fixingData(const CmsCoupon& coupon);
+        Real replicationIntegral(const FixingData& data,
+                                 Option::Type optionType,
+                                 Real strike,
+                                 const Integrator& integrator) const;
         Real a_, b_;
 
-        class integrand_f;
-
         class VegaRatioHelper {
           public:
             VegaRatioHelper(const SmileSection *section, const Real targetVega)
@@ -216,9 +259,11 @@ namespace QuantLib {
 
         void initialize(const FloatingRateCoupon& coupon) override;
         Real optionletPrice(Option::Type optionType, Real strike) const;
-        Real strikeFromVegaRatio(Real ratio, Option::Type optionType,
+        Real strikeFromVegaRatio(const FixingData& data, Real ratio,
+                                 Option::Type optionType,
                                  Real referenceStrike) const;
-        Real strikeFromPrice(Real price, Option::Type optionType,
+        Real strikeFromPrice(const FixingData& data, Real price,
+                             Option::Type optionType,
                              Real referenceStrike) const;
 
         Handle<Quote> meanReversion_;
@@ -244,6 +289,11 @@ namespace QuantLib {
         ext::shared_ptr<Integrator> integrator_;
 
         Real adjustedLowerBound_, adjustedUpperBound_;
+
+        FixingData* fixing_;
+        std::map<std::pair<Date, const SwapIndex*>, FixingData> fixings_;
+        Date fixingsDate_;
+        bool parallelIntegration_ = false;
     };
 }
 
@@ -0,0 +1,258 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/cashflows/cashflows.hpp>
+#include <ql/cashflows/couponpricer.hpp>
+#include <ql/cashflows/fixedratecoupon.hpp>
+#include <ql/cashflows/iborcoupon.hpp>
+#include <ql/cashflows/simplecashflow.hpp>
+#include <ql/cashflows/staticleg.hpp>
+#include <ql/settings.hpp>
+#include <ql/termstructures/yieldtermstructure.hpp>
+#include <typeinfo>
+
+namespace QuantLib {
+
+    namespace {
+
+        const Spread basisPoint_ = 1.0e-4;
+
+        bool hasStaticAmount(const CashFlow& c) {
+            // only the exact types are checked, since derived
+            // classes might override amount()
+            const std::type_info& t = typeid(c);
+            return t == typeid(FixedRateCoupon) || t == typeid(SimpleCashFlow) ||
+                   t == typeid(Redemption) || t == typeid(AmortizingPayment);
+        }
+
+        bool hasLinearRate(const IborCoupon& c) {
+            if (c.isInArrears())
+                return false;
+            ext::shared_ptr<FloatingRateCouponPricer> p = c.pricer();
+            if (p == nullptr || typeid(*p) != typeid(BlackIborCouponPricer))
+                return false;
+            // with Black76 timing, no convexity adjustment is applied
+            // to coupons that are not in arrears
+            return ext::static_pointer_cast<BlackIborCouponPricer>(p)->timingAdjustment() ==
+                   BlackIborCouponPricer::Black76;
+        }
+
+    }
+
+    StaticLeg::StaticLeg(Leg leg) : leg_(std::move(leg)) {
+        Size n = leg_.size();
+        kinds_.resize(n, Other);
+        paymentDates_.resize(n);
+        amounts_.resize(n, Null<Real>());
+        bpsWeights_.resize(n, 0.0);
+        forecastIndex_.resize(n, Null<Size>());
+
+        if (n == 0)
+            return;
+
+        startDate_ = CashFlows::startDate(leg_);
+        maturityDate_ = CashFlows::maturityDate(leg_);
+
+        for (Size i=0; i<n; ++i) {
+            QL_REQUIRE(leg_[i], "null cash flow provided");
+            const CashFlow& cf = *leg_[i];
+            paymentDates_[i] = cf.date();
+
+            auto coupon = ext::dynamic_pointer_cast<Coupon>(leg_[i]);
+            if (coupon != nullptr)
+                bpsWeights_[i] = coupon->nominal() * coupon->accrualPeriod();
+
+            if (hasStaticAmount(cf)) {
+                kinds_[i] = Fixed;
+                amounts_[i] = cf.amount();
+            } else if (typeid(cf) == typeid(IborCoupon)) {
+                auto ibor = ext::static_pointer_cast<IborCoupon>(leg_[i]);
+                // coupons on a different index are left to their pricer
+                if (hasLinearRate(*ibor) &&
+                    (index_ == nullptr || ibor->iborIndex() == index_)) {
+                    index_ = ibor->iborIndex();
+                    kinds_[i] = Forecast;
+                    forecastIndex_[i] = valueDates_.size();
+                    pricers_.push_back(ibor->pricer());
+                    fixingDates_.push_back(ibor->fixingDate());
+                    valueDates_.push_back(ibor->fixingValueDate());
+                    endDates_.push_back(ibor->fixingEndDate());
+                    spanningTimes_.push_back(ibor->spanningTime());
+                    gearings_.push_back(ibor->gearing());
+                    spreads_.push_back(ibor->spread());
+                    accrualPeriods_.push_back(ibor->accrualPeriod());
+                    nominals_.push_back(ibor->nominal());
+                }
+            }
+        }
+    }
+
+    bool StaticLeg::isCurrentFor(const Leg& leg) const {
+        if (leg.size() != leg_.size())
+            return false;
+        for (Size i=0; i<leg.size(); ++i) {
+            if (leg[i] != leg_[i])
+                return false;
+            if (kinds_[i] == Forecast &&
+                ext::static_pointer_cast<FloatingRateCoupon>(leg[i])->pricer() !=
+                    pricers_[forecastIndex_[i]])
+                return false;
+        }
+        return true;
+    }
+
+    ext::shared_ptr<const std::vector<Time> >
+    StaticLeg::times(const YieldTermStructure& curve,
+                     const std::vector<Date>& dates,
+                     TimeCache& cache) const {
+        Date referenceDate = curve.referenceDate();
+        DayCounter dayCounter = curve.dayCounter();
+        {
+            std::lock_guard<std::mutex> lock(timesMutex_);
+            if (cache.times != nullptr &&
+                cache.referenceDate == referenceDate &&
+                cache.dayCounter == dayCounter)
+                return cache.times;
+        }
+
+        // the times are calculated outside of the lock; the cached
+        // vector is replaced, never modified, so that callers can
+        // keep using the one they got
+        auto times = ext::make_shared<std::vector<Time> >(dates.size());
+        for (Size i=0; i<dates.size(); ++i)
+            (*times)[i] = dayCounter.yearFraction(referenceDate, dates[i]);
+
+        std::lock_guard<std::mutex> lock(timesMutex_);
+        cache.referenceDate = referenceDate;
+        cache.dayCounter = dayCounter;
+        cache.times = times;
+        return cache.times;
+    }
+
+    void StaticLeg::aliveAmounts(bool includeSettlementDateFlows,
+                                 const Date& settlementDate,
+                                 std::vector<Size>& alive,
+                                 std::vector<Real>& amounts) const {
+        alive.clear();
+        for (Size i=0; i<leg_.size(); ++i) {
+            const CashFlow& cf = *leg_[i];
+            if (!cf.hasOccurred(settlementDate, includeSettlementDateFlows) &&
+                !cf.tradingExCoupon(settlementDate))
+                alive.push_back(i);
+        }
+
+        amounts.resize(alive.size());
+        Date today = Settings::instance().evaluationDate();
+        bool canForecast =
+            index_ != nullptr && !index_->forwardingTermStructure().empty();
+        std::vector<Size> forecast;
+        for (Size k=0; k<alive.size(); ++k) {
+            Size i = alive[k];
+            switch (kinds_[i]) {
+              case Fixed:
+                amounts[k] = amounts_[i];
+                break;
+              case Forecast:
+                // fixings already determined are left to the coupon,
+                // which also manages the historical fixings
+                if (canForecast && fixingDates_[forecastIndex_[i]] > today) {
+                    forecast.push_back(k);
+                    break;
+                }
+                amounts[k] = leg_[i]->amount();
+                break;
+              default:
+                amounts[k] = leg_[i]->amount();
+            }
+        }
+
+        if (forecast.empty())
+            return;
+
+        // all the estimation periods are discounted with a single query
+        const YieldTermStructure& curve = **index_->forwardingTermStructure();
+        const ext::shared_ptr<const std::vector<Time> > valueTimes =
+            times(curve, valueDates_, valueTimes_);
+        const ext::shared_ptr<const std::vector<Time> > endTimes =
+            times(curve, endDates_, endTimes_);
+        const std::vector<Time>& t1 = *valueTimes;
+        const std::vector<Time>& t2 = *endTimes;
+        Size m = forecast.size();
+        std::vector<Time> t(2*m);
+        for (Size j=0; j<m; ++j) {
+            Size f = forecastIndex_[alive[forecast[j]]];
+            t[j] = t1[f];
+            t[m+j] = t2[f];
+        }
+        std::vector<DiscountFactor> discounts;
+        curve.discount(t, discounts);
+        for (Size j=0; j<m; ++j) {
+            Size f = forecastIndex_[alive[forecast[j]]];
+            Rate fixing = (discounts[j]/discounts[m+j] - 1.0) / spanningTimes_[f];
+            Rate rate = gearings_[f] * fixing + spreads_[f];
+            amounts[forecast[j]] = rate * accrualPeriods_[f] * nominals_[f];
+        }
+    }
+
+    Real StaticLeg::npv(const YieldTermStructure& discountCurve,
+                        bool includeSettlementDateFlows,
+                        Date settlementDate,
+                        Date npvDate) const {
+        return npvbps(discountCurve, includeSettlementDateFlows,
+                      settlementDate, npvDate).first;
+    }
+
+    std::pair<Real, Real> StaticLeg::npvbps(const YieldTermStructure& discountCurve,
+                                            bool includeSettlementDateFlows,
+                                            Date settlementDate,
+                                            Date npvDate) const {
+        if (leg_.empty())
+            return { 0.0, 0.0 };
+
+        if (settlementDate == Date())
+            settlementDate = Settings::instance().evaluationDate();
+
+        if (npvDate == Date())
+            npvDate = settlementDate;
+
+        std::vector<Size> alive;
+        std::vector<Real> amounts;
+        aliveAmounts(includeSettlementDateFlows, settlementDate, alive, amounts);
+
+        const ext::shared_ptr<const std::vector<Time> > cachedTimes =
+            times(discountCurve, paymentDates_, paymentTimes_);
+        const std::vector<Time>& paymentTimes = *cachedTimes;
+        std::vector<Time> t(alive.size());
+        for (Size k=0; k<alive.size(); ++k)
+            t[k] = paymentTimes[alive[k]];
+        std::vector<DiscountFactor> discounts;
+        discountCurve.discount(t, discounts);
+
+        Real npv = 0.0, bps = 0.0;
+        for (Size k=0; k<alive.size(); ++k) {
+            npv += amounts[k] * discounts[k];
+            bps += bpsWeights_[alive[k]] * discounts[k];
+        }
+
+        DiscountFactor d = discountCurve.discount(npvDate);
+        npv /= d;
+        bps = basisPoint_ * bps / d;
+
+        return { npv, bps };
+    }
+
+}
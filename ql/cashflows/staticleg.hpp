@@ -0,0 +1,131 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file staticleg.hpp
+    \brief Compact representation of a leg for repeated discounting
+*/
+
+#ifndef quantlib_static_leg_hpp
+#define quantlib_static_leg_hpp
+
+#include <ql/cashflow.hpp>
+#include <ql/time/daycounter.hpp>
+#include <mutex>
+#include <utility>
+
+namespace QuantLib {
+
+    class YieldTermStructure;
+    class IborIndex;
+    class FloatingRateCouponPricer;
+
+    //! compact representation of a leg
+    /*! The quantities that only depend on dates (payment dates,
+        accrual periods, fixing and estimation dates, spanning
+        times, fixed amounts) are extracted once from the cash flows
+        and stored in plain arrays; payment and estimation times are
+        cached for the last reference date and day counter seen, so
+        that repricing after a change in the curves only requires a
+        bulk query of discount factors and a tight loop over the
+        stored arrays.
+
+        Ibor coupons paying a linear rate (i.e., not in arrears and
+        priced by a BlackIborCouponPricer with the default timing
+        adjustment) are forecast directly from the forwarding curve
+        of their index when their fixing date is in the future;
+        fixed-rate coupons and simple cash flows use their stored
+        amount.  Any other cash flow, as well as the coupons whose
+        fixing is already determined, falls back on its own
+        amount() method, so that the results are the same as the
+        ones returned by the corresponding CashFlows methods.
+
+        The cached times are replaced as a whole and guarded by a
+        mutex, so that the same representation can be used by
+        several engines running concurrently.
+
+        \warning The representation refers to the coupon pricers set
+                 when it was built; isCurrentFor() can be used to
+                 check whether it needs to be rebuilt.
+    */
+    class StaticLeg {
+      public:
+        explicit StaticLeg(Leg leg);
+        StaticLeg(const StaticLeg&) = delete;
+        StaticLeg& operator=(const StaticLeg&) = delete;
+        //! \name Inspectors
+        //@{
+        const Leg& leg() const { return leg_; }
+        Size size() const { return leg_.size(); }
+        //! number of coupons forecast directly from the index curve
+        Size forecastCoupons() const { return valueDates_.size(); }
+        Date startDate() const { return startDate_; }
+        Date maturityDate() const { return maturityDate_; }
+        /*! returns whether the representation was built from the
+            cash flows in the given leg and their current pricers.
+        */
+        bool isCurrentFor(const Leg& leg) const;
+        //@}
+        //! \name Calculations
+        //@{
+        //! same as CashFlows::npv
+        Real npv(const YieldTermStructure& discountCurve,
+                 bool includeSettlementDateFlows,
+                 Date settlementDate = Date(),
+                 Date npvDate = Date()) const;
+        //! same as CashFlows::npvbps
+        std::pair<Real, Real> npvbps(const YieldTermStructure& discountCurve,
+                                     bool includeSettlementDateFlows,
+                                     Date settlementDate = Date(),
+                                     Date npvDate = Date()) const;
+        //@}
+      private:
+        enum Kind { Fixed, Forecast, Other };
+        struct TimeCache {
+            Date referenceDate;
+            DayCounter dayCounter;
+            ext::shared_ptr<const std::vector<Time> > times;
+        };
+        ext::shared_ptr<const std::vector<Time> > times(
+            const YieldTermStructure& curve,
+            const std::vector<Date>& dates,
+            TimeCache& cache) const;
+        void aliveAmounts(bool includeSettlementDateFlows,
+                          const Date& settlementDate,
+                          std::vector<Size>& alive,
+                          std::vector<Real>& amounts) const;
+
+        Leg leg_;
+        Date startDate_, maturityDate_;
+        // one entry per cash flow
+        std::vector<Kind> kinds_;
+        std::vector<Date> paymentDates_;
+        std::vector<Real> amounts_, bpsWeights_;
+        std::vector<Size> forecastIndex_;
+        // one entry per forecast coupon
+        ext::shared_ptr<IborIndex> index_;
+        std::vector<ext::shared_ptr<FloatingRateCouponPricer> > pricers_;
+        std::vector<Date> fixingDates_, valueDates_, endDates_;
+        std::vector<Time> spanningTimes_;
+        std::vector<Real> gearings_, spreads_, accrualPeriods_, nominals_;
+        // times cached for the last curves used
+        mutable TimeCache paymentTimes_, valueTimes_, endTimes_;
+        mutable std::mutex timesMutex_;
+    };
+
+}
+
+#endif
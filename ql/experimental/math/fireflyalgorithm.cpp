@@ -41,6 +41,10 @@ namespace QuantLib {
 
     void FireflyAlgorithm::startState(Problem &P, const EndCriteria &endCriteria) {
         N_ = P.currentValue().size();
+        x_.clear();
+        xI_.clear();
+        xRW_.clear();
+        values_.clear();
         x_.reserve(M_);
         xI_.reserve(M_);
         xRW_.reserve(M_);
@@ -63,10 +67,13 @@ namespace QuantLib {
                 //Assign X=lb+(ub-lb)*random
                 x[j] = lX_[j] + bounds[j] * sample[j];
             }
-            //Evaluate point
-            values_.emplace_back(P.value(x), i);
         }
 
+        //Evaluate points
+        std::vector<Real> values = P.value(x_);
+        for (Size i = 0; i < M_; i++)
+            values_.emplace_back(values[i], i);
+
         //init intensity & randomWalk
         intensity_->init(this);
         randomWalk_->init(this);
@@ -172,30 +179,41 @@ namespace QuantLib {
                 //Prepare random walk
                 randomWalk_->walk();
 
-                //Loop over particles
+                //Move particles; the moves only depend on the
+                //positions before this step, so that the new points
+                //can be evaluated together
+                std::vector<Array> moved(Mfa_, Array(N_));
                 for (Size i = 0; i < Mfa_; i++) {
                     Size index = values_[i].second;
-                    Array& x   = x_[index];
-                    Array& xI  = xI_[index];
-                    Array& xRW = xRW_[index];
+                    const Array& x   = x_[index];
+                    const Array& xI  = xI_[index];
+                    const Array& xRW = xRW_[index];
+                    Array& y = moved[i];
 
                     //Loop over dimensions
                     for (Size j = 0; j < N_; j++) {
                         //Update position
-                        z[j] = x[j] + xI[j] + xRW[j];
+                        y[j] = x[j] + xI[j] + xRW[j];
                         //Enforce bounds on positions
-                        if (z[j] < lX_[j]) {
-                            z[j] = lX_[j];
+                        if (y[j] < lX_[j]) {
+                            y[j] = lX_[j];
                         }
-                        else if (z[j] > uX_[j]) {
-                            z[j] = uX_[j];
+                        else if (y[j] > uX_[j]) {
+                            y[j] = uX_[j];
                         }
                     }
-                    Real val = P.value(z);
+                }
+                std::vector<Real> movedValues = P.value(moved);
+
+                //Loop over particles
+                for (Size i = 0; i < Mfa_; i++) {
+                    Size index = values_[i].second;
+                    Array& x   = x_[index];
+                    Real val = movedValues[i];
                     if(!std::isnan(val))
 					{
 						//Accept new point
-                        x = z;
+                        x = moved[i];
                         values_[index].first = val;
                         //mark best
                         if (val < bestValue) {
@@ -55,6 +55,10 @@ namespace QuantLib {
         N_ = P.currentValue().size();
         topology_->setSize(M_);
         inertia_->setSize(M_, N_, c0_, endCriteria);
+        X_.clear();
+        V_.clear();
+        pBX_.clear();
+        gBX_.clear();
         X_.reserve(M_);
         V_.reserve(M_);
         pBX_.reserve(M_);
@@ -82,11 +86,14 @@ namespace QuantLib {
                 //Assign V=(ub-lb)*2*random-(ub-lb) -> between (lb-ub) and (ub-lb)
                 v[j] = bounds[j] * (2.0*sample[2 * j + 1] - 1.0);
             }
-            //Evaluate X and assign as personal best
+            //Assign X as personal best
             pBX_.push_back(X_.back());
-            pBF_[i] = P.value(X_.back());
         }
 
+        //Evaluate personal bests
+        std::vector<Real> values = P.value(X_);
+        std::copy(values.begin(), values.end(), pBF_.begin());
+
         //init topology & inertia
         topology_->init(this);
         inertia_->init(this);
@@ -127,10 +134,12 @@ namespace QuantLib {
             //Call inertia to change internal state
             inertia_->setValues();
 
-            //Loop over particles
+            //Loop over particles; as each move only depends on the
+            //particle itself and on the social best, the new points
+            //can be evaluated together
             for (Size i = 0; i < M_; i++) {
                 Array& x = X_[i];
-                Array& pB = pBX_[i];
+                const Array& pB = pBX_[i];
                 const Array& gB = gBX_[i];
                 Array& v = V_[i];
 
@@ -150,12 +159,16 @@ namespace QuantLib {
                         v[j] = 0.0;
                     }
                 }
-                //Evaluate x
-                Real f = P.value(x);
+            }
+
+            //Evaluate particles
+            std::vector<Real> values = P.value(X_);
+            for (Size i = 0; i < M_; i++) {
+                Real f = values[i];
                 if (f < pBF_[i]) {
                     //Update personal best
                     pBF_[i] = f;
-                    pB = x;
+                    pBX_[i] = X_[i];
                     //Check stationary condition
                     if (f < bestValue) {
                         bestValue = f;
@@ -45,6 +45,7 @@
 #include <ql/timegrid.hpp>
 #include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 
 namespace QuantLib {
@@ -283,7 +284,7 @@ namespace QuantLib {
         return localVol_.currentLink();
     }
 
-    ext::shared_ptr<LocalVolTermStructure>
+    ext::shared_ptr<FixedLocalVolSurface>
     HestonSLVFDMModel::leverageFunction() const {
         calculate();
 
@@ -429,6 +430,8 @@ namespace QuantLib {
         Array p = FdmHestonGreensFct(mesher, hestonProcess, trafoType, lv0)
             .get(timeGrid->at(1), params_.greensAlgorithm);
 
+        std::vector<std::string> failures(xGrid);
+
         if (logging_) {
             const LogEntry entry = { timeGrid->at(1),
                 ext::make_shared<Array>(p), mesher };
@@ -472,7 +475,7 @@ namespace QuantLib {
                 const ext::shared_ptr<FdmScheme> fdmScheme(
                     fdmSchemeFactory(fdmSchemeDesc, hestonFwdOp));
 
-                for (Size j=0; j < x.size(); ++j) {
+                const auto leverage = [&](Size j) {
                     Array pSlice(vGrid);
                     for (Size k=0; k < vGrid; ++k)
                         pSlice[k] = pn[j + k*xGrid];
@@ -494,9 +497,27 @@ namespace QuantLib {
                       ? localVol*std::sqrt(scale) : Real(1.0);
 
                     (*L)[j][i] = std::min(50.0, std::max(0.001, l));
-
-                    leverageFct->setInterpolation(Linear());
+                };
+
+                // the first point is done serially, so that the local
+                // volatility surface is calculated before the parallel loop
+                leverage(0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(parallelCalibration_)
+#endif
+                for (long j=1; j < static_cast<long>(x.size()); ++j) {
+                    try {
+                        leverage(j);
+                    } catch (std::exception& e) {
+                        failures[j] = e.what();
+                    }
                 }
+                for (Size j=1; j < x.size(); ++j)
+                    QL_REQUIRE(failures[j].empty(), failures[j]);
+
+                // the leverage function is not used above, so that
+                // its interpolation is updated once for all points
+                leverageFct->setInterpolation(Linear());
 
                 const Real sLowerBound = std::max(x.front(),
                     std::exp(localVolRND.invcdf(
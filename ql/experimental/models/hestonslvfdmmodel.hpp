@@ -31,6 +31,7 @@
 #include <ql/methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
 #include <ql/methods/finitedifferences/meshers/fdmmeshercomposite.hpp>
 #include <ql/experimental/finitedifferences/fdmhestongreensfct.hpp>
+#include <ql/termstructures/volatility/equityfx/fixedlocalvolsurface.hpp>
 
 #include <list>
 
@@ -82,7 +83,29 @@ class SimpleQuote;
 
         ext::shared_ptr<HestonProcess> hestonProcess() const;
         ext::shared_ptr<LocalVolTermStructure> localVol() const;
-        ext::shared_ptr<LocalVolTermStructure> leverageFunction() const;
+        /*! The leverage function is returned as a FixedLocalVolSurface,
+            which can be saved and loaded back for repricing without
+            running the calibration again.
+        */
+        ext::shared_ptr<FixedLocalVolSurface> leverageFunction() const;
+
+        //! \name Parallel calibration
+        /*! When enabled and OpenMP is available, the leverage
+            function is calculated concurrently over the spot grid at
+            each time step of the Fokker-Planck equation.  The results
+            do not change.
+
+            \warning the local volatility surface must be safe to use
+                     from several threads once calculated.
+        */
+        //@{
+        //! enable parallel evaluation in subsequent calibrations
+        void enableParallelCalibration(bool b = true) { parallelCalibration_ = b; }
+        //! disable parallel evaluation in subsequent calibrations
+        void disableParallelCalibration(bool b = true) { parallelCalibration_ = !b; }
+        //! tells whether parallel evaluation is enabled
+        bool allowsParallelCalibration() const { return parallelCalibration_; }
+        //@}
 
         struct LogEntry {
             const Time t;
@@ -102,10 +125,11 @@ class SimpleQuote;
         const std::vector<Date> mandatoryDates_;
         const Real mixingFactor_;
 
-        mutable ext::shared_ptr<LocalVolTermStructure> leverageFunction_;
+        mutable ext::shared_ptr<FixedLocalVolSurface> leverageFunction_;
 
         const bool logging_;
         mutable std::list<LogEntry> logEntries_;
+        bool parallelCalibration_ = false;
     };
 }
 
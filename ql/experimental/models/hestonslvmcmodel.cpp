@@ -33,6 +33,7 @@
 #include <boost/multi_array.hpp>
 #pragma pop_macro("BOOST_DISABLE_ASSERTS")
 
+#include <string>
 #include <utility>
 
 namespace QuantLib {
@@ -75,7 +76,7 @@ namespace QuantLib {
         return localVol_.currentLink();
     }
 
-    ext::shared_ptr<LocalVolTermStructure>
+    ext::shared_ptr<FixedLocalVolSurface>
     HestonSLVMCModel::leverageFunction() const {
         calculate();
 
@@ -143,13 +144,19 @@ namespace QuantLib {
             }
         }
 
+        // first index of each bin in the sorted paths
+        std::vector<Size> binStart(nBins_+1, 0U);
+        for (Size i=0; i < nBins_; ++i)
+            binStart[i+1] = binStart[i] + k + static_cast<Size>(i < m);
+
+        std::vector<std::string> failures(std::max(calibrationPaths_, nBins_));
+
         for (Size n=1; n < timeGrid_->size(); ++n) {
             const Time t = timeGrid_->at(n-1);
             const Time dt = timeGrid_->dt(n-1);
 
-            Array x0(2), dw(2);
-
-            for (Size i=0; i < calibrationPaths_; ++i) {
+            const auto evolve = [&](Size i) {
+                Array x0(2), dw(2);
                 x0[0] = pairs[i].first;
                 x0[1] = pairs[i].second;
 
@@ -160,26 +167,52 @@ namespace QuantLib {
 
                 pairs[i].first = x0[0];
                 pairs[i].second = x0[1];
+            };
+
+            // the first path is evolved serially, so that the term
+            // structures are calculated before the parallel loop
+            evolve(0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(parallelCalibration_)
+#endif
+            for (long i=1; i < static_cast<long>(calibrationPaths_); ++i) {
+                try {
+                    evolve(i);
+                } catch (std::exception& e) {
+                    failures[i] = e.what();
+                }
             }
+            for (Size i=1; i < calibrationPaths_; ++i)
+                QL_REQUIRE(failures[i].empty(), failures[i]);
 
             std::sort(pairs.begin(), pairs.end());
 
-            Size s = 0U, e = 0U;
-            for (Size i=0; i < nBins_; ++i) {
-                const Size inc = k + static_cast<unsigned long>(i < m);
-                e = s + inc;
+            const auto leverage = [&](Size i) {
+                const Size s = binStart[i], e = binStart[i+1];
 
                 Real sum=0.0;
                 for (Size j=s; j < e; ++j) {
                     sum+=pairs[j].second;
                 }
-                sum/=inc;
+                sum/=(e-s);
 
                 vStrikes[n]->at(i) = 0.5*(pairs[e-1].first + pairs[s].first);
                 (*L)[i][n] = std::sqrt(squared(localVol_->localVol(t, vStrikes[n]->at(i), true))/sum);
+            };
 
-                s = e;
+            leverage(0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(parallelCalibration_)
+#endif
+            for (long i=1; i < static_cast<long>(nBins_); ++i) {
+                try {
+                    leverage(i);
+                } catch (std::exception& e) {
+                    failures[i] = e.what();
+                }
             }
+            for (Size i=1; i < nBins_; ++i)
+                QL_REQUIRE(failures[i].empty(), failures[i]);
 
             leverageFunction_->setInterpolation<Linear>();
         }
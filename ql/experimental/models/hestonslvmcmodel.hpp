@@ -54,7 +54,30 @@ namespace QuantLib {
 
         ext::shared_ptr<HestonProcess> hestonProcess() const;
         ext::shared_ptr<LocalVolTermStructure> localVol() const;
-        ext::shared_ptr<LocalVolTermStructure> leverageFunction() const;
+        /*! The leverage function is returned as a FixedLocalVolSurface,
+            which can be saved and loaded back for repricing without
+            running the calibration again.
+        */
+        ext::shared_ptr<FixedLocalVolSurface> leverageFunction() const;
+
+        //! \name Parallel calibration
+        /*! When enabled and OpenMP is available, the calibration
+            paths are evolved concurrently at each time step, and the
+            leverage function is calculated concurrently over the
+            bins.  The results do not change.
+
+            \warning the local volatility surface and the term
+                     structures of the Heston process must be safe to
+                     use from several threads once calculated.
+        */
+        //@{
+        //! enable parallel evaluation in subsequent calibrations
+        void enableParallelCalibration(bool b = true) { parallelCalibration_ = b; }
+        //! disable parallel evaluation in subsequent calibrations
+        void disableParallelCalibration(bool b = true) { parallelCalibration_ = !b; }
+        //! tells whether parallel evaluation is enabled
+        bool allowsParallelCalibration() const { return parallelCalibration_; }
+        //@}
 
       protected:
         void performCalculations() const override;
@@ -67,6 +90,7 @@ namespace QuantLib {
         const Size nBins_, calibrationPaths_;
         const Real mixingFactor_;
         ext::shared_ptr<TimeGrid> timeGrid_;
+        bool parallelCalibration_ = false;
 
         mutable ext::shared_ptr<FixedLocalVolSurface> leverageFunction_;
     };
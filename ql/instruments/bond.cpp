@@ -26,6 +26,7 @@
 #include <ql/cashflows/cashflows.hpp>
 #include <ql/cashflows/floatingratecoupon.hpp>
 #include <ql/cashflows/simplecashflow.hpp>
+#include <ql/cashflows/staticleg.hpp>
 #include <ql/instruments/bond.hpp>
 #include <ql/math/solvers1d/brent.hpp>
 #include <ql/pricingengines/bond/bondfunctions.hpp>
@@ -288,6 +289,13 @@ namespace QuantLib {
 
         arguments->settlementDate = settlementDate();
         arguments->cashflows = cashflows_;
+        if (arguments->useStaticCashflows) {
+            if (staticCashflows_ == nullptr || !staticCashflows_->isCurrentFor(cashflows_))
+                staticCashflows_ = ext::make_shared<StaticLeg>(cashflows_);
+            arguments->staticCashflows = staticCashflows_;
+        } else {
+            arguments->staticCashflows.reset();
+        }
         arguments->calendar = calendar_;
     }
 
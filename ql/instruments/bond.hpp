@@ -40,6 +40,7 @@
 namespace QuantLib {
 
     class DayCounter;
+    class StaticLeg;
 
     //! Base bond class
     /*! Derived classes must fill the uninitialized data members.
@@ -290,12 +291,18 @@ namespace QuantLib {
 
         Date maturityDate_, issueDate_;
         mutable Real settlementValue_;
+        // compact representation of the cash flows, built on first use
+        mutable ext::shared_ptr<StaticLeg> staticCashflows_;
     };
 
     class Bond::arguments : public PricingEngine::arguments {
       public:
         Date settlementDate;
         Leg cashflows;
+        //! set by engines using the compact representation of the cash flows
+        bool useStaticCashflows = false;
+        //! compact representation of the cash flows, null if not used
+        ext::shared_ptr<StaticLeg> staticCashflows;
         Calendar calendar;
         void validate() const override;
     };
@@ -22,6 +22,7 @@
 #include <ql/instruments/swap.hpp>
 #include <ql/cashflows/cashflows.hpp>
 #include <ql/cashflows/floatingratecoupon.hpp>
+#include <ql/cashflows/staticleg.hpp>
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <ostream>
 
@@ -91,6 +92,20 @@ namespace QuantLib {
 
         arguments->legs = legs_;
         arguments->payer = payer_;
+
+        // the representation is only built for the engines using it,
+        // and rebuilt only if the legs or their pricers were changed
+        // since it was last used
+        if (arguments->useStaticLegs) {
+            staticLegs_.resize(legs_.size());
+            for (Size j=0; j<legs_.size(); ++j) {
+                if (staticLegs_[j] == nullptr || !staticLegs_[j]->isCurrentFor(legs_[j]))
+                    staticLegs_[j] = ext::make_shared<StaticLeg>(legs_[j]);
+            }
+            arguments->staticLegs = staticLegs_;
+        } else {
+            arguments->staticLegs.clear();
+        }
     }
 
     void Swap::fetchResults(const PricingEngine::results* r) const {
@@ -32,6 +32,8 @@
 
 namespace QuantLib {
 
+    class StaticLeg;
+
     //! Interest rate swap
     /*! The cash flows belonging to the first leg are paid;
         the ones belonging to the second leg are received.
@@ -135,6 +137,8 @@ namespace QuantLib {
         mutable std::vector<Real> legBPS_;
         mutable std::vector<DiscountFactor> startDiscounts_, endDiscounts_;
         mutable DiscountFactor npvDateDiscount_;
+        // compact representation of the legs, built on first use
+        mutable std::vector<ext::shared_ptr<StaticLeg> > staticLegs_;
     };
 
 
@@ -142,6 +146,10 @@ namespace QuantLib {
       public:
         std::vector<Leg> legs;
         std::vector<Real> payer;
+        //! set by engines using the compact representation of the legs
+        bool useStaticLegs = false;
+        //! compact representation of the legs, empty if not used
+        std::vector<ext::shared_ptr<StaticLeg> > staticLegs;
         void validate() const override;
     };
 
@@ -68,6 +68,31 @@ namespace QuantLib {
             virtual Real primitive(Real) const = 0;
             virtual Real derivative(Real) const = 0;
             virtual Real secondDerivative(Real) const = 0;
+            /*! Bulk versions of value() and primitive(); the output
+                vector is already sized.  Implementations can assume
+                the abscissae to be sorted for speed, but must still
+                return correct results for unsorted ones.
+            */
+            virtual void values(const std::vector<Real>& x,
+                                std::vector<Real>& y) const {
+                for (Size i=0; i<x.size(); ++i)
+                    y[i] = value(x[i]);
+            }
+            virtual void primitives(const std::vector<Real>& x,
+                                    std::vector<Real>& y) const {
+                for (Size i=0; i<x.size(); ++i)
+                    y[i] = primitive(x[i]);
+            }
+            /*! Versions of value() and primitive() starting the search
+                for the enclosing segment from the hinted one, which is
+                then updated.  The default implementations ignore it.
+            */
+            virtual Real hintedValue(Real x, Size&) const {
+                return value(x);
+            }
+            virtual Real hintedPrimitive(Real x, Size&) const {
+                return primitive(x);
+            }
         };
         ext::shared_ptr<Impl> impl_;
       public:
@@ -123,6 +148,33 @@ namespace QuantLib {
                 else
                     return std::upper_bound(xBegin_,xEnd_-1,x)-xBegin_-1;
             }
+            /*! Same result as locate(x), but the search gallops
+                forward from the given segment with doubling steps and
+                then bisects the last step; its cost grows with the
+                logarithm of the distance from the hint, i.e., it is
+                constant when x lies in the hinted segment or in the
+                next one.  It falls back to a binary search if x lies
+                before the hinted segment.
+            */
+            Size locate(Real x, Size hint) const {
+                const Size last = (xEnd_-xBegin_)-2;
+                if (x < *xBegin_)
+                    return 0;
+                else if (x > *(xEnd_-1))
+                    return last;
+                if (hint > last)
+                    hint = last;
+                if (x < xBegin_[hint])
+                    return locate(x);
+                Size step = 1;
+                while (hint+step <= last && x >= xBegin_[hint+step]) {
+                    hint += step;
+                    step *= 2;
+                }
+                const Size end = std::min(hint+step, last+1);
+                return std::upper_bound(xBegin_+hint+1, xBegin_+end, x)
+                    - xBegin_ - 1;
+            }
             I1 xBegin_, xEnd_;
             I2 yBegin_;
         };
@@ -146,6 +198,48 @@ namespace QuantLib {
             checkRange(x,allowExtrapolation);
             return impl_->secondDerivative(x);
         }
+        /*! Evaluates the interpolation at the abscissae in \c x and
+            stores the results in \c y, which is resized if needed.
+            When \c x is sorted, most interpolations locate all the
+            points in a single scan over the nodes instead of
+            performing a binary search for each point.
+        */
+        void operator()(const std::vector<Real>& x,
+                        std::vector<Real>& y,
+                        bool allowExtrapolation = false) const {
+            checkRange(x, allowExtrapolation);
+            y.resize(x.size());
+            impl_->values(x, y);
+        }
+        //! bulk version of primitive(); see above for details.
+        void primitive(const std::vector<Real>& x,
+                       std::vector<Real>& y,
+                       bool allowExtrapolation = false) const {
+            checkRange(x, allowExtrapolation);
+            y.resize(x.size());
+            impl_->primitives(x, y);
+        }
+        /*! Evaluates the interpolation at \c x, starting the search for
+            the enclosing segment from \c hint and storing the segment
+            found there.  The search gallops forward from the hint, so
+            that its cost grows with the logarithm of the number of
+            segments skipped; when successive calls are made at
+            nearby increasing abscissae, as when scanning a dense
+            grid, it takes constant time instead of a binary search
+            per call.  Any hint (e.g., 0 for the first call) gives
+            correct results.
+        */
+        Real operator()(Real x, Size& hint,
+                        bool allowExtrapolation = false) const {
+            checkRange(x,allowExtrapolation);
+            return impl_->hintedValue(x, hint);
+        }
+        //! hinted version of primitive(); see above for details.
+        Real primitive(Real x, Size& hint,
+                       bool allowExtrapolation = false) const {
+            checkRange(x,allowExtrapolation);
+            return impl_->hintedPrimitive(x, hint);
+        }
         Real xMin() const {
             return impl_->xMin();
         }
@@ -166,6 +260,13 @@ namespace QuantLib {
                        << impl_->xMin() << ", " << impl_->xMax()
                        << "]: extrapolation at " << x << " not allowed");
         }
+        void checkRange(const std::vector<Real>& x, bool extrapolate) const {
+            if (!x.empty() && !extrapolate && !allowsExtrapolation()) {
+                auto bounds = std::minmax_element(x.begin(), x.end());
+                checkRange(*bounds.first, false);
+                checkRange(*bounds.second, false);
+            }
+        }
     };
 
 }
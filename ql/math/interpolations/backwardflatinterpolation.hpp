@@ -88,24 +88,70 @@ namespace QuantLib {
                     || std::distance(this->xBegin_, this->xEnd_) == 1)
                     return this->yBegin_[0];
 
-                Size i = this->locate(x);
-                if (x == this->xBegin_[i])
-                    return this->yBegin_[i];
-                else
-                    return this->yBegin_[i+1];
+                return valueAt(x, this->locate(x));
             }
             Real primitive(Real x) const override {
                 if (std::distance(this->xBegin_, this->xEnd_) == 1)
                     return (x - this->xBegin_[0]) * this->yBegin_[0];
 
-                Size i = this->locate(x);
-                Real dx = x-this->xBegin_[i];
-                return primitive_[i] + dx*this->yBegin_[i+1];
+                return primitiveAt(x, this->locate(x));
             }
             Real derivative(Real) const override { return 0.0; }
             Real secondDerivative(Real) const override { return 0.0; }
+            void values(const std::vector<Real>& x,
+                        std::vector<Real>& y) const override {
+                if (std::distance(this->xBegin_, this->xEnd_) == 1) {
+                    std::fill(y.begin(), y.end(), this->yBegin_[0]);
+                    return;
+                }
+                Size i = 0;
+                for (Size k=0; k<x.size(); ++k) {
+                    if (x[k] <= this->xBegin_[0]) {
+                        y[k] = this->yBegin_[0];
+                    } else {
+                        i = this->locate(x[k], i);
+                        y[k] = valueAt(x[k], i);
+                    }
+                }
+            }
+            void primitives(const std::vector<Real>& x,
+                            std::vector<Real>& y) const override {
+                if (std::distance(this->xBegin_, this->xEnd_) == 1) {
+                    for (Size k=0; k<x.size(); ++k)
+                        y[k] = (x[k] - this->xBegin_[0]) * this->yBegin_[0];
+                    return;
+                }
+                Size i = 0;
+                for (Size k=0; k<x.size(); ++k) {
+                    i = this->locate(x[k], i);
+                    y[k] = primitiveAt(x[k], i);
+                }
+            }
+            Real hintedValue(Real x, Size& hint) const override {
+                if (x <= this->xBegin_[0]
+                    || std::distance(this->xBegin_, this->xEnd_) == 1)
+                    return this->yBegin_[0];
+
+                hint = this->locate(x, hint);
+                return valueAt(x, hint);
+            }
+            Real hintedPrimitive(Real x, Size& hint) const override {
+                if (std::distance(this->xBegin_, this->xEnd_) == 1)
+                    return (x - this->xBegin_[0]) * this->yBegin_[0];
+
+                hint = this->locate(x, hint);
+                return primitiveAt(x, hint);
+            }
 
           private:
+            Real valueAt(Real x, Size i) const {
+                return (x == this->xBegin_[i]) ?
+                    this->yBegin_[i] : this->yBegin_[i+1];
+            }
+            Real primitiveAt(Real x, Size i) const {
+                Real dx = x-this->xBegin_[i];
+                return primitive_[i] + dx*this->yBegin_[i+1];
+            }
             std::vector<Real> primitive_;
         };
 
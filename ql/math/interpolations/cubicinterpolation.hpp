@@ -756,16 +756,10 @@ namespace QuantLib {
                 }
             }
             Real value(Real x) const override {
-                Size j = this->locate(x);
-                Real dx_ = x-this->xBegin_[j];
-                return this->yBegin_[j] + dx_*(a_[j] + dx_*(b_[j] + dx_*c_[j]));
+                return valueAt(x, this->locate(x));
             }
             Real primitive(Real x) const override {
-                Size j = this->locate(x);
-                Real dx_ = x-this->xBegin_[j];
-                return primitiveConst_[j]
-                    + dx_*(this->yBegin_[j] + dx_*(a_[j]/2.0
-                    + dx_*(b_[j]/3.0 + dx_*c_[j]/4.0)));
+                return primitiveAt(x, this->locate(x));
             }
             Real derivative(Real x) const override {
                 Size j = this->locate(x);
@@ -777,8 +771,42 @@ namespace QuantLib {
                 Real dx_ = x-this->xBegin_[j];
                 return 2.0*b_[j] + 6.0*c_[j]*dx_;
             }
+            void values(const std::vector<Real>& x,
+                        std::vector<Real>& y) const override {
+                Size j = 0;
+                for (Size k=0; k<x.size(); ++k) {
+                    j = this->locate(x[k], j);
+                    y[k] = valueAt(x[k], j);
+                }
+            }
+            void primitives(const std::vector<Real>& x,
+                            std::vector<Real>& y) const override {
+                Size j = 0;
+                for (Size k=0; k<x.size(); ++k) {
+                    j = this->locate(x[k], j);
+                    y[k] = primitiveAt(x[k], j);
+                }
+            }
+            Real hintedValue(Real x, Size& hint) const override {
+                hint = this->locate(x, hint);
+                return valueAt(x, hint);
+            }
+            Real hintedPrimitive(Real x, Size& hint) const override {
+                hint = this->locate(x, hint);
+                return primitiveAt(x, hint);
+            }
 
           private:
+            Real valueAt(Real x, Size j) const {
+                Real dx = x-this->xBegin_[j];
+                return this->yBegin_[j] + dx*(a_[j] + dx*(b_[j] + dx*c_[j]));
+            }
+            Real primitiveAt(Real x, Size j) const {
+                Real dx = x-this->xBegin_[j];
+                return primitiveConst_[j]
+                    + dx*(this->yBegin_[j] + dx*(a_[j]/2.0
+                    + dx*(b_[j]/3.0 + dx*c_[j]/4.0)));
+            }
             CubicInterpolation::DerivativeApprox da_;
             bool monotonic_;
             CubicInterpolation::BoundaryCondition leftType_, rightType_;
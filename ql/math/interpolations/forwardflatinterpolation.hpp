@@ -90,14 +90,47 @@ namespace QuantLib {
                 return this->yBegin_[i];
             }
             Real primitive(Real x) const override {
-                Size i = this->locate(x);
-                Real dx = x-this->xBegin_[i];
-                return primitive_[i] + dx*this->yBegin_[i];
+                return primitiveAt(x, this->locate(x));
             }
             Real derivative(Real) const override { return 0.0; }
             Real secondDerivative(Real) const override { return 0.0; }
+            void values(const std::vector<Real>& x,
+                        std::vector<Real>& y) const override {
+                Size i = 0;
+                for (Size k=0; k<x.size(); ++k) {
+                    if (x[k] >= this->xBegin_[n_-1]) {
+                        y[k] = this->yBegin_[n_-1];
+                    } else {
+                        i = this->locate(x[k], i);
+                        y[k] = this->yBegin_[i];
+                    }
+                }
+            }
+            void primitives(const std::vector<Real>& x,
+                            std::vector<Real>& y) const override {
+                Size i = 0;
+                for (Size k=0; k<x.size(); ++k) {
+                    i = this->locate(x[k], i);
+                    y[k] = primitiveAt(x[k], i);
+                }
+            }
+            Real hintedValue(Real x, Size& hint) const override {
+                if (x >= this->xBegin_[n_-1])
+                    return this->yBegin_[n_-1];
+
+                hint = this->locate(x, hint);
+                return this->yBegin_[hint];
+            }
+            Real hintedPrimitive(Real x, Size& hint) const override {
+                hint = this->locate(x, hint);
+                return primitiveAt(x, hint);
+            }
 
           private:
+            Real primitiveAt(Real x, Size i) const {
+                Real dx = x-this->xBegin_[i];
+                return primitive_[i] + dx*this->yBegin_[i];
+            }
             std::vector<Real> primitive_;
             Size n_;
         };
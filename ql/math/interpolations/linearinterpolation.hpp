@@ -86,22 +86,50 @@ namespace QuantLib {
                 }
             }
             Real value(Real x) const override {
-                Size i = this->locate(x);
-                return this->yBegin_[i] + (x-this->xBegin_[i])*s_[i];
+                return valueAt(x, this->locate(x));
             }
             Real primitive(Real x) const override {
-                Size i = this->locate(x);
-                Real dx = x-this->xBegin_[i];
-                return primitiveConst_[i] +
-                    dx*(this->yBegin_[i] + 0.5*dx*s_[i]);
+                return primitiveAt(x, this->locate(x));
             }
             Real derivative(Real x) const override {
                 Size i = this->locate(x);
                 return s_[i];
             }
             Real secondDerivative(Real) const override { return 0.0; }
+            void values(const std::vector<Real>& x,
+                        std::vector<Real>& y) const override {
+                Size i = 0;
+                for (Size k=0; k<x.size(); ++k) {
+                    i = this->locate(x[k], i);
+                    y[k] = valueAt(x[k], i);
+                }
+            }
+            void primitives(const std::vector<Real>& x,
+                            std::vector<Real>& y) const override {
+                Size i = 0;
+                for (Size k=0; k<x.size(); ++k) {
+                    i = this->locate(x[k], i);
+                    y[k] = primitiveAt(x[k], i);
+                }
+            }
+            Real hintedValue(Real x, Size& hint) const override {
+                hint = this->locate(x, hint);
+                return valueAt(x, hint);
+            }
+            Real hintedPrimitive(Real x, Size& hint) const override {
+                hint = this->locate(x, hint);
+                return primitiveAt(x, hint);
+            }
 
           private:
+            Real valueAt(Real x, Size i) const {
+                return this->yBegin_[i] + (x-this->xBegin_[i])*s_[i];
+            }
+            Real primitiveAt(Real x, Size i) const {
+                Real dx = x-this->xBegin_[i];
+                return primitiveConst_[i] +
+                    dx*(this->yBegin_[i] + 0.5*dx*s_[i]);
+            }
             std::vector<Real> primitiveConst_, s_;
         };
 
@@ -387,6 +387,15 @@ namespace QuantLib {
                 return derivative(x)*interpolation_.derivative(x, true) +
                             value(x)*interpolation_.secondDerivative(x, true);
             }
+            void values(const std::vector<Real>& x,
+                        std::vector<Real>& y) const override {
+                interpolation_(x, y, true);
+                for (Real& v : y)
+                    v = std::exp(v);
+            }
+            Real hintedValue(Real x, Size& hint) const override {
+                return std::exp(interpolation_(x, hint, true));
+            }
 
           private:
             std::vector<Real> logY_;
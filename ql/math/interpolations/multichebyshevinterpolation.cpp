@@ -0,0 +1,238 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/errors.hpp>
+#include <ql/math/comparison.hpp>
+#include <ql/math/interpolations/multichebyshevinterpolation.hpp>
+#include <ql/mathconstants.hpp>
+#include <cmath>
+#include <utility>
+
+namespace QuantLib {
+
+    namespace {
+
+        // Chebyshev points of the second kind on [-1, 1], decreasing
+        Real chebyshevNode(Size k, Size n) {
+            return std::cos(M_PI*k/(n-1));
+        }
+
+        // values of T_k(y), T'_k(y) or T''_k(y) for k < n
+        void chebyshevBasis(Real y, Size order, std::vector<Real>& w) {
+            const Size n = w.size();
+            std::vector<Real> t(n), dt(n, 0.0), d2t(n, 0.0);
+            t[0] = 1.0;
+            if (n > 1) {
+                t[1] = y;
+                dt[1] = 1.0;
+            }
+            for (Size k=1; k+1 < n; ++k) {
+                t[k+1] = 2.0*y*t[k] - t[k-1];
+                dt[k+1] = 2.0*t[k] + 2.0*y*dt[k] - dt[k-1];
+                d2t[k+1] = 4.0*dt[k] + 2.0*y*d2t[k] - d2t[k-1];
+            }
+            switch (order) {
+              case 0:
+                w.swap(t);
+                break;
+              case 1:
+                w.swap(dt);
+                break;
+              case 2:
+                w.swap(d2t);
+                break;
+              default:
+                QL_FAIL("derivative order " << order << " not supported");
+            }
+        }
+
+    }
+
+    MultiChebyshevInterpolation::MultiChebyshevInterpolation(
+        std::vector<Real> lower,
+        std::vector<Real> upper,
+        std::vector<Size> nodes,
+        const std::vector<Real>& values)
+    : lower_(std::move(lower)), upper_(std::move(upper)),
+      nodes_(std::move(nodes)) {
+        checkDimensions();
+        calculateCoefficients(values);
+    }
+
+    MultiChebyshevInterpolation::MultiChebyshevInterpolation(
+        std::vector<Real> lower,
+        std::vector<Real> upper,
+        std::vector<Size> nodes,
+        const ext::function<Real(const Array&)>& f)
+    : lower_(std::move(lower)), upper_(std::move(upper)),
+      nodes_(std::move(nodes)) {
+        checkDimensions();
+
+        const std::vector<Array> x = gridPoints(lower_, upper_, nodes_);
+        std::vector<Real> values(x.size());
+        for (Size i=0; i < x.size(); ++i)
+            values[i] = f(x[i]);
+
+        calculateCoefficients(values);
+    }
+
+    void MultiChebyshevInterpolation::checkDimensions() const {
+        QL_REQUIRE(!nodes_.empty(), "no dimensions given");
+        QL_REQUIRE(lower_.size() == nodes_.size()
+                   && upper_.size() == nodes_.size(),
+                   "mismatch between bounds and number of nodes");
+        for (Size i=0; i < nodes_.size(); ++i) {
+            QL_REQUIRE(nodes_[i] > 1,
+                       "at least two nodes required in dimension " << i);
+            QL_REQUIRE(upper_[i] > lower_[i],
+                       "upper bound " << upper_[i]
+                       << " must be greater than lower bound " << lower_[i]
+                       << " in dimension " << i);
+        }
+    }
+
+    std::vector<Array> MultiChebyshevInterpolation::gridPoints(
+        const std::vector<Real>& lower,
+        const std::vector<Real>& upper,
+        const std::vector<Size>& nodes) {
+
+        const Size d = nodes.size();
+        QL_REQUIRE(lower.size() == d && upper.size() == d,
+                   "mismatch between bounds and number of nodes");
+        Size n = 1;
+        for (Size m : nodes) {
+            QL_REQUIRE(m > 1, "at least two nodes required");
+            n *= m;
+        }
+
+        std::vector<Array> x(n, Array(d));
+        for (Size i=0; i < n; ++i) {
+            for (Size j=d, rest=i; j-- > 0; rest /= nodes[j]) {
+                const Real y = chebyshevNode(rest % nodes[j], nodes[j]);
+                x[i][j] = lower[j] + 0.5*(upper[j] - lower[j])*(y + 1.0);
+            }
+        }
+        return x;
+    }
+
+    void MultiChebyshevInterpolation::calculateCoefficients(
+        const std::vector<Real>& values) {
+
+        Size n = 1;
+        for (Size m : nodes_)
+            n *= m;
+        QL_REQUIRE(values.size() == n,
+                   "mismatch between number of values (" << values.size()
+                   << ") and grid points (" << n << ")");
+
+        // discrete cosine transform along each dimension
+        coefficients_ = values;
+        Size stride = 1;
+        for (Size j=nodes_.size(); j-- > 0; stride *= nodes_[j]) {
+            const Size m = nodes_[j];
+            const Size block = m*stride;
+
+            std::vector<Real> cosines(m*m);
+            for (Size p=0; p < m; ++p)
+                for (Size k=0; k < m; ++k)
+                    cosines[p*m+k] = std::cos(M_PI*p*k/(m-1));
+
+            std::vector<Real> fiber(m);
+            for (Size start=0; start < n; start += block) {
+                for (Size offset=0; offset < stride; ++offset) {
+                    Real* c = &coefficients_[start + offset];
+                    for (Size k=0; k < m; ++k)
+                        fiber[k] = c[k*stride];
+
+                    for (Size p=0; p < m; ++p) {
+                        Real sum = 0.5*(fiber[0]*cosines[p*m]
+                                        + fiber[m-1]*cosines[p*m+m-1]);
+                        for (Size k=1; k+1 < m; ++k)
+                            sum += fiber[k]*cosines[p*m+k];
+                        sum *= 2.0/(m-1);
+                        if (p == 0 || p == m-1)
+                            sum *= 0.5;
+                        c[p*stride] = sum;
+                    }
+                }
+            }
+        }
+    }
+
+    Real MultiChebyshevInterpolation::evaluate(
+        const Array& x, Size i, Size order, bool allowExtrapolation) const {
+
+        const Size d = nodes_.size();
+        QL_REQUIRE(x.size() == d,
+                   "point of dimension " << x.size()
+                   << " given, " << d << " required");
+        QL_REQUIRE(order == 0 || i < d,
+                   "dimension " << i << " out of range");
+
+        // contraction with the basis values, last dimension first;
+        // the first one reads the coefficients in place
+        const Real* source = coefficients_.data();
+        std::vector<Real> current, next;
+        std::vector<Real> w;
+        Size size = coefficients_.size();
+        for (Size j=d; j-- > 0;) {
+            const Real scale = 2.0/(upper_[j] - lower_[j]);
+            const Real y = scale*(x[j] - lower_[j]) - 1.0;
+            QL_REQUIRE(allowExtrapolation
+                       || (y >= -1.0 && y <= 1.0)
+                       || close_enough(std::fabs(y), 1.0),
+                       "point " << x[j] << " outside of ["
+                       << lower_[j] << ", " << upper_[j]
+                       << "] in dimension " << j);
+
+            const Size m = nodes_[j];
+            w.resize(m);
+            const Size o = (j == i) ? order : 0;
+            chebyshevBasis(y, o, w);
+            const Real factor = (o == 0) ? 1.0 : std::pow(scale, Real(o));
+
+            size /= m;
+            next.assign(size, 0.0);
+            for (Size k=0; k < size; ++k) {
+                Real sum = 0.0;
+                for (Size p=0; p < m; ++p)
+                    sum += source[k*m+p]*w[p];
+                next[k] = factor*sum;
+            }
+            current.swap(next);
+            source = current.data();
+        }
+
+        return source[0];
+    }
+
+    Real MultiChebyshevInterpolation::operator()(
+        const Array& x, bool allowExtrapolation) const {
+        return evaluate(x, 0, 0, allowExtrapolation);
+    }
+
+    Real MultiChebyshevInterpolation::derivative(
+        const Array& x, Size i, bool allowExtrapolation) const {
+        return evaluate(x, i, 1, allowExtrapolation);
+    }
+
+    Real MultiChebyshevInterpolation::secondDerivative(
+        const Array& x, Size i, bool allowExtrapolation) const {
+        return evaluate(x, i, 2, allowExtrapolation);
+    }
+
+}
@@ -0,0 +1,94 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file multichebyshevinterpolation.hpp
+    \brief tensor-product Chebyshev interpolation on a box
+*/
+
+#ifndef quantlib_multi_chebyshev_interpolation_hpp
+#define quantlib_multi_chebyshev_interpolation_hpp
+
+#include <ql/functional.hpp>
+#include <ql/math/array.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! tensor-product Chebyshev interpolation on a box
+    /*! The function is sampled on the tensor grid of Chebyshev points
+        of the second kind, i.e., the extrema of the Chebyshev
+        polynomials including the interval ends, mapped to
+        [lower_i, upper_i] in each dimension.  The samples are
+        transformed once into the coefficients of the Chebyshev
+        series; values, first and second partial derivatives are then
+        evaluated from the series in time proportional to the number
+        of grid points.
+
+        Grid points and sample values are ordered with the last
+        dimension running fastest, and the points of each dimension
+        decreasing from upper_i to lower_i.
+
+        References:
+        L.N. Trefethen, Approximation Theory and Approximation
+        Practice, SIAM, 2013.
+    */
+    class MultiChebyshevInterpolation {
+      public:
+        //! interpolation of the given samples on gridPoints()
+        MultiChebyshevInterpolation(std::vector<Real> lower,
+                                    std::vector<Real> upper,
+                                    std::vector<Size> nodes,
+                                    const std::vector<Real>& values);
+        //! interpolation of f, sampled on gridPoints()
+        MultiChebyshevInterpolation(std::vector<Real> lower,
+                                    std::vector<Real> upper,
+                                    std::vector<Size> nodes,
+                                    const ext::function<Real(const Array&)>& f);
+
+        static std::vector<Array> gridPoints(const std::vector<Real>& lower,
+                                             const std::vector<Real>& upper,
+                                             const std::vector<Size>& nodes);
+
+        Size dimension() const { return nodes_.size(); }
+        const std::vector<Real>& lower() const { return lower_; }
+        const std::vector<Real>& upper() const { return upper_; }
+        const std::vector<Size>& nodes() const { return nodes_; }
+        //! coefficients of the Chebyshev series, ordered as the samples
+        const std::vector<Real>& coefficients() const { return coefficients_; }
+
+        Real operator()(const Array& x, bool allowExtrapolation = false) const;
+        //! first partial derivative with respect to x_i
+        Real derivative(const Array& x, Size i,
+                        bool allowExtrapolation = false) const;
+        //! second partial derivative with respect to x_i
+        Real secondDerivative(const Array& x, Size i,
+                              bool allowExtrapolation = false) const;
+
+      private:
+        void checkDimensions() const;
+        void calculateCoefficients(const std::vector<Real>& values);
+        Real evaluate(const Array& x, Size i, Size order,
+                      bool allowExtrapolation) const;
+
+        std::vector<Real> lower_, upper_;
+        std::vector<Size> nodes_;
+        std::vector<Real> coefficients_;
+    };
+
+}
+
+#endif
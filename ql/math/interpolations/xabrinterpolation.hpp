@@ -43,12 +43,25 @@
 #include <ql/termstructures/volatility/volatilitytype.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/utilities/null.hpp>
+#include <type_traits>
 #include <utility>
 
 namespace QuantLib {
 
 namespace detail {
 
+/* Model specifications providing directDerivative(), together with a
+   model type whose volatility() can also return the gradient with
+   respect to the model parameters, are calibrated using the analytic
+   Jacobian of the interpolation errors.
+*/
+template <typename Model, typename = void>
+struct XABRHasAnalyticJacobian : std::false_type {};
+
+template <typename Model>
+struct XABRHasAnalyticJacobian<Model, decltype(void(&Model::directDerivative))>
+    : std::true_type {};
+
 template <typename Model> class XABRCoeffHolder {
   public:
     XABRCoeffHolder(const Time t,
@@ -125,7 +138,8 @@ class XABRInterpolationImpl : public Interpolation::templateImpl<I1, I2>,
         // if no optimization method or endCriteria is provided, we provide one
         if (!optMethod_)
             optMethod_ = ext::shared_ptr<OptimizationMethod>(
-                new LevenbergMarquardt(1e-8, 1e-8, 1e-8));
+                new LevenbergMarquardt(1e-8, 1e-8, 1e-8,
+                                       XABRHasAnalyticJacobian<Model>::value));
         // optMethod_ = ext::shared_ptr<OptimizationMethod>(new
         //    Simplex(0.01));
         if (!endCriteria_) {
@@ -310,7 +324,35 @@ class XABRInterpolationImpl : public Interpolation::templateImpl<I1, I2>,
             return xabr_->interpolationErrors();
         }
 
+        void jacobian(Matrix& jac, const Array& x) const override {
+            jacobianImpl(jac, x, XABRHasAnalyticJacobian<Model>());
+        }
+
       private:
+        void jacobianImpl(Matrix& jac, const Array& x, std::false_type) const {
+            CostFunction::jacobian(jac, x);
+        }
+
+        void jacobianImpl(Matrix& jac, const Array& x, std::true_type) const {
+            const Array y = Model().direct(x, xabr_->paramIsFixed_,
+                                           xabr_->params_, xabr_->forward_);
+            const Array dy = Model().directDerivative(x, xabr_->paramIsFixed_,
+                                                      xabr_->params_, xabr_->forward_);
+            for (Size i = 0; i < xabr_->params_.size(); ++i)
+                xabr_->params_[i] = y[i];
+            xabr_->updateModelInstance();
+
+            Array gradient;
+            I1 k = xabr_->xBegin_;
+            auto w = xabr_->weights_.begin();
+            for (Size i = 0; k != xabr_->xEnd_; ++k, ++w, ++i) {
+                xabr_->modelInstance_->volatility(*k, xabr_->volatilityType_, gradient);
+                const Real sqrtW = std::sqrt(*w);
+                for (Size j = 0; j < x.size(); ++j)
+                    jac[i][j] = sqrtW * gradient[j] * dy[j];
+            }
+        }
+
         XABRInterpolationImpl *xabr_;
     };
     ext::shared_ptr<EndCriteria> endCriteria_;
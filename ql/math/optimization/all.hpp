@@ -21,6 +21,7 @@
 #include <ql/math/optimization/projection.hpp>
 #include <ql/math/optimization/simplex.hpp>
 #include <ql/math/optimization/simulatedannealing.hpp>
+#include <ql/math/optimization/sparselevenbergmarquardt.hpp>
 #include <ql/math/optimization/spherecylinder.hpp>
 #include <ql/math/optimization/steepestdescent.hpp>
 
@@ -94,6 +94,13 @@ namespace QuantLib {
 
         //! Default epsilon for finite difference method :
         virtual Real finiteDifferenceEpsilon() const { return 1e-8; }
+
+        //! whether value() can be called concurrently
+        /*! Cost functions returning true allow optimizers to
+            evaluate several trial points in parallel when OpenMP is
+            enabled; see Problem::value(const std::vector<Array>&).
+        */
+        virtual bool isThreadSafe() const { return false; }
     };
 
     class ParametersTransformation {
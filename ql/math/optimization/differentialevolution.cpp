@@ -74,8 +74,11 @@ namespace QuantLib {
                 population[i].values = configuration().initialPopulation[i];
                 QL_REQUIRE(population[i].values.size() == p.currentValue().size(),
                            "wrong values size in initial population");
-                population[i].cost = p.costFunction().value(population[i].values);
             }
+            const std::vector<Real> costs =
+                p.costFunctionValues(configuration().initialPopulation);
+            for (Size i = 0; i < population.size(); ++i)
+                population[i].cost = costs[i];
         } else {
             population = std::vector<Candidate>(configuration().populationMembers,
                                                 Candidate(p.currentValue().size()));
@@ -293,15 +296,17 @@ namespace QuantLib {
                                - lowerBound_[memIter]);
                 }
             }
-            // evaluate objective function as soon as possible to avoid unnecessary loops
-            try {
-                population[popIter].cost = p.value(population[popIter].values);
-            } catch (Error&) {
-                population[popIter].cost = QL_MAX_REAL;
-            }
+        }
+
+        // the trial members are evaluated together, possibly in parallel
+        std::vector<Array> trials(population.size());
+        for (Size popIter = 0; popIter < population.size(); popIter++)
+            trials[popIter] = population[popIter].values;
+        const std::vector<Real> costs = p.value(trials, QL_MAX_REAL);
+        for (Size popIter = 0; popIter < population.size(); popIter++) {
+            population[popIter].cost = costs[popIter];
             if (!std::isfinite(population[popIter].cost))
                 population[popIter].cost = QL_MAX_REAL;
-
         }
     }
 
@@ -381,14 +386,21 @@ namespace QuantLib {
 
         // use initial values provided by the user
         population.front().values = p.currentValue();
-        population.front().cost = p.costFunction().value(population.front().values);
         // rest of the initial population is random
         for (Size j = 1; j < population.size(); ++j) {
             for (Size i = 0; i < p.currentValue().size(); ++i) {
                 Real l = lowerBound_[i], u = upperBound_[i];
                 population[j].values[i] = l + (u-l)*rng_.nextReal();
             }
-            population[j].cost = p.costFunction().value(population[j].values);
+        }
+
+        std::vector<Array> members(population.size());
+        for (Size j = 0; j < population.size(); ++j)
+            members[j] = population[j].values;
+        const std::vector<Real> costs = p.costFunctionValues(members);
+        population.front().cost = costs.front();
+        for (Size j = 1; j < population.size(); ++j) {
+            population[j].cost = costs[j];
             if (!std::isfinite(population[j].cost))
                 population[j].cost = QL_MAX_REAL;
         }
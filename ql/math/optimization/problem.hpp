@@ -29,7 +29,10 @@
 #include <ql/math/optimization/constraint.hpp>
 #include <ql/math/optimization/costfunction.hpp>
 #include <ql/math/optimization/method.hpp>
+#include <ql/utilities/null.hpp>
+#include <exception>
 #include <utility>
+#include <vector>
 
 namespace QuantLib {
 
@@ -58,6 +61,23 @@ namespace QuantLib {
         //! call cost values computation and increment evaluation counter
         Array values(const Array& x);
 
+        //! call cost function computation at several points
+        /*! The points are evaluated in parallel if OpenMP is enabled
+            and the cost function is thread-safe; the results don't
+            depend on this.  All points are evaluated before errors
+            are reported: the error of the first failing point is
+            rethrown, unless \c failedValue is given, in which case
+            it replaces the values of points whose evaluation raised
+            a QuantLib error.
+        */
+        std::vector<Real> value(const std::vector<Array>& x,
+                                Real failedValue = Null<Real>());
+
+        //! same as above, without incrementing the evaluation counter
+        std::vector<Real> costFunctionValues(
+            const std::vector<Array>& x,
+            Real failedValue = Null<Real>()) const;
+
         //! call cost function gradient computation and increment
         //  evaluation counter
         void gradient(Array& grad_f,
@@ -109,7 +129,7 @@ namespace QuantLib {
         //! function and gradient norm values at the currentValue_ (i.e. the last step)
         Real functionValue_, squaredNorm_;
         //! number of evaluation of cost function and its gradient
-        Integer functionEvaluation_, gradientEvaluation_;
+        Integer functionEvaluation_ = 0, gradientEvaluation_ = 0;
     };
 
     // inline definitions
@@ -123,6 +143,41 @@ namespace QuantLib {
         return costFunction_.values(x);
     }
 
+    inline std::vector<Real> Problem::value(const std::vector<Array>& x,
+                                            Real failedValue) {
+        functionEvaluation_ += static_cast<Integer>(x.size());
+        return costFunctionValues(x, failedValue);
+    }
+
+    inline std::vector<Real> Problem::costFunctionValues(
+                                            const std::vector<Array>& x,
+                                            Real failedValue) const {
+        std::vector<Real> values(x.size());
+        std::vector<std::exception_ptr> errors(x.size());
+
+        #pragma omp parallel for if(x.size() > 1 && costFunction_.isThreadSafe())
+        for (long i=0; i<(long)x.size(); ++i) {
+            try {
+                values[i] = costFunction_.value(x[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+
+        for (Size i=0; i<x.size(); ++i) {
+            if (errors[i]) {
+                if (failedValue == Null<Real>())
+                    std::rethrow_exception(errors[i]);
+                try {
+                    std::rethrow_exception(errors[i]);
+                } catch (Error&) {
+                    values[i] = failedValue;
+                }
+            }
+        }
+        return values;
+    }
+
     inline void Problem::gradient(Array& grad_f,
                                   const Array& x) {
         ++gradientEvaluation_;
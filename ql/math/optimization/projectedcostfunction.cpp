@@ -44,4 +44,18 @@ namespace QuantLib {
         return costFunction_.values(actualParameters_);
     }
 
+    void ProjectedCostFunction::jacobian(Matrix& jac,
+                                         const Array& freeParameters) const {
+        mapFreeParameters(freeParameters);
+        Matrix fullJacobian(jac.rows(), actualParameters_.size());
+        costFunction_.jacobian(fullJacobian, actualParameters_);
+        for (Size i = 0, k = 0; i < fixParameters_.size(); ++i) {
+            if (!fixParameters_[i]) {
+                for (Size j = 0; j < jac.rows(); ++j)
+                    jac[j][k] = fullJacobian[j][i];
+                ++k;
+            }
+        }
+    }
+
 }
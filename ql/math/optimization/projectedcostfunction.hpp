@@ -49,6 +49,7 @@ namespace QuantLib {
             //@{
             Real value(const Array& freeParameters) const override;
             Array values(const Array& freeParameters) const override;
+            void jacobian(Matrix& jac, const Array& freeParameters) const override;
             //@}
 
         private:
@@ -157,16 +157,21 @@ namespace QuantLib {
             direction[i_] = 1.0;
             P.constraint().update(vertices_[i_ + 1], direction, lambda_);
         }
-        values_ = Array(n_ + 1, 0.0);
+        values_ = Array(n_ + 1, QL_MAX_REAL);
+        std::vector<Array> feasible;
+        std::vector<Size> feasibleIndices;
         for (i_ = 0; i_ <= n_; i_++) {
-            if (!P.constraint().test(vertices_[i_]))
-                values_[i_] = QL_MAX_REAL;
-            else
-                values_[i_] = P.value(vertices_[i_]);
-            if (std::isnan(ytry_)) { // handle NAN
-                values_[i_] = QL_MAX_REAL;
+            if (P.constraint().test(vertices_[i_])) {
+                feasible.push_back(vertices_[i_]);
+                feasibleIndices.push_back(i_);
             }
         }
+        std::vector<Real> feasibleValues = P.value(feasible);
+        for (Size k = 0; k < feasibleIndices.size(); k++) {
+            // handle NAN
+            if (!std::isnan(feasibleValues[k]))
+                values_[feasibleIndices[k]] = feasibleValues[k];
+        }
 
         // minimize
 
@@ -233,6 +238,7 @@ namespace QuantLib {
                         ysave_ = yhi_;
                         amotsa(P, 0.5);
                         if (ytry_ >= ysave_) {
+                            std::vector<Array> shrunk;
                             for (i_ = 0; i_ < n_ + 1; i_++) {
                                 if (i_ != ilo_) {
                                     for (j_ = 0; j_ < n_; j_++) {
@@ -240,9 +246,14 @@ namespace QuantLib {
                                                           vertices_[ilo_][j_]);
                                         vertices_[i_][j_] = sum_[j_];
                                     }
-                                    values_[i_] = P.value(sum_);
+                                    shrunk.push_back(vertices_[i_]);
                                 }
                             }
+                            std::vector<Real> shrunkValues = P.value(shrunk);
+                            for (i_ = 0, j_ = 0; i_ < n_ + 1; i_++) {
+                                if (i_ != ilo_)
+                                    values_[i_] = shrunkValues[j_++];
+                            }
                             iteration_ += n_;
                             for (i_ = 0; i_ < n_; i_++)
                                 sum_[i_] = 0.0;
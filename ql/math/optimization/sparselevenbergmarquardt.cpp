@@ -0,0 +1,354 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/math/matrixutilities/qrdecomposition.hpp>
+#include <ql/math/optimization/constraint.hpp>
+#include <ql/math/optimization/sparselevenbergmarquardt.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace QuantLib {
+
+    void SparseCostFunction::sparseJacobian(SparseMatrix& jac,
+                                            const Array& x) const {
+        std::vector<std::vector<Size> > pattern = sparsityPattern(x);
+        Matrix dense(jac.size1(), jac.size2());
+        jacobian(dense, x);
+        for (Size i=0; i<pattern.size(); ++i)
+            for (Size j : pattern[i])
+                jac(i, j) = dense[i][j];
+    }
+
+    namespace {
+
+        Real norm2(const Array& a) {
+            return std::sqrt(DotProduct(a, a));
+        }
+
+        Array scaled(const Array& d, const Array& x) {
+            Array result(x.size());
+            for (Size j=0; j<x.size(); ++j)
+                result[j] = d[j] * x[j];
+            return result;
+        }
+
+        // groups of parameters such that no value depends on more than
+        // one parameter of the same group (greedy colouring)
+        std::vector<std::vector<Size> > parameterGroups(
+                           const std::vector<std::vector<Size> >& pattern,
+                           Size n) {
+            std::vector<std::vector<Size> > rows(n);
+            for (Size i=0; i<pattern.size(); ++i)
+                for (Size j : pattern[i])
+                    rows[j].push_back(i);
+            std::vector<std::vector<Size> > groups;
+            std::vector<std::vector<bool> > used;
+            for (Size j=0; j<n; ++j) {
+                Size g = 0;
+                for (; g<groups.size(); ++g) {
+                    bool free = true;
+                    for (Size i : rows[j]) {
+                        if (used[g][i]) {
+                            free = false;
+                            break;
+                        }
+                    }
+                    if (free)
+                        break;
+                }
+                if (g == groups.size()) {
+                    groups.emplace_back();
+                    used.emplace_back(pattern.size(), false);
+                }
+                groups[g].push_back(j);
+                for (Size i : rows[j])
+                    used[g][i] = true;
+            }
+            return groups;
+        }
+
+    }
+
+    SparseLevenbergMarquardt::SparseLevenbergMarquardt(
+                                               Real epsfcn,
+                                               bool useCostFunctionsJacobian,
+                                               Size maxBroydenUpdates,
+                                               bool geodesicAcceleration)
+    : epsfcn_(epsfcn), useCostFunctionsJacobian_(useCostFunctionsJacobian),
+      maxBroydenUpdates_(maxBroydenUpdates),
+      geodesicAcceleration_(geodesicAcceleration) {}
+
+    Array SparseLevenbergMarquardt::values(Problem& P, const Array& x) {
+        ++functionEvaluations_;
+        return P.values(x);
+    }
+
+    void SparseLevenbergMarquardt::jacobian(
+                           Problem& P,
+                           const Array& x,
+                           const Array& fx,
+                           const std::vector<std::vector<Size> >& pattern,
+                           const std::vector<std::vector<Size> >& groups,
+                           Matrix& jac) {
+        ++jacobianEvaluations_;
+        const Size m = fx.size(), n = x.size();
+        jac = Matrix(m, n, 0.0);
+
+        if (useCostFunctionsJacobian_) {
+            const auto* sparse =
+                dynamic_cast<const SparseCostFunction*>(&P.costFunction());
+            if (sparse != nullptr) {
+                SparseMatrix tmp(m, n);
+                sparse->sparseJacobian(tmp, x);
+                for (Size i=0; i<m; ++i)
+                    for (Size j : pattern[i])
+                        jac[i][j] = tmp(i, j);
+            } else {
+                P.costFunction().jacobian(jac, x);
+            }
+            return;
+        }
+
+        // forward differences, as in MINPACK's fdjac2
+        const Real eps = std::sqrt(std::max(epsfcn_, QL_EPSILON));
+        std::vector<std::vector<Size> > rows(n);
+        for (Size i=0; i<m; ++i)
+            for (Size j : pattern[i])
+                rows[j].push_back(i);
+        for (const auto& group : groups) {
+            Array xh = x;
+            Array h(n, 0.0);
+            for (Size j : group) {
+                h[j] = eps * std::fabs(x[j]);
+                if (h[j] == 0.0)
+                    h[j] = eps;
+                xh[j] += h[j];
+            }
+            // step backwards when leaving the feasible region
+            if (!P.constraint().test(xh)) {
+                for (Size j : group) {
+                    h[j] = -h[j];
+                    xh[j] = x[j] + h[j];
+                }
+            }
+            Array fh = values(P, xh);
+            for (Size j : group)
+                for (Size i : rows[j])
+                    jac[i][j] = (fh[i] - fx[i]) / h[j];
+        }
+    }
+
+    EndCriteria::Type SparseLevenbergMarquardt::minimize(
+                                             Problem& P,
+                                             const EndCriteria& endCriteria) {
+        iterations_ = functionEvaluations_ = jacobianEvaluations_ = 0;
+        broydenUpdates_ = acceleratedSteps_ = 0;
+
+        EndCriteria::Type ecType = EndCriteria::None;
+        P.reset();
+        Array x = P.currentValue();
+        const Size n = x.size();
+        Array fx = values(P, x);
+        const Size m = fx.size();
+
+        QL_REQUIRE(n > 0, "no variables given");
+        QL_REQUIRE(m >= n,
+                   "less functions (" << m <<
+                   ") than available variables (" << n << ")");
+        QL_REQUIRE(endCriteria.functionEpsilon() >= 0.0,
+                   "negative f tolerance");
+        QL_REQUIRE(endCriteria.rootEpsilon() >= 0.0,
+                   "negative x tolerance");
+        QL_REQUIRE(endCriteria.gradientNormEpsilon() >= 0.0,
+                   "negative g tolerance");
+        QL_REQUIRE(endCriteria.maxIterations() > 0,
+                   "null number of evaluations");
+        QL_REQUIRE(P.constraint().test(x),
+                   "starting point is not feasible");
+
+        std::vector<std::vector<Size> > pattern;
+        const auto* sparse =
+            dynamic_cast<const SparseCostFunction*>(&P.costFunction());
+        if (sparse != nullptr) {
+            pattern = sparse->sparsityPattern(x);
+            QL_REQUIRE(pattern.size() == m,
+                       "sparsity pattern size (" << pattern.size()
+                       << ") does not match the number of values ("
+                       << m << ")");
+            for (const auto& row : pattern)
+                for (Size j : row)
+                    QL_REQUIRE(j < n, "parameter index (" << j
+                               << ") in sparsity pattern out of range ("
+                               << n << ")");
+        } else {
+            std::vector<Size> all(n);
+            for (Size j=0; j<n; ++j)
+                all[j] = j;
+            pattern.assign(m, all);
+        }
+        const std::vector<std::vector<Size> > groups =
+            parameterGroups(pattern, n);
+
+        Matrix jac;
+        jacobian(P, x, fx, pattern, groups, jac);
+        Size updates = 0;
+
+        // scaling of the parameters by the largest column norms seen
+        // so far (MINPACK's mode 1)
+        Array d(n, 0.0);
+        auto updateScaling = [&]() {
+            for (Size j=0; j<n; ++j) {
+                Real s = 0.0;
+                for (Size i=0; i<m; ++i)
+                    s += jac[i][j] * jac[i][j];
+                d[j] = std::max(d[j], std::sqrt(s));
+            }
+        };
+        updateScaling();
+
+        Real fnorm = norm2(fx);
+        Real lambda = 1.0e-3, nu = 2.0;
+        const Real h = 0.1, alpha = 0.75;
+        Real xtol = endCriteria.rootEpsilon(),
+             ftol = endCriteria.functionEpsilon(),
+             gtol = endCriteria.gradientNormEpsilon();
+
+        while (true) {
+            if (fnorm == 0.0) {
+                ecType = EndCriteria::StationaryFunctionValue;
+                break;
+            }
+
+            Array dd(n);
+            for (Size j=0; j<n; ++j)
+                dd[j] = d[j] > 0.0 ? d[j] : 1.0;
+
+            // scaled gradient test, only on exact jacobians
+            if (updates == 0) {
+                Real gnorm = 0.0;
+                for (Size j=0; j<n; ++j) {
+                    Real g = 0.0;
+                    for (Size i=0; i<m; ++i)
+                        g += jac[i][j] * fx[i];
+                    gnorm = std::max(gnorm, std::fabs(g) / (dd[j] * fnorm));
+                }
+                if (gnorm <= gtol) {
+                    ecType = EndCriteria::ZeroGradientNorm;
+                    break;
+                }
+            }
+
+            if (endCriteria.checkMaxIterations(iterations_, ecType))
+                break;
+            ++iterations_;
+
+            const Array damping = std::sqrt(lambda) * dd;
+            Array step = qrSolve(jac, -1.0 * fx, true, damping);
+            bool accelerated = false;
+
+            if (geodesicAcceleration_) {
+                Array xv = x + h * step;
+                if (P.constraint().test(xv)) {
+                    Array fv = values(P, xv);
+                    Array rvv = (2.0 / h) * ((fv - fx) / h - jac * step);
+                    Array a = qrSolve(jac, -1.0 * rvv, true, damping);
+                    if (2.0 * norm2(scaled(dd, a)) <=
+                        alpha * norm2(scaled(dd, step))) {
+                        step += 0.5 * a;
+                        accelerated = true;
+                    }
+                }
+            }
+
+            Real xnorm = norm2(scaled(dd, x));
+            Real pnorm = norm2(scaled(dd, step));
+            if (pnorm <= xtol * xnorm) {
+                ecType = EndCriteria::StationaryPoint;
+                break;
+            }
+
+            Array xn = x + step;
+            Array fn;
+            Real fnnorm = QL_MAX_REAL;
+            if (P.constraint().test(xn)) {
+                fn = values(P, xn);
+                fnnorm = norm2(fn);
+            }
+            Real predicted = fnorm * fnorm - norm2(fx + jac * step) *
+                                             norm2(fx + jac * step);
+            Real actual = fnorm * fnorm - fnnorm * fnnorm;
+            Real rho = predicted > 0.0 && fnnorm < QL_MAX_REAL
+                           ? actual / predicted
+                           : -1.0;
+
+            if (rho > 1.0e-4) {
+                if (accelerated)
+                    ++acceleratedSteps_;
+                bool stationary =
+                    actual <= ftol * fnorm * fnorm &&
+                    predicted <= ftol * fnorm * fnorm;
+                Array y = fn - fx;
+                x = xn;
+                fx = fn;
+                fnorm = fnnorm;
+                lambda *= std::max(1.0 / 3.0,
+                                   1.0 - std::pow(2.0 * rho - 1.0, 3));
+                nu = 2.0;
+                if (stationary && updates == 0) {
+                    ecType = EndCriteria::StationaryFunctionValue;
+                    break;
+                }
+                if (!stationary && updates < maxBroydenUpdates_) {
+                    // Schubert's update, i.e. Broyden's update applied
+                    // row by row on the sparsity pattern
+                    for (Size i=0; i<m; ++i) {
+                        Real ss = 0.0, js = 0.0;
+                        for (Size j : pattern[i]) {
+                            ss += step[j] * step[j];
+                            js += jac[i][j] * step[j];
+                        }
+                        if (ss > 0.0) {
+                            Real c = (y[i] - js) / ss;
+                            for (Size j : pattern[i])
+                                jac[i][j] += c * step[j];
+                        }
+                    }
+                    ++updates;
+                    ++broydenUpdates_;
+                } else {
+                    jacobian(P, x, fx, pattern, groups, jac);
+                    updates = 0;
+                }
+                updateScaling();
+            } else if (updates > 0) {
+                // the approximate jacobian might be the culprit
+                jacobian(P, x, fx, pattern, groups, jac);
+                updates = 0;
+                updateScaling();
+            } else {
+                lambda *= nu;
+                nu *= 2.0;
+            }
+        }
+
+        P.setCurrentValue(x);
+        P.setFunctionValue(P.costFunction().value(x));
+
+        return ecType;
+    }
+
+}
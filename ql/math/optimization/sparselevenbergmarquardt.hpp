@@ -0,0 +1,122 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file sparselevenbergmarquardt.hpp
+    \brief Levenberg-Marquardt method for sparse least-squares problems
+*/
+
+#ifndef quantlib_optimization_sparse_levenberg_marquardt_hpp
+#define quantlib_optimization_sparse_levenberg_marquardt_hpp
+
+#include <ql/math/matrixutilities/sparsematrix.hpp>
+#include <ql/math/optimization/problem.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Cost function with a sparse jacobian
+    /*! The sparsity pattern lists, for each of the values, the
+        (increasing) indices of the parameters it depends on.  It is
+        used by SparseLevenbergMarquardt to estimate the jacobian by
+        forward differences on groups of parameters not sharing any
+        value, which takes one function evaluation per group instead
+        of one per parameter, and to restrict Broyden updates to the
+        non-zero elements of the jacobian.
+    */
+    class SparseCostFunction : public CostFunction {
+      public:
+        //! parameters each of the values depends on
+        virtual std::vector<std::vector<Size> >
+        sparsityPattern(const Array& x) const = 0;
+        //! jacobian of the values
+        /*! Only the elements in the sparsity pattern are used.  The
+            default implementation copies them from the dense
+            jacobian.
+        */
+        virtual void sparseJacobian(SparseMatrix& jac, const Array& x) const;
+    };
+
+    //! Levenberg-Marquardt method for sparse least-squares problems
+    /*! This implementation of the Levenberg-Marquardt method is
+        meant for problems whose values are expensive to compute,
+        e.g. curve fits. Compared to LevenbergMarquardt it
+
+        - takes sparse jacobians from a SparseCostFunction, and
+          estimates jacobians with a known sparsity pattern by
+          forward differences on groups of parameters;
+        - optionally replaces up to a given number of consecutive
+          jacobian evaluations by (Schubert's sparse) Broyden rank-one
+          updates along the accepted steps. A full jacobian is
+          computed again whenever an updated one fails to produce an
+          acceptable step, or before stopping on a stationary
+          function value;
+        - optionally applies the geodesic acceleration of Transtrum
+          and Sethna, which adds a second order correction estimated
+          with one additional function evaluation per step.
+
+        If useCostFunctionsJacobian is true, the (sparse) jacobian of
+        the cost function is used instead of the finite difference
+        estimate.  Function evaluations, including those for finite
+        differences, are counted in the problem; more detailed
+        statistics of the last minimization are available from the
+        optimizer.
+
+        The end criteria are interpreted as in MINPACK: the root
+        epsilon bounds the relative step size, the function epsilon
+        the relative reduction of the sum of squares and the gradient
+        norm epsilon the cosine of the angle between the values and
+        the columns of the jacobian.
+
+        \ingroup optimizers
+    */
+    class SparseLevenbergMarquardt : public OptimizationMethod {
+      public:
+        explicit SparseLevenbergMarquardt(Real epsfcn = 1.0e-8,
+                                          bool useCostFunctionsJacobian = false,
+                                          Size maxBroydenUpdates = 0,
+                                          bool geodesicAcceleration = false);
+        EndCriteria::Type minimize(Problem& P,
+                                   const EndCriteria& endCriteria) override;
+
+        //! \name Statistics of the last minimization
+        //@{
+        Size iterations() const { return iterations_; }
+        Size functionEvaluations() const { return functionEvaluations_; }
+        Size jacobianEvaluations() const { return jacobianEvaluations_; }
+        Size broydenUpdates() const { return broydenUpdates_; }
+        Size acceleratedSteps() const { return acceleratedSteps_; }
+        //@}
+      private:
+        void jacobian(Problem& P,
+                      const Array& x,
+                      const Array& values,
+                      const std::vector<std::vector<Size> >& pattern,
+                      const std::vector<std::vector<Size> >& groups,
+                      Matrix& jac);
+        Array values(Problem& P, const Array& x);
+        Real epsfcn_;
+        bool useCostFunctionsJacobian_;
+        Size maxBroydenUpdates_;
+        bool geodesicAcceleration_;
+        Size iterations_ = 0, functionEvaluations_ = 0, jacobianEvaluations_ = 0,
+             broydenUpdates_ = 0, acceleratedSteps_ = 0;
+    };
+
+}
+
+
+#endif
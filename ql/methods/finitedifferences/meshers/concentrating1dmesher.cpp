@@ -209,8 +209,10 @@ namespace QuantLib {
         }
         LinearInterpolation transform(u.begin(), u.end(), z.begin());
 
+        // both interpolations are evaluated at increasing abscissae
+        Size transformHint = 0, odeHint = 0;
         for (Size i=0; i < size; ++i) {
-            locations_[i] = odeSolution(transform(i*dx));
+            locations_[i] = odeSolution(transform(i*dx, transformHint), odeHint);
         }
 
         for (Size i=0; i < size-1; ++i) {
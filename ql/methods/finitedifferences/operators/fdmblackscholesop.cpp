@@ -25,6 +25,7 @@
 #include <ql/methods/finitedifferences/operators/fdmblackscholesop.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/operators/secondderivativeop.hpp>
+#include <ql/termstructures/volatility/equityfx/interpolatedlocalvolsurface.hpp>
 #include <utility>
 
 namespace QuantLib {
@@ -42,11 +43,23 @@ namespace QuantLib {
       volTS_(bsProcess->blackVolatility().currentLink()),
       localVol_((localVol) ? bsProcess->localVolatility().currentLink() :
                              ext::shared_ptr<LocalVolTermStructure>()),
+      gridLocalVol_(ext::dynamic_pointer_cast<InterpolatedLocalVolSurface>(localVol_)),
       x_((localVol) ? Array(Exp(mesher->locations(direction))) : Array()),
+      logX_((gridLocalVol_ != nullptr) ? mesher->locations(direction) : Array()),
       dxMap_(FirstDerivativeOp(direction, mesher)), dxxMap_(SecondDerivativeOp(direction, mesher)),
       mapT_(direction, mesher), strike_(strike),
       illegalLocalVolOverwrite_(illegalLocalVolOverwrite), direction_(direction),
-      quantoHelper_(std::move(quantoHelper)) {}
+      quantoHelper_(std::move(quantoHelper)) {
+        // a pre-sampled surface replaces illegal values when its grid
+        // is sampled, so that the operator cannot overwrite them anymore
+        QL_REQUIRE(gridLocalVol_ == nullptr || illegalLocalVolOverwrite_ < 0.0
+                   || illegalLocalVolOverwrite_
+                          == gridLocalVol_->illegalLocalVolOverwrite(),
+                   "illegal local vol overwrite (" << illegalLocalVolOverwrite_
+                   << ") differs from the one of the interpolated local vol "
+                      "surface (" << gridLocalVol_->illegalLocalVolOverwrite()
+                   << ")");
+    }
 
     void FdmBlackScholesOp::setTime(Time t1, Time t2) {
         const Rate r = rTS_->forwardRate(t1, t2, Continuous).rate();
@@ -57,18 +70,25 @@ namespace QuantLib {
             const FdmLinearOpIterator endIter = layout->end();
 
             Array v(layout->size());
-            for (FdmLinearOpIterator iter = layout->begin();
-                 iter!=endIter; ++iter) {
-                const Size i = iter.index();
+            if (gridLocalVol_ != nullptr) {
+                // illegal values are overwritten when the surface is sampled
+                v = gridLocalVol_->localVolatilities(0.5*(t1+t2), logX_);
+                v *= v;
+            }
+            else {
+                for (FdmLinearOpIterator iter = layout->begin();
+                     iter!=endIter; ++iter) {
+                    const Size i = iter.index();
 
-                if (illegalLocalVolOverwrite_ < 0.0) {
-                    v[i] = squared(localVol_->localVol(0.5*(t1+t2), x_[i], true));
-                }
-                else {
-                    try {
+                    if (illegalLocalVolOverwrite_ < 0.0) {
                         v[i] = squared(localVol_->localVol(0.5*(t1+t2), x_[i], true));
-                    } catch (Error&) {
-                        v[i] = squared(illegalLocalVolOverwrite_);
+                    }
+                    else {
+                        try {
+                            v[i] = squared(localVol_->localVol(0.5*(t1+t2), x_[i], true));
+                        } catch (Error&) {
+                            v[i] = squared(illegalLocalVolOverwrite_);
+                        }
                     }
                 }
             }
@@ -35,6 +35,12 @@
 
 namespace QuantLib {
 
+    class InterpolatedLocalVolSurface;
+
+    /*! When the local volatility is an InterpolatedLocalVolSurface,
+        illegal values are overwritten by the surface itself; a given
+        illegalLocalVolOverwrite must then match the one of the surface.
+    */
     class FdmBlackScholesOp : public FdmLinearOpComposite {
       public:
         FdmBlackScholesOp(
@@ -62,7 +68,8 @@ namespace QuantLib {
         const ext::shared_ptr<YieldTermStructure> rTS_, qTS_;
         const ext::shared_ptr<BlackVolTermStructure> volTS_;
         const ext::shared_ptr<LocalVolTermStructure> localVol_;
-        const Array x_;
+        const ext::shared_ptr<InterpolatedLocalVolSurface> gridLocalVol_;
+        const Array x_, logX_;
         const FirstDerivativeOp  dxMap_;
         const TripleBandLinearOp dxxMap_;
         TripleBandLinearOp mapT_;
@@ -75,8 +75,9 @@ namespace QuantLib {
 
             if (mesher_->layout()->dim().size() == 1) {
                 LinearInterpolation interp(x_.begin(), x_.end(), aCopy.begin());
+                Size hint = 0;
                 for (Size k=0; k<x_.size(); ++k) {
-                    a[k] = interp(std::max(x_[0], x_[k]-dividend), true);
+                    a[k] = interp(std::max(x_[0], x_[k]-dividend), hint, true);
                 }
             }
             else {
@@ -93,10 +94,12 @@ namespace QuantLib {
                             }
                             LinearInterpolation interp(x_.begin(), x_.end(),
                                                        tmp.begin());
+                            Size hint = 0;
                             for (Size k=0; k<x_.size(); ++k) {
                                 Size index = j*ySpacing + k*xSpacing;
                                 a[index] = interp(
-                                        std::max(x_[0], x_[k]-dividend), true);
+                                        std::max(x_[0], x_[k]-dividend),
+                                        hint, true);
                             }
                         }
                     }
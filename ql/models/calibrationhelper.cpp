@@ -84,4 +84,32 @@ namespace QuantLib {
         
         return error;
     }
+
+    Real BlackCalibrationHelper::calibrationErrorDerivative() {
+        switch (calibrationErrorType_) {
+          case RelativePriceError:
+            return (modelValue() >= marketValue() ? 1.0 : -1.0)/marketValue();
+          case PriceError:
+            return -1.0;
+          case ImpliedVolError:
+            {
+              Real minVol = volatilityType_ == ShiftedLognormal ? 0.0010 : 0.00005;
+              Real maxVol = volatilityType_ == ShiftedLognormal ? 10.0 : 0.50;
+              const Real modelPrice = modelValue();
+
+              // the implied volatility is floored and capped
+              if (modelPrice <= blackPrice(minVol) || modelPrice >= blackPrice(maxVol))
+                  return 0.0;
+
+              const Volatility implied = this->impliedVolatility(
+                                          modelPrice, 1e-12, 5000, minVol, maxVol);
+              const Volatility h = 1e-4*implied;
+              const Real vega =
+                  (blackPrice(implied+h) - blackPrice(implied-h))/(2.0*h);
+              return 1.0/vega;
+            }
+          default:
+            QL_FAIL("unknown Calibration Error Type");
+        }
+    }
 }
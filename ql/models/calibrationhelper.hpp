@@ -78,6 +78,9 @@ namespace QuantLib {
         //! returns the error resulting from the model valuation
         Real calibrationError() override;
 
+        //! derivative of the calibration error with respect to the model value
+        Real calibrationErrorDerivative();
+
         virtual void addTimesTo(std::list<Time>& times) const = 0;
 
         //! Black volatility implied by the model
@@ -93,6 +96,9 @@ namespace QuantLib {
         void setPricingEngine(const ext::shared_ptr<PricingEngine>& engine) {
             engine_ = engine;
         }
+        const ext::shared_ptr<PricingEngine>& pricingEngine() const {
+            return engine_;
+        }
 
       protected:
         mutable Real marketValue_;
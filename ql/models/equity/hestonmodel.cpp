@@ -18,6 +18,8 @@
 */
 
 #include <ql/models/equity/hestonmodel.hpp>
+#include <ql/models/equity/hestonmodelhelper.hpp>
+#include <ql/pricingengines/vanilla/analytichestonengine.hpp>
 #include <ql/quotes/simplequote.hpp>
 
 namespace QuantLib {
@@ -49,5 +51,36 @@ namespace QuantLib {
                                          sigma(), rho()));
     }
 
+    bool HestonModel::calibrationErrorJacobian(
+            const std::vector<ext::shared_ptr<CalibrationHelper> >& helpers,
+            Matrix& jacobian) const {
+        // derived models with further parameters, and the closed
+        // form used by the engine for vanishing sigma, are not covered
+        if (jacobian.columns() != 5 || sigma() <= 1e-4)
+            return false;
+
+        std::vector<ext::shared_ptr<HestonModelHelper> > hestonHelpers;
+        hestonHelpers.reserve(helpers.size());
+        for (const auto& helper : helpers) {
+            ext::shared_ptr<HestonModelHelper> hestonHelper =
+                ext::dynamic_pointer_cast<HestonModelHelper>(helper);
+            if (hestonHelper == nullptr
+                || ext::dynamic_pointer_cast<AnalyticHestonEngine>(
+                       hestonHelper->pricingEngine()) == nullptr)
+                return false;
+            hestonHelpers.push_back(hestonHelper);
+        }
+
+        for (Size i=0; i<hestonHelpers.size(); ++i) {
+            const Array sensitivities =
+                hestonHelpers[i]->modelValueSensitivities();
+            const Real derivative =
+                hestonHelpers[i]->calibrationErrorDerivative();
+            for (Size j=0; j<5; ++j)
+                jacobian[i][j] = derivative*sensitivities[j];
+        }
+        return true;
+    }
+
 }
 
@@ -60,6 +60,12 @@ namespace QuantLib {
         class FellerConstraint;
       protected:
         void generateArguments() override;
+        /*! Uses the analytic sensitivities of HestonModelHelpers
+            priced by an AnalyticHestonEngine on this model.
+        */
+        bool calibrationErrorJacobian(
+                const std::vector<ext::shared_ptr<CalibrationHelper> >&,
+                Matrix&) const override;
         ext::shared_ptr<HestonProcess> process_;
     };
 
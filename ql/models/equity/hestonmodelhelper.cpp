@@ -23,6 +23,7 @@
 #include <ql/instruments/payoffs.hpp>
 #include <ql/models/equity/hestonmodelhelper.hpp>
 #include <ql/pricingengines/blackformula.hpp>
+#include <ql/pricingengines/vanilla/analytichestonengine.hpp>
 #include <ql/processes/hestonprocess.hpp>
 #include <ql/quotes/simplequote.hpp>
 #include <utility>
@@ -83,6 +84,15 @@ namespace QuantLib {
         return option_->NPV();
     }
 
+    Array HestonModelHelper::modelValueSensitivities() const {
+        calculate();
+        ext::shared_ptr<AnalyticHestonEngine> engine =
+            ext::dynamic_pointer_cast<AnalyticHestonEngine>(engine_);
+        QL_REQUIRE(engine, "analytic Heston engine required");
+        return engine->priceSensitivities(
+            exerciseDate_, PlainVanillaPayoff(type_, strikePrice_));
+    }
+
     Real HestonModelHelper::blackPrice(Real volatility) const {
         calculate();
         const Real stdDev = volatility * std::sqrt(maturity());
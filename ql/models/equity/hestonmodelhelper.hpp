@@ -25,6 +25,7 @@
 #ifndef quantlib_heston_option_helper_hpp
 #define quantlib_heston_option_helper_hpp
 
+#include <ql/math/array.hpp>
 #include <ql/models/calibrationhelper.hpp>
 #include <ql/instruments/vanillaoption.hpp>
 
@@ -58,6 +59,11 @@ namespace QuantLib {
         Real modelValue() const override;
         Real blackPrice(Real volatility) const override;
         Time maturity() const  { calculate(); return tau_; }
+        //! model-value sensitivities to the Heston parameters
+        /*! In the order of HestonModel::params(); the pricing
+            engine must be an AnalyticHestonEngine.
+        */
+        Array modelValueSensitivities() const;
       private:
         const Period maturity_;
         const Calendar calendar_;
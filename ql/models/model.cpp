@@ -22,7 +22,10 @@
 #include <ql/math/optimization/projectedconstraint.hpp>
 #include <ql/math/optimization/projection.hpp>
 #include <ql/models/model.hpp>
+#include <ql/patterns/lazyobjectprofiler.hpp>
 #include <ql/utilities/null_deleter.hpp>
+#include <set>
+#include <string>
 #include <utility>
 
 using std::vector;
@@ -37,17 +40,19 @@ namespace QuantLib {
         CalibrationFunction(CalibratedModel* model,
                             const vector<ext::shared_ptr<CalibrationHelper> >& h,
                             vector<Real> weights,
-                            const Projection& projection)
+                            const Projection& projection,
+                            bool parallel = false)
         : model_(model, null_deleter()), instruments_(h), weights_(std::move(weights)),
-          projection_(projection) {}
+          projection_(projection), parallel_(parallel) {}
 
         ~CalibrationFunction() override = default;
 
         Real value(const Array& params) const override {
             model_->setParams(projection_.include(params));
+            Array errors = calibrationErrors();
             Real value = 0.0;
             for (Size i=0; i<instruments_.size(); i++) {
-                Real diff = instruments_[i]->calibrationError();
+                Real diff = errors[i];
                 value += diff*diff*weights_[i];
             }
             return std::sqrt(value);
@@ -55,21 +60,94 @@ namespace QuantLib {
 
         Array values(const Array& params) const override {
             model_->setParams(projection_.include(params));
-            Array values(instruments_.size());
+            Array values = calibrationErrors();
             for (Size i=0; i<instruments_.size(); i++) {
-                values[i] = instruments_[i]->calibrationError()
-                           *std::sqrt(weights_[i]);
+                values[i] *= std::sqrt(weights_[i]);
             }
             return values;
         }
 
+        void jacobian(Matrix& jac, const Array& params) const override {
+            const Array parameters = projection_.include(params);
+            model_->setParams(parameters);
+            Matrix derivatives(instruments_.size(), parameters.size());
+            if (!model_->calibrationErrorJacobian(instruments_, derivatives)) {
+                CostFunction::jacobian(jac, params);
+                return;
+            }
+            for (Size i=0; i<instruments_.size(); i++) {
+                const Array row = projection_.project(
+                    Array(derivatives.row_begin(i), derivatives.row_end(i)));
+                for (Size j=0; j<row.size(); j++)
+                    jac[i][j] = row[j]*std::sqrt(weights_[i]);
+            }
+        }
+
         Real finiteDifferenceEpsilon() const override { return 1e-6; }
 
       private:
+        Array calibrationErrors() const {
+            Size n = instruments_.size();
+            Array errors(n);
+
+            bool concurrent = false;
+            #ifdef _OPENMP
+            ObservableSettings& settings = ObservableSettings::instance();
+            // notifications can only be dropped safely if they are
+            // enabled; deferred or batched updates would be collected
+            // concurrently
+            concurrent = parallel_ && n > 1 &&
+                model_->supportsParallelCalibration() &&
+                settings.updatesEnabled() && !settings.updatesBatched();
+            #if defined(QL_ENABLE_PROFILING)
+            // the profiler is not thread-safe
+            if (LazyObjectProfiler::instance().enabled())
+                concurrent = false;
+            #endif
+            #endif
+
+            if (!concurrent) {
+                for (Size i=0; i<n; ++i)
+                    errors[i] = instruments_[i]->calibrationError();
+                return errors;
+            }
+
+            // the first helper is evaluated alone so that any lazy
+            // calculation in the model is performed before the others
+            // start using it
+            errors[0] = instruments_[0]->calibrationError();
+
+            vector<std::string> failures(n);
+
+            #ifdef _OPENMP
+            settings.disableUpdates(false);
+            #endif
+
+            #pragma omp parallel for schedule(dynamic) if(concurrent)
+            for (long i=1; i<(long)n; ++i) {
+                try {
+                    errors[i] = instruments_[i]->calibrationError();
+                } catch (std::exception& e) {
+                    failures[i] = e.what();
+                } catch (...) {
+                    failures[i] = "unknown error";
+                }
+            }
+
+            #ifdef _OPENMP
+            settings.enableUpdates();
+            #endif
+
+            for (Size i=1; i<n; ++i)
+                QL_REQUIRE(failures[i].empty(), failures[i]);
+            return errors;
+        }
+
         ext::shared_ptr<CalibratedModel> model_;
         const vector<ext::shared_ptr<CalibrationHelper> >& instruments_;
         vector<Real> weights_;
         const Projection projection_;
+        bool parallel_;
     };
 
     void CalibratedModel::calibrate(
@@ -95,6 +173,18 @@ namespace QuantLib {
         vector<Real> w =
             weights.empty() ? vector<Real>(instruments.size(), 1.0): weights;
 
+        if (parallelCalibration_ && supportsParallelCalibration()) {
+            std::set<const PricingEngine*> engines;
+            for (const auto& instrument : instruments) {
+                auto helper =
+                    ext::dynamic_pointer_cast<BlackCalibrationHelper>(instrument);
+                if (helper != nullptr && helper->pricingEngine() != nullptr)
+                    QL_REQUIRE(engines.insert(helper->pricingEngine().get()).second,
+                               "calibration helpers cannot share pricing "
+                               "engines when evaluated in parallel");
+            }
+        }
+
         Array prms = params();
         QL_REQUIRE(fixParameters.empty() || fixParameters.size() == prms.size(),
                    "mismatch between number of parameters (" <<
@@ -102,7 +192,7 @@ namespace QuantLib {
                    fixParameters.size() << ")");
         vector<bool> all(prms.size(), false);
         Projection proj(prms, !fixParameters.empty() ? fixParameters : all);
-        CalibrationFunction f(this,instruments,w,proj);
+        CalibrationFunction f(this,instruments,w,proj,parallelCalibration_);
         ProjectedConstraint pc(c,proj);
         Problem prob(f, pc, proj.project(prms));
         shortRateEndCriteria_ = method.minimize(prob, endCriteria);
@@ -26,6 +26,7 @@
 #ifndef quantlib_interest_rate_model_hpp
 #define quantlib_interest_rate_model_hpp
 
+#include <ql/math/matrix.hpp>
 #include <ql/math/optimization/endcriteria.hpp>
 #include <ql/methods/lattices/lattice.hpp>
 #include <ql/models/calibrationhelper.hpp>
@@ -121,8 +122,48 @@ namespace QuantLib {
         virtual void setParams(const Array& params);
         Integer functionEvaluation() const { return functionEvaluation_; }
 
+        //! \name Parallel calibration
+        /*! When enabled and OpenMP is available, the calibration
+            errors of the helpers are evaluated concurrently for each
+            trial set of parameters.
+
+            Models that don't support it, see
+            supportsParallelCalibration(), are calibrated serially.
+
+            \warning the model and its engines must be safe to use
+                     from several threads once the parameters are set;
+                     in particular, helpers cannot share pricing
+                     engines, which is checked for Black helpers.
+        */
+        //@{
+        //! enable parallel evaluation in subsequent calibrations
+        void enableParallelCalibration(bool b = true) { parallelCalibration_ = b; }
+        //! disable parallel evaluation in subsequent calibrations
+        void disableParallelCalibration(bool b = true) { parallelCalibration_ = !b; }
+        //! tells whether parallel evaluation is enabled
+        bool allowsParallelCalibration() const { return parallelCalibration_; }
+        //@}
+
       protected:
         virtual void generateArguments() {}
+        //! whether calibration errors can be evaluated concurrently
+        /*! Models relying on caches that are not thread-safe
+            return false.
+        */
+        virtual bool supportsParallelCalibration() const { return true; }
+        //! derivatives of the calibration errors
+        /*! Models able to compute them with respect to their
+            current parameters fill the matrix (one row per helper,
+            one column per parameter) and return true.  Otherwise,
+            the default returns false and optimizers relying on the
+            Jacobian of the calibration fall back to finite
+            differences.
+        */
+        virtual bool calibrationErrorJacobian(
+                const std::vector<ext::shared_ptr<CalibrationHelper> >&,
+                Matrix&) const {
+            return false;
+        }
         std::vector<Parameter> arguments_;
         ext::shared_ptr<Constraint> constraint_;
         EndCriteria::Type shortRateEndCriteria_ = EndCriteria::None;
@@ -130,6 +171,7 @@ namespace QuantLib {
         Integer functionEvaluation_;
 
       private:
+        bool parallelCalibration_ = false;
         //! Constraint imposed on arguments
         class PrivateConstraint;
         //! Calibration cost function class
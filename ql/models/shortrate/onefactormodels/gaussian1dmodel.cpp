@@ -25,6 +25,11 @@ using std::exp;
 
 namespace QuantLib {
 
+    namespace {
+        // bound on the number of grids kept in each cache
+        const Size maxCachedGrids = 1000;
+    }
+
     Real Gaussian1dModel::forwardRate(const Date& fixing,
                                       const Date& referenceDate,
                                       const Real y,
@@ -51,6 +56,101 @@ namespace QuantLib {
                (dcf * zerobond(endDate, referenceDate, y, yts));
 }
 
+Array Gaussian1dModel::numeraire(const Time t,
+                                 const Array& y,
+                                 const Handle<YieldTermStructure>& yts) const {
+
+    calculate();
+
+    // only values on the model curve are cached, since the model is
+    // not notified of changes in other curves
+    bool cached = yts.empty() || yts.currentLink() == termStructure().currentLink();
+    if (cached) {
+        CachedGridKey k = {t, t, y};
+        auto i = numeraireCache_.find(k);
+        if (i != numeraireCache_.end())
+            return i->second;
+    }
+
+    Array result(y.size());
+    for (Size i = 0; i < y.size(); ++i)
+        result[i] = numeraire(t, y[i], yts);
+
+    if (cached) {
+        if (numeraireCache_.size() >= maxCachedGrids)
+            numeraireCache_.clear();
+        numeraireCache_.insert(std::make_pair(CachedGridKey{t, t, y}, result));
+    }
+    return result;
+}
+
+Array Gaussian1dModel::zerobond(const Time T,
+                                const Time t,
+                                const Array& y,
+                                const Handle<YieldTermStructure>& yts) const {
+
+    calculate();
+
+    bool cached = yts.empty() || yts.currentLink() == termStructure().currentLink();
+    if (cached) {
+        CachedGridKey k = {T, t, y};
+        auto i = zerobondCache_.find(k);
+        if (i != zerobondCache_.end())
+            return i->second;
+    }
+
+    Array result(y.size());
+    for (Size i = 0; i < y.size(); ++i)
+        result[i] = zerobond(T, t, y[i], yts);
+
+    if (cached) {
+        if (zerobondCache_.size() >= maxCachedGrids)
+            zerobondCache_.clear();
+        zerobondCache_.insert(std::make_pair(CachedGridKey{T, t, y}, result));
+    }
+    return result;
+}
+
+Array Gaussian1dModel::zerobond(const Date& maturity,
+                                const Date& referenceDate,
+                                const Array& y,
+                                const Handle<YieldTermStructure>& yts) const {
+
+    return zerobond(termStructure()->timeFromReference(maturity),
+                    referenceDate != Null<Date>()
+                        ? termStructure()->timeFromReference(referenceDate)
+                        : 0.0,
+                    y, yts);
+}
+
+Array Gaussian1dModel::forwardRate(const Date& fixing,
+                                   const Date& referenceDate,
+                                   const Array& y,
+                                   const ext::shared_ptr<IborIndex>& iborIdx) const {
+
+    QL_REQUIRE(iborIdx != nullptr, "no ibor index given");
+
+    calculate();
+
+    if (fixing <= (evaluationDate_ + (enforcesTodaysHistoricFixings_ ? 0 : -1)))
+        return Array(y.size(), iborIdx->fixing(fixing));
+
+    Handle<YieldTermStructure> yts = iborIdx->forwardingTermStructure(); // might be empty, then
+                                                                         // use model curve
+
+    Date valueDate = iborIdx->valueDate(fixing);
+    Date endDate = iborIdx->fixingCalendar().advance(
+        valueDate, iborIdx->tenor(), iborIdx->businessDayConvention(), iborIdx->endOfMonth());
+    Real dcf = iborIdx->dayCounter().yearFraction(valueDate, endDate);
+
+    Array start = zerobond(valueDate, referenceDate, y, yts);
+    Array end = zerobond(endDate, referenceDate, y, yts);
+    Array result(y.size());
+    for (Size i = 0; i < y.size(); ++i)
+        result[i] = (start[i] - end[i]) / (dcf * end[i]);
+    return result;
+}
+
 Real Gaussian1dModel::swapRate(const Date& fixing,
                                const Period& tenor,
                                const Date& referenceDate,
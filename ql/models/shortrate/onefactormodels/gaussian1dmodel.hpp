@@ -45,6 +45,7 @@
 
 #include <boost/math/special_functions/erf.hpp>
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace QuantLib {
@@ -119,6 +120,41 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
                 Real y = 0.0,
                 const ext::shared_ptr<SwapIndex>& swapIdx = ext::shared_ptr<SwapIndex>()) const;
 
+    /*! \name State grid values
+        Numeraire, zerobond and forward rate values for a whole grid
+        of state values.  Numeraires and zerobonds on the model curve
+        are cached, keyed by the times and the grid, so that products
+        sharing exercise and payment dates (e.g. the swaptions of a
+        calibration basket) reuse them.  The cache is cleared
+        whenever the model is recalculated or its parameters are
+        changed, and when it grows beyond a fixed number of grids.
+
+        \warning these methods write to the cache and must not be
+                 called concurrently.  For this reason, and since the
+                 state processes cache values as well, Gaussian 1d
+                 models are always calibrated serially.
+    */
+    //@{
+    Array numeraire(Time t,
+                    const Array& y,
+                    const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Array zerobond(Time T,
+                   Time t,
+                   const Array& y,
+                   const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Array zerobond(const Date& maturity,
+                   const Date& referenceDate,
+                   const Array& y,
+                   const Handle<YieldTermStructure>& yts = Handle<YieldTermStructure>()) const;
+
+    Array forwardRate(const Date& fixing,
+                      const Date& referenceDate,
+                      const Array& y,
+                      const ext::shared_ptr<IborIndex>& iborIdx) const;
+    //@}
+
     /*! Computes the integral
     \f[ {2\pi}^{-0.5} \int_{a}^{b} p(x) \exp{-0.5*x*x} \mathrm{d}x \f]
     with
@@ -172,6 +208,32 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
 
     mutable std::unordered_map<CachedSwapKey, ext::shared_ptr<VanillaSwap>, CachedSwapKeyHasher> swapCache_;
 
+    // Values on state grids only depend on the times, the grid and
+    // the model parameters, so they can be shared across products.
+
+    struct CachedGridKey {
+        const Time T, t;
+        const Array y;
+        bool operator==(const CachedGridKey &o) const {
+            return T == o.T && t == o.t && y.size() == o.y.size() &&
+                   std::equal(y.begin(), y.end(), o.y.begin());
+        }
+    };
+
+    struct CachedGridKeyHasher {
+        std::size_t operator()(CachedGridKey const &x) const {
+            std::size_t seed = 0;
+            boost::hash_combine(seed, x.T);
+            boost::hash_combine(seed, x.t);
+            for (Real yi : x.y)
+                boost::hash_combine(seed, yi);
+            return seed;
+        }
+    };
+
+    mutable std::unordered_map<CachedGridKey, Array, CachedGridKeyHasher> numeraireCache_,
+        zerobondCache_;
+
   protected:
     // we let derived classes register with the termstructure
     Gaussian1dModel(const Handle<YieldTermStructure> &yieldTermStructure)
@@ -188,13 +250,22 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
         evaluationDate_ = Settings::instance().evaluationDate();
         enforcesTodaysHistoricFixings_ =
             Settings::instance().enforcesTodaysHistoricFixings();
+        flushGridCache();
     }
 
     void generateArguments() {
         calculate();
+        flushGridCache();
         notifyObservers();
     }
 
+    // to be called by derived classes whenever their parameters change
+    // without a recalculation of the model
+    void flushGridCache() const {
+        numeraireCache_.clear();
+        zerobondCache_.clear();
+    }
+
     // retrieve underlying swap from cache if possible, otherwise
     // create it and store it in the cache
     ext::shared_ptr<VanillaSwap>
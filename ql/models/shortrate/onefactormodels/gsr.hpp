@@ -143,9 +143,13 @@ class Gsr : public Gaussian1dModel, public CalibratedModel {
 
     void generateArguments() override {
         ext::static_pointer_cast<GsrProcess>(stateProcess_)->flushCache();
+        flushGridCache();
         notifyObservers();
     }
 
+    // the grid caches and the state process are not thread-safe
+    bool supportsParallelCalibration() const override { return false; }
+
     void update() override;
 
     void performCalculations() const override {
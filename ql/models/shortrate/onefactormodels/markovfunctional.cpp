@@ -27,7 +27,9 @@
 #include <ql/termstructures/volatility/sabrinterpolatedsmilesection.hpp>
 #include <ql/termstructures/volatility/smilesection.hpp>
 #include <ql/termstructures/volatility/smilesectionutils.hpp>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace QuantLib {
 
@@ -224,6 +226,22 @@ namespace QuantLib {
 
         y_ = yGrid(modelSettings_.yStdDevs_, modelSettings_.yGridPoints_);
 
+        // the grid is fixed, so are the integrals of the interpolated
+        // payoffs' monomials against the normal density
+        normalIntegralMoments_ = Matrix(y_.size(), 4, 0.0);
+        for (Size j = 0; j < y_.size(); ++j) {
+            Real h = j < y_.size() - 1 ? y_[j] : y_[j - 1];
+            Real x0 = y_[j], x1 = j < y_.size() - 1 ? y_[j + 1] : 100.0;
+            normalIntegralMoments_[j][0] =
+                gaussianShiftedPolynomialIntegral(0.0, 0.0, 0.0, 0.0, 1.0, h, x0, x1);
+            normalIntegralMoments_[j][1] =
+                gaussianShiftedPolynomialIntegral(0.0, 0.0, 0.0, 1.0, 0.0, h, x0, x1);
+            normalIntegralMoments_[j][2] =
+                gaussianShiftedPolynomialIntegral(0.0, 0.0, 1.0, 0.0, 0.0, h, x0, x1);
+            normalIntegralMoments_[j][3] =
+                gaussianShiftedPolynomialIntegral(0.0, 1.0, 0.0, 0.0, 0.0, h, x0, x1);
+        }
+
         discreteNumeraire_ = ext::make_shared<Matrix>(
             times_.size(), 2 * modelSettings_.yGridPoints_ + 1, 1.0);
         for (Size i = 0; i < times_.size(); i++) {
@@ -474,11 +492,30 @@ namespace QuantLib {
             Real normalization =
                 termStructure()->discount(times_[idx], true) / numeraire0;
 
-            for (unsigned int k = 0; k < i->second.paymentDates_.size(); k++) {
-                deflatedFinalPayments =
-                    deflatedZerobondArray(termStructure()->timeFromReference(
-                                              i->second.paymentDates_[k]),
-                                          times_[idx], y_);
+            const bool parallel = modelSettings_.parallelCalibration_;
+
+            std::vector<Time> paymentTimes;
+            paymentTimes.reserve(i->second.paymentDates_.size());
+            for (const auto& d : i->second.paymentDates_)
+                paymentTimes.push_back(termStructure()->timeFromReference(d));
+            std::vector<Array> deflatedPayments(paymentTimes.size());
+            std::vector<std::string> paymentFailures(paymentTimes.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(parallel)
+#endif
+            for (long k = 0; k < static_cast<long>(paymentTimes.size()); k++) {
+                try {
+                    deflatedPayments[k] =
+                        deflatedZerobondArray(paymentTimes[k], times_[idx], y_);
+                } catch (std::exception& e) {
+                    paymentFailures[k] = e.what();
+                }
+            }
+
+            for (Size k = 0; k < deflatedPayments.size(); k++) {
+                QL_REQUIRE(paymentFailures[k].empty(), paymentFailures[k]);
+                deflatedFinalPayments = deflatedPayments[k];
                 discreteDeflatedAnnuities +=
                     deflatedFinalPayments * i->second.yearFractions_[k];
             }
@@ -489,12 +526,39 @@ namespace QuantLib {
                 0.0, CubicInterpolation::Lagrange, 0.0);
             deflatedAnnuities.enableExtrapolation();
 
+            // integrals of the deflated annuities over the grid intervals,
+            // which do not depend on the digitals correction factor below
+            Array integrals(y_.size(), 0.0);
+            for (Size j = 0; j < y_.size(); j++) {
+                Size l = j;
+                if (j == y_.size() - 1) {
+                    if ((modelSettings_.adjustments_ &
+                         ModelSettings::NoPayoffExtrapolation) != 0)
+                        continue;
+                    l = j - 1;
+                    if ((modelSettings_.adjustments_ &
+                         ModelSettings::ExtrapolatePayoffFlat) != 0) {
+                        integrals[j] = discreteDeflatedAnnuities[l] *
+                                       normalIntegralMoments_[j][0];
+                        continue;
+                    }
+                }
+                integrals[j] =
+                    deflatedAnnuities.cCoefficients()[l] * normalIntegralMoments_[j][3] +
+                    deflatedAnnuities.bCoefficients()[l] * normalIntegralMoments_[j][2] +
+                    deflatedAnnuities.aCoefficients()[l] * normalIntegralMoments_[j][1] +
+                    discreteDeflatedAnnuities[l] * normalIntegralMoments_[j][0];
+            }
+
             Real digitalsCorrectionFactor = 1.0;
             modelOutputs_.digitalsAdjustmentFactors_.insert(
                 modelOutputs_.digitalsAdjustmentFactors_.begin(),
                 digitalsCorrectionFactor);
 
             Real digital = 0.0, swapRate, swapRate0;
+            Array digitals(y_.size());
+            std::vector<Real> marketRates(y_.size(), Null<Real>());
+            std::vector<std::string> failures(y_.size());
 
             for (int c = 0;
                  c == 0 ||
@@ -508,53 +572,48 @@ namespace QuantLib {
                 }
 
                 digital = 0.0;
-                swapRate0 =
-                    modelSettings_.upperRateBound_ / 2.0; // initial guess
                 for (int j = y_.size() - 1; j >= 0; j--) {
+                    digital += std::max(integrals[j], 0.0) * numeraire0 *
+                               digitalsCorrectionFactor;
+                    digitals[j] = digital;
+                }
 
-                    Real integral = 0.0;
-
-                    if (j == (int)(y_.size() - 1)) {
-                        if ((modelSettings_.adjustments_ &
-                             ModelSettings::NoPayoffExtrapolation) == 0) {
-                            if ((modelSettings_.adjustments_ &
-                                 ModelSettings::ExtrapolatePayoffFlat) != 0) {
-                                integral = gaussianShiftedPolynomialIntegral(
-                                    0.0, 0.0, 0.0, 0.0,
-                                    discreteDeflatedAnnuities[j - 1], y_[j - 1],
-                                    y_[j], 100.0);
-                            } else {
-                                Real ca =
-                                    deflatedAnnuities.aCoefficients()[j - 1];
-                                Real cb =
-                                    deflatedAnnuities.bCoefficients()[j - 1];
-                                Real cc =
-                                    deflatedAnnuities.cCoefficients()[j - 1];
-                                integral = gaussianShiftedPolynomialIntegral(
-                                    0.0, cc, cb, ca,
-                                    discreteDeflatedAnnuities[j - 1], y_[j - 1],
-                                    y_[j], 100.0);
+                // the market rates only depend on the digital prices when
+                // they are not searched starting from their neighbours
+                if (parallel &&
+                    (modelSettings_.adjustments_ & ModelSettings::CustomSmile) == 0) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+                    for (long j = 0; j < static_cast<long>(y_.size()); j++) {
+                        if (digitals[j] < i->second.minRateDigital_ &&
+                            digitals[j] > i->second.maxRateDigital_) {
+                            try {
+                                marketRates[j] = marketSwapRate(
+                                    i->first, i->second, digitals[j], i->second.atm_,
+                                    i->second.rawSmileSection_->shift());
+                            } catch (std::exception& e) {
+                                failures[j] = e.what();
                             }
                         }
-                    } else {
-                        Real ca = deflatedAnnuities.aCoefficients()[j];
-                        Real cb = deflatedAnnuities.bCoefficients()[j];
-                        Real cc = deflatedAnnuities.cCoefficients()[j];
-                        integral = gaussianShiftedPolynomialIntegral(
-                            0.0, cc, cb, ca, discreteDeflatedAnnuities[j],
-                            y_[j], y_[j], y_[j + 1]);
                     }
+                    for (Size j = 0; j < y_.size(); j++)
+                        QL_REQUIRE(failures[j].empty(), failures[j]);
+                }
+
+                swapRate0 =
+                    modelSettings_.upperRateBound_ / 2.0; // initial guess
+                for (int j = y_.size() - 1; j >= 0; j--) {
 
-                    if (integral < 0) {
+                    if (integrals[j] < 0) {
                         QL_MFMESSAGE(modelOutputs_,
                                      "WARNING: integral for digitalPrice is "
                                      "negative for j="
-                                         << j << " (" << integral
+                                         << j << " (" << integrals[j]
                                          << ") --- reset it to zero.");
-                        integral = 0.0;
                     }
 
-                    digital += integral * numeraire0 * digitalsCorrectionFactor;
+                    digital = digitals[j];
 
                     bool check = true;
                     if ((modelSettings_.adjustments_ & ModelSettings::CustomSmile) != 0) {
@@ -567,6 +626,8 @@ namespace QuantLib {
                     } else if (digital <= i->second.maxRateDigital_) {
                         swapRate = modelSettings_.upperRateBound_;
                         check = false;
+                    } else if (parallel) {
+                        swapRate = marketRates[j];
                     } else {
                         swapRate = marketSwapRate(
                             i->first, i->second, digital, swapRate0,
@@ -894,6 +955,8 @@ namespace QuantLib {
                     "Sabr" :
                     "")
             << std::endl;
+        out << "Parallel calibration : "
+            << (m.settings_.parallelCalibration_ ? "yes" : "no") << std::endl;
         out << "Smile moneyness checkpoints: ";
         for (Size i = 0; i < m.settings_.smileMoneynessCheckpoints_.size(); i++)
             out << m.settings_.smileMoneynessCheckpoints_[i]
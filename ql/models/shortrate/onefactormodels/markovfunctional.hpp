@@ -25,6 +25,7 @@
 #define quantlib_markovfunctional_hpp
 
 #include <ql/math/interpolation.hpp>
+#include <ql/math/matrix.hpp>
 #include <ql/models/shortrate/onefactormodels/gaussian1dmodel.hpp>
 #include <ql/processes/mfstateprocess.hpp>
 #include <ql/termstructures/volatility/optionlet/optionletvolatilitystructure.hpp>
@@ -246,6 +247,18 @@ namespace QuantLib {
                 customSmileFactory_ = f;
                 return *this;
             }
+            /*! If enabled, the deflated zerobonds and the market rates
+                on the state grid are computed in parallel (if OpenMP is
+                available) during the numeraire calibration. Market rates
+                are then searched starting from the atm level instead of
+                the rate of the neighbouring grid point, so that results
+                may differ from the serial calibration within the market
+                rate accuracy. The yield term structure and the smile
+                sections must support concurrent reads. */
+            ModelSettings &withParallelCalibration(bool b = true) {
+                parallelCalibration_ = b;
+                return *this;
+            }
 
             Size yGridPoints_ = 64;
             Real yStdDevs_ = 7.0;
@@ -255,6 +268,7 @@ namespace QuantLib {
             int adjustments_;
             std::vector<Real> smileMoneynessCheckpoints_;
             ext::shared_ptr<CustomSmileFactory> customSmileFactory_;
+            bool parallelCalibration_ = false;
         };
 
         struct CalibrationPoint {
@@ -383,9 +397,13 @@ namespace QuantLib {
             // hard to avoid though.
             calculate();
             updateNumeraireTabulation();
+            flushGridCache();
             notifyObservers();
         }
 
+        // the grid caches and the numeraire tabulation are not thread-safe
+        bool supportsParallelCalibration() const override { return false; }
+
         void performCalculations() const override {
             Gaussian1dModel::performCalculations();
             updateTimes();
@@ -530,6 +548,10 @@ namespace QuantLib {
 
         Array normalIntegralX_;
         Array normalIntegralW_;
+        // integrals of (y-y_j)^m against the normal density over the
+        // grid intervals (row j) for m=0,...,3, the last row holds the
+        // right extrapolation interval
+        Matrix normalIntegralMoments_;
 
         mutable std::vector<std::pair<Size,Size> > arbitrageIndices_;
         std::vector<std::pair<Size,Size> > forcedArbitrageIndices_;
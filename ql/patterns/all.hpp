@@ -4,6 +4,7 @@
 #include <ql/patterns/composite.hpp>
 #include <ql/patterns/curiouslyrecurring.hpp>
 #include <ql/patterns/lazyobject.hpp>
+#include <ql/patterns/lazyobjectprofiler.hpp>
 #include <ql/patterns/observable.hpp>
 #include <ql/patterns/singleton.hpp>
 #include <ql/patterns/visitor.hpp>
@@ -25,6 +25,9 @@
 #define quantlib_lazy_object_h
 
 #include <ql/patterns/observable.hpp>
+#if defined(QL_ENABLE_PROFILING)
+#include <ql/patterns/lazyobjectprofiler.hpp>
+#endif
 
 namespace QuantLib {
 
@@ -32,9 +35,18 @@ namespace QuantLib {
     /*! \ingroup patterns */
     class LazyObject : public virtual Observable,
                        public virtual Observer {
+        // calculates shared dependencies before concurrent bootstraps
+        friend class CurveBootstrapScheduler;
       public:
+        #if defined(QL_ENABLE_PROFILING)
+        LazyObject();
+        LazyObject(const LazyObject&) = default;
+        LazyObject& operator=(const LazyObject&) = default;
+        ~LazyObject() override;
+        #else
         LazyObject() = default;
         ~LazyObject() override = default;
+        #endif
         //! \name Observer interface
         //@{
         void update() override;
@@ -112,7 +124,26 @@ namespace QuantLib {
 
     // inline definitions
 
+    #if defined(QL_ENABLE_PROFILING)
+    // the profiler is accessed on construction so that it outlives
+    // the lazy objects that might be retired on destruction
+    inline LazyObject::LazyObject() {
+        LazyObjectProfiler::instance();
+    }
+
+    inline LazyObject::~LazyObject() {
+        LazyObjectProfiler::instance().retire(this);
+    }
+    #endif
+
     inline void LazyObject::update() {
+        #if defined(QL_ENABLE_PROFILING)
+        if (calculated_) {
+            LazyObjectProfiler& profiler = LazyObjectProfiler::instance();
+            if (profiler.enabled())
+                profiler.recordInvalidation(this);
+        }
+        #endif
         // forwards notifications only the first time
         if (calculated_ || alwaysForward_) {
             // set to false early
@@ -164,6 +195,9 @@ namespace QuantLib {
             calculated_ = true;   // prevent infinite recursion in
                                   // case of bootstrapping
             try {
+                #if defined(QL_ENABLE_PROFILING)
+                detail::ProfiledCalculation profiled(this);
+                #endif
                 performCalculations();
             } catch (...) {
                 calculated_ = false;
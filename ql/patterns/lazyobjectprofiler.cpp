@@ -0,0 +1,178 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/patterns/lazyobject.hpp>
+#include <ql/patterns/lazyobjectprofiler.hpp>
+#include <boost/core/demangle.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <typeinfo>
+
+namespace QuantLib {
+
+    void LazyObjectProfiler::enable() {
+        #if defined(QL_ENABLE_PROFILING)
+        enabled_ = true;
+        #else
+        QL_FAIL("profiling support not available");
+        #endif
+    }
+
+    void LazyObjectProfiler::reset() {
+        QL_REQUIRE(stack_.empty(),
+                   "cannot reset the profiler during a calculation");
+        entries_.clear();
+        live_.clear();
+        edges_.clear();
+    }
+
+    void LazyObjectProfiler::setLabel(const LazyObject* object,
+                                      const std::string& label) {
+        entries_[index(object)].label = label;
+    }
+
+    Size LazyObjectProfiler::index(const LazyObject* object) {
+        auto i = live_.find(object);
+        if (i != live_.end())
+            return i->second;
+        Entry entry;
+        entry.type = boost::core::demangle(typeid(*object).name());
+        entries_.push_back(entry);
+        live_[object] = entries_.size() - 1;
+        return entries_.size() - 1;
+    }
+
+    void LazyObjectProfiler::startCalculation(const LazyObject* object) {
+        Size i = index(object);
+        if (!stack_.empty())
+            ++edges_[std::make_pair(i, stack_.back().index)];
+        stack_.push_back({i, std::chrono::steady_clock::now(), 0.0});
+    }
+
+    void LazyObjectProfiler::stopCalculation() {
+        // calls are paired by ProfiledCalculation, which checks whether
+        // the profiler is enabled only once; guard against unbalanced
+        // calls from other clients anyway
+        if (stack_.empty())
+            return;
+        const Frame frame = stack_.back();
+        stack_.pop_back();
+        Real elapsed = std::chrono::duration<Real>(
+            std::chrono::steady_clock::now() - frame.start).count();
+        Entry& entry = entries_[frame.index];
+        ++entry.recalculations;
+        entry.totalTime += elapsed;
+        entry.selfTime += elapsed - frame.nestedTime;
+        if (!stack_.empty())
+            stack_.back().nestedTime += elapsed;
+    }
+
+    void LazyObjectProfiler::recordInvalidation(const LazyObject* object) {
+        ++entries_[index(object)].invalidations;
+    }
+
+    void LazyObjectProfiler::retire(const LazyObject* object) {
+        auto i = live_.find(object);
+        if (i != live_.end()) {
+            entries_[i->second].alive = false;
+            live_.erase(i);
+        }
+    }
+
+    std::vector<LazyObjectProfiler::Edge> LazyObjectProfiler::edges() const {
+        std::vector<Edge> result;
+        result.reserve(edges_.size());
+        for (const auto& e : edges_)
+            result.push_back({e.first.first, e.first.second, e.second});
+        return result;
+    }
+
+    std::string LazyObjectProfiler::name(Size i) const {
+        std::ostringstream out;
+        if (!entries_[i].label.empty())
+            out << entries_[i].label;
+        else
+            out << entries_[i].type << " #" << i;
+        return out.str();
+    }
+
+    void LazyObjectProfiler::writeProfile(std::ostream& out) const {
+        std::vector<Size> order(entries_.size());
+        for (Size i=0; i<order.size(); ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(),
+                         [this](Size i, Size j) {
+                             return entries_[i].totalTime > entries_[j].totalTime;
+                         });
+
+        std::ios::fmtflags flags = out.flags();
+        std::streamsize precision = out.precision();
+
+        out << std::setw(14) << "total [s]"
+            << std::setw(14) << "self [s]"
+            << std::setw(10) << "recalcs"
+            << std::setw(10) << "invalid."
+            << "  object\n";
+        for (Size i : order) {
+            const Entry& entry = entries_[i];
+            out << std::fixed << std::setprecision(6)
+                << std::setw(14) << entry.totalTime
+                << std::setw(14) << entry.selfTime
+                << std::setw(10) << entry.recalculations
+                << std::setw(10) << entry.invalidations
+                << "  " << name(i)
+                << (entry.alive ? "" : " (destroyed)") << "\n";
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+    }
+
+    namespace {
+
+        std::string escaped(const std::string& s) {
+            std::string result;
+            for (char c : s) {
+                if (c == '"' || c == '\\')
+                    result += '\\';
+                result += c;
+            }
+            return result;
+        }
+
+    }
+
+    void LazyObjectProfiler::writeGraph(std::ostream& out) const {
+        out << "digraph lazy_objects {\n";
+        for (Size i=0; i<entries_.size(); ++i) {
+            const Entry& entry = entries_[i];
+            out << "    n" << i << " [label=\"" << escaped(name(i))
+                << "\\n" << entry.recalculations << " recalculations, "
+                << entry.invalidations << " invalidations"
+                << "\\n" << entry.totalTime << " s (self "
+                << entry.selfTime << " s)\"];\n";
+        }
+        for (const auto& e : edges_) {
+            out << "    n" << e.first.first << " -> n" << e.first.second
+                << " [label=\"" << e.second << "\"];\n";
+        }
+        out << "}\n";
+    }
+
+}
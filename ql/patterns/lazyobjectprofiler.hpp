@@ -0,0 +1,156 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file lazyobjectprofiler.hpp
+    \brief recalculation profiler for lazy objects
+*/
+
+#ifndef quantlib_lazy_object_profiler_hpp
+#define quantlib_lazy_object_profiler_hpp
+
+#include <ql/patterns/singleton.hpp>
+#include <ql/types.hpp>
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace QuantLib {
+
+    class LazyObject;
+
+    //! Recalculation profiler for lazy objects
+    /*! When the library is compiled with QL_ENABLE_PROFILING defined
+        and the profiler is enabled at run time, each call to
+        LazyObject::performCalculations() is recorded together with
+        its duration, and each notification discarding the cached
+        results of a lazy object is counted.
+
+        Recalculations triggered while another lazy object is
+        performing its calculations are recorded as nesting edges
+        from the inner to the outer object, which can be exported in
+        Graphviz format together with the profile; the time spent in
+        such nested recalculations is excluded from the self time of
+        the outer object.  These edges only show which calculation
+        triggered which; they are not the observer links between the
+        objects, and a dependency whose results were still valid
+        doesn't show up.
+
+        Objects are identified by their dynamic type and by an
+        optional label; their profile is kept after they are
+        destroyed, until reset() is called.
+
+        \warning The profiler is not thread-safe.
+
+        \ingroup patterns
+    */
+    class LazyObjectProfiler : public Singleton<LazyObjectProfiler> {
+        friend class Singleton<LazyObjectProfiler>;
+      private:
+        LazyObjectProfiler() = default;
+      public:
+        struct Entry {
+            std::string type;
+            std::string label;
+            //! number of calls to performCalculations()
+            Size recalculations = 0;
+            //! number of notifications discarding calculated results
+            Size invalidations = 0;
+            //! time spent in performCalculations(), in seconds
+            Real totalTime = 0.0;
+            //! as above, excluding nested recalculations
+            Real selfTime = 0.0;
+            bool alive = true;
+        };
+        //! the object at index \c outer triggered \c count recalculations of \c inner
+        struct Edge {
+            Size inner, outer, count;
+        };
+
+        //! \name Run-time settings
+        //@{
+        /*! \pre the library was compiled with QL_ENABLE_PROFILING */
+        void enable();
+        void disable() { enabled_ = false; }
+        bool enabled() const { return enabled_; }
+        //! clears the recorded data
+        void reset();
+        //! sets the name used in the reports for the given object
+        void setLabel(const LazyObject* object, const std::string& label);
+        //@}
+
+        //! \name Results
+        //@{
+        const std::vector<Entry>& entries() const { return entries_; }
+        std::vector<Edge> edges() const;
+        //! flat profile, sorted by decreasing total time
+        void writeProfile(std::ostream& out) const;
+        //! recalculation-nesting graph in Graphviz dot format
+        void writeGraph(std::ostream& out) const;
+        //@}
+
+        //! \name Hooks used by LazyObject
+        //@{
+        void startCalculation(const LazyObject* object);
+        void stopCalculation();
+        void recordInvalidation(const LazyObject* object);
+        void retire(const LazyObject* object);
+        //@}
+      private:
+        Size index(const LazyObject* object);
+        std::string name(Size i) const;
+
+        struct Frame {
+            Size index;
+            std::chrono::steady_clock::time_point start;
+            Real nestedTime;
+        };
+
+        bool enabled_ = false;
+        std::vector<Entry> entries_;
+        std::map<const LazyObject*, Size> live_;
+        std::map<std::pair<Size, Size>, Size> edges_;
+        std::vector<Frame> stack_;
+    };
+
+    namespace detail {
+
+        class ProfiledCalculation {
+          public:
+            explicit ProfiledCalculation(const LazyObject* object)
+            : profiler_(LazyObjectProfiler::instance()),
+              active_(profiler_.enabled()) {
+                if (active_)
+                    profiler_.startCalculation(object);
+            }
+            ~ProfiledCalculation() {
+                if (active_)
+                    profiler_.stopCalculation();
+            }
+            ProfiledCalculation(const ProfiledCalculation&) = delete;
+            ProfiledCalculation& operator=(const ProfiledCalculation&) = delete;
+          private:
+            LazyObjectProfiler& profiler_;
+            bool active_;
+        };
+
+    }
+
+}
+
+#endif
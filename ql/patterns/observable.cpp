@@ -23,6 +23,9 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 
 #ifndef QL_ENABLE_THREAD_SAFE_OBSERVER_PATTERN
 
+#include <unordered_map>
+#include <vector>
+
 namespace QuantLib {
 
     void ObservableSettings::enableUpdates() {
@@ -53,11 +56,97 @@ namespace QuantLib {
     }
 
 
+    void ObservableSettings::propagateDirtyObservers() {
+        propagating_ = true;
+
+        bool successful = true;
+        std::string errMsg;
+
+        while (!dirtyObservers_.empty()) {
+            // Collect the subgraph reachable from the dirty observers
+            // (an observer is linked to the observers of its own
+            // Observable part, if any) and count the incoming edges
+            // of each node within it.
+            struct Node {
+                Observable* observable;
+                Size inDegree;
+            };
+            std::unordered_map<Observer*, Node> graph;
+            std::vector<Observer*> stack(dirtyObservers_.begin(),
+                                         dirtyObservers_.end());
+            for (auto* observer : stack)
+                graph.emplace(observer, Node{nullptr, 0});
+            while (!stack.empty()) {
+                Observer* observer = stack.back();
+                stack.pop_back();
+                auto* observable = dynamic_cast<Observable*>(observer);
+                graph[observer].observable = observable;
+                if (observable != nullptr) {
+                    for (auto* next : observable->observers_) {
+                        auto inserted = graph.emplace(next, Node{nullptr, 0});
+                        ++inserted.first->second.inDegree;
+                        if (inserted.second)
+                            stack.push_back(next);
+                    }
+                }
+            }
+
+            // Kahn's algorithm; nodes in (or downstream of) cycles are
+            // appended at the end in no particular order.
+            std::vector<Observer*> order;
+            order.reserve(graph.size());
+            for (const auto& node : graph)
+                if (node.second.inDegree == 0)
+                    order.push_back(node.first);
+            for (Size i=0; i<order.size(); ++i) {
+                Observable* observable = graph[order[i]].observable;
+                if (observable != nullptr) {
+                    for (auto* next : observable->observers_)
+                        if (--graph[next].inDegree == 0)
+                            order.push_back(next);
+                }
+            }
+            if (order.size() < graph.size()) {
+                for (const auto& node : graph)
+                    if (node.second.inDegree > 0)
+                        order.push_back(node.first);
+            }
+
+            // Only the observers that were actually notified are
+            // updated; their own notifications mark their observers,
+            // which come later in the order.  Observers notified out
+            // of order (e.g., because the graph changed) are left in
+            // the dirty set for the next pass.
+            for (auto* observer : order) {
+                if (dirtyObservers_.erase(observer) == 0)
+                    continue;
+                try {
+                    observer->update();
+                } catch (std::exception& e) {
+                    successful = false;
+                    errMsg = e.what();
+                } catch (...) {
+                    successful = false;
+                }
+            }
+        }
+
+        propagating_ = false;
+
+        QL_ENSURE(successful,
+                  "could not notify one or more observers: " << errMsg);
+    }
+
+
     void Observable::notifyObservers() {
         if (!settings_.updatesEnabled()) {
             // if updates are only deferred, flag this for later notification
             // these are held centrally by the settings singleton
             settings_.registerDeferredObservers(observers_);
+        } else if (settings_.updatesBatched()) {
+            // an update transaction is open; the observers will be
+            // updated once, when it is committed
+            settings_.registerDirtyObservers(observers_);
         } else if (!observers_.empty()) {
             bool successful = true;
             std::string errMsg;
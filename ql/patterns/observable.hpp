@@ -36,6 +36,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include <boost/unordered_set.hpp>
 #include <unordered_set>
 #include <set>
+#include <vector>
 
 #ifndef QL_ENABLE_THREAD_SAFE_OBSERVER_PATTERN
 
@@ -43,6 +44,7 @@ namespace QuantLib {
 
     class Observer;
     class ObservableSettings;
+    class ObservableUpdateTransaction;
 
     //! Object that notifies its changes to a set of observers
     /*! \ingroup patterns */
@@ -72,6 +74,7 @@ namespace QuantLib {
     class ObservableSettings : public Singleton<ObservableSettings> {
         friend class Singleton<ObservableSettings>;
         friend class Observable;
+        friend class ObservableUpdateTransaction;
       public:
         void disableUpdates(bool deferred=false) {
             updatesEnabled_  = false;
@@ -81,6 +84,10 @@ namespace QuantLib {
 
         bool updatesEnabled() const { return updatesEnabled_; }
         bool updatesDeferred() const { return updatesDeferred_; }
+        //! whether notifications are being collected by a transaction
+        bool updatesBatched() const {
+            return transactionDepth_ > 0 || propagating_;
+        }
 
       private:
         ObservableSettings() = default;
@@ -91,9 +98,17 @@ namespace QuantLib {
         void registerDeferredObservers(const Observable::set_type& observers);
         void unregisterDeferredObserver(Observer*);
 
-        set_type deferredObservers_;
+        void beginTransaction();
+        void commitTransaction();
+        void registerDirtyObservers(const Observable::set_type& observers);
+        void unregisterDirtyObserver(Observer*);
+        void propagateDirtyObservers();
+
+        set_type deferredObservers_, dirtyObservers_;
 
         bool updatesEnabled_ = true, updatesDeferred_ = false;
+        Size transactionDepth_ = 0;
+        bool propagating_ = false;
     };
 
     //! Object that gets notified when a given observable changes
@@ -128,6 +143,8 @@ namespace QuantLib {
         void registerWithObservables(const ext::shared_ptr<Observer>&);
         Size unregisterWith(const ext::shared_ptr<Observable>&);
         void unregisterWithAll();
+        //! returns the observables this instance is registered with
+        std::vector<ext::shared_ptr<Observable> > observables() const;
 
         /*! This method must be implemented in derived classes. An
             instance of %Observer does not call this method directly:
@@ -163,6 +180,27 @@ namespace QuantLib {
         deferredObservers_.erase(o);
     }
 
+    inline void ObservableSettings::beginTransaction() {
+        ++transactionDepth_;
+    }
+
+    inline void ObservableSettings::commitTransaction() {
+        QL_REQUIRE(transactionDepth_ > 0, "no open update transaction");
+        // an inner transaction opened by an observer while propagating
+        // leaves the remaining work to the outer propagation loop
+        if (--transactionDepth_ == 0 && !propagating_)
+            propagateDirtyObservers();
+    }
+
+    inline void ObservableSettings::registerDirtyObservers(
+                                   const Observable::set_type& observers) {
+        dirtyObservers_.insert(observers.begin(), observers.end());
+    }
+
+    inline void ObservableSettings::unregisterDirtyObserver(Observer* o) {
+        dirtyObservers_.erase(o);
+    }
+
     inline Observable::Observable(const Observable&)
     : settings_(ObservableSettings::instance()) {
         // the observer set is not copied; no observer asked to
@@ -193,6 +231,8 @@ namespace QuantLib {
     inline Size Observable::unregisterObserver(Observer* o) {
         if (settings_.updatesDeferred())
             settings_.unregisterDeferredObserver(o);
+        if (settings_.updatesBatched())
+            settings_.unregisterDirtyObserver(o);
 
         return observers_.erase(o);
     }
@@ -248,6 +288,11 @@ namespace QuantLib {
         observables_.clear();
     }
 
+    inline std::vector<ext::shared_ptr<Observable> > Observer::observables() const {
+        return std::vector<ext::shared_ptr<Observable> >(observables_.begin(),
+                                                         observables_.end());
+    }
+
     inline void Observer::deepUpdate() {
         update();
     }
@@ -298,6 +343,8 @@ namespace QuantLib {
         void registerWithObservables(const ext::shared_ptr<Observer>&);
         Size unregisterWith(const ext::shared_ptr<Observable>&);
         void unregisterWithAll();
+        //! returns the observables this instance is registered with
+        std::vector<ext::shared_ptr<Observable> > observables() const;
 
         /*! This method must be implemented in derived classes. An
             instance of %Observer does not call this method directly:
@@ -408,6 +455,7 @@ namespace QuantLib {
     class ObservableSettings : public Singleton<ObservableSettings> {
         friend class Singleton<ObservableSettings>;
         friend class Observable;
+        friend class ObservableUpdateTransaction;
 
       public:
         void disableUpdates(bool deferred=false) {
@@ -418,9 +466,13 @@ namespace QuantLib {
 
         bool updatesEnabled()  {return (updatesType_ & UpdatesEnabled) != 0; }
         bool updatesDeferred() {return (updatesType_ & UpdatesDeferred) != 0; }
+        bool updatesBatched()  {return transactionDepth_ > 0; }
       private:
         ObservableSettings() : updatesType_(UpdatesEnabled) {}
 
+        void beginTransaction();
+        void commitTransaction();
+
         typedef std::set<ext::weak_ptr<Observer::Proxy>,
                          boost::owner_less<ext::weak_ptr<Observer::Proxy> > >
             set_type;
@@ -435,6 +487,10 @@ namespace QuantLib {
 
         enum UpdateType { UpdatesEnabled = 1, UpdatesDeferred = 2} ;
         std::atomic<int> updatesType_;
+
+        std::mutex transactionMutex_;
+        std::atomic<Size> transactionDepth_{0};
+        bool transactionDeferred_ = false;
     };
 
 
@@ -482,6 +538,31 @@ namespace QuantLib {
         }
     }
 
+    /* In the thread-safe implementation the observer graph is hidden
+       behind the signal proxies, so a transaction falls back to
+       deferring the updates and releasing them on commit. */
+    inline void ObservableSettings::beginTransaction() {
+        std::lock_guard<std::mutex> lock(transactionMutex_);
+        if (transactionDepth_++ == 0) {
+            transactionDeferred_ = updatesEnabled();
+            if (transactionDeferred_)
+                disableUpdates(true);
+        }
+    }
+
+    inline void ObservableSettings::commitTransaction() {
+        bool release;
+        {
+            std::lock_guard<std::mutex> lock(transactionMutex_);
+            QL_REQUIRE(transactionDepth_ > 0, "no open update transaction");
+            release = (--transactionDepth_ == 0) && transactionDeferred_;
+            if (release)
+                transactionDeferred_ = false;
+        }
+        if (release)
+            enableUpdates();
+    }
+
 
     /*! \warning notification is sent before the copy constructor has
              a chance of actually change the data
@@ -583,9 +664,82 @@ namespace QuantLib {
         observables_.clear();
     }
 
+    inline std::vector<ext::shared_ptr<Observable> > Observer::observables() const {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return std::vector<ext::shared_ptr<Observable> >(observables_.begin(),
+                                                         observables_.end());
+    }
+
     inline void Observer::deepUpdate() {
         update();
     }
 }
 #endif
+
+namespace QuantLib {
+
+    //! Scoped batch of observer notifications
+    /*! While a transaction is open, the observers notified by any
+        observable are not updated right away; they are collected,
+        without duplicates, and updated when the transaction is
+        committed.  Propagation then proceeds in topological order
+        of the observer graph, so that an observer depending on
+        several modified observables (e.g., a curve bootstrapped on
+        hundreds of quotes) is updated once instead of once per
+        change.
+
+        The transaction is committed either explicitly by calling
+        commit() or implicitly on destruction. Transactions can be
+        nested; only the outermost one propagates the notifications.
+
+        \warning Exceptions raised by observers during the implicit
+                 commit in the destructor are swallowed; call
+                 commit() explicitly to have them reported.
+
+        \note When the thread-safe observer pattern is enabled, the
+              transaction defers the notifications as
+              ObservableSettings::disableUpdates(true) would, and
+              releases them on commit without further deduplication
+              along the graph.
+
+        \ingroup patterns
+    */
+    class ObservableUpdateTransaction {
+      public:
+        ObservableUpdateTransaction();
+        ~ObservableUpdateTransaction();
+        ObservableUpdateTransaction(const ObservableUpdateTransaction&) = delete;
+        ObservableUpdateTransaction& operator=(const ObservableUpdateTransaction&) = delete;
+        //! propagates the collected notifications
+        void commit();
+      private:
+        ObservableSettings& settings_;
+        bool committed_ = false;
+    };
+
+
+    // inline definitions
+
+    inline ObservableUpdateTransaction::ObservableUpdateTransaction()
+    : settings_(ObservableSettings::instance()) {
+        settings_.beginTransaction();
+    }
+
+    inline ObservableUpdateTransaction::~ObservableUpdateTransaction() {
+        try {
+            commit();
+        } catch (...) {
+            // nothing we can do in a destructor
+        }
+    }
+
+    inline void ObservableUpdateTransaction::commit() {
+        if (!committed_) {
+            committed_ = true;
+            settings_.commitTransaction();
+        }
+    }
+
+}
+
 #endif
@@ -559,6 +559,207 @@ namespace QuantLib {
     }
 
 
+    namespace {
+        // cumulative normal via erfc, accurate far in the lower tail
+        Real normalCdf(Real z) {
+            return 0.5*std::erfc(-M_SQRT1_2*z);
+        }
+
+        // normalised Black call price, vega and complement b_max-b
+        // for the log-moneyness x <= 0 and standard deviation s > 0
+        Real normalisedBlackCall(Real x, Real s) {
+            const Real h = x/s, t = 0.5*s;
+            return std::max(Real(0.0), std::exp(0.5*x)*normalCdf(h+t)
+                                       - std::exp(-0.5*x)*normalCdf(h-t));
+        }
+        Real normalisedBlackCallComplement(Real x, Real s) {
+            const Real h = x/s, t = 0.5*s;
+            return std::exp(0.5*x)*normalCdf(-h-t)
+                + std::exp(-0.5*x)*normalCdf(h-t);
+        }
+        Real normalisedVega(Real x, Real s) {
+            const Real h = x/s, t = 0.5*s;
+            return M_SQRT1_2*M_1_SQRTPI*std::exp(-0.5*(h*h+t*t));
+        }
+
+        // implied standard deviation of an out-of-the-money call with
+        // log-moneyness x <= 0 and normalised price 0 <= beta < exp(x/2)
+        Real normalisedImpliedStdDev(Real x, Real beta) {
+            if (beta <= 0.0)
+                return 0.0;
+
+            const Real bMax = std::exp(0.5*x);
+
+            // branch limits around the inflection point sc
+            const Real sc = std::sqrt(2*std::fabs(x));
+            const Real bc = (sc > 0.0) ? normalisedBlackCall(x, sc) : Real(0.0);
+            const Real vc = M_SQRT1_2*M_1_SQRTPI*std::exp(-0.5*std::fabs(x));
+            const Real sl = sc - bc/vc;
+            const Real bl = (sl > 0.0) ? normalisedBlackCall(x, sl) : Real(0.0);
+            const Real su = sc + (bMax - bc)/vc;
+            const Real bu = normalisedBlackCall(x, su);
+
+            enum Branch { Lower, Central, Upper };
+            Branch branch;
+            Real lo, hi, s;
+            if (beta < bl) {
+                branch = Lower;
+                lo = 0.0;
+                hi = sl;
+                // asymptotics of log(b) for small standard deviations
+                s = std::fabs(x)/std::sqrt(-2.0*std::log(beta));
+            } else if (beta <= bu) {
+                branch = Central;
+                lo = std::max(sl, Real(0.0));
+                hi = su;
+                s = 0.5*(lo + hi);
+            } else {
+                branch = Upper;
+                lo = su;
+                hi = QL_MAX_REAL;
+                // asymptotics of b_max-b for large standard deviations
+                s = -2.0*InverseCumulativeNormal()(
+                    (bMax - beta)/(bMax + 1.0/bMax));
+            }
+
+            const Real guess = blackFormulaImpliedStdDevApproximationRS(
+                Option::Call, 1.0/bMax, bMax, beta);
+            if (guess > lo && guess < hi)
+                s = guess;
+            if (!(s > lo && s < hi))
+                s = (hi < QL_MAX_REAL) ? Real(0.5*(lo + hi)) : Real(2.0*lo);
+
+            const Real lnBeta = std::log(beta);
+            // the Householder steps usually converge in two or three
+            // iterations; the extra ones leave room for bisection
+            for (Size iter=0; iter < 100; ++iter) {
+                const Real b = normalisedBlackCall(x, s);
+                const Real vega = normalisedVega(x, s);
+
+                if (b < beta)
+                    lo = std::max(lo, s);
+                else
+                    hi = std::min(hi, s);
+                if (hi - lo <= 4*QL_EPSILON*hi)
+                    return s;
+
+                // derivatives of the normalised price w.r.t. s,
+                // relative to the vega
+                const Real h = x/s;
+                const Real bHalley = h*h/s - 0.25*s;
+                const Real bHh3 = bHalley*bHalley - 3.0*squared(h/s) - 0.25;
+
+                Real newton = Null<Real>(), halley = 0.0, hh3 = 0.0;
+                if (branch == Lower) {
+                    if (b > 0.0 && vega > 0.0) {
+                        const Real lnB = std::log(b), bpob = vega/b;
+                        newton = (lnBeta - lnB)*lnB/lnBeta/bpob;
+                        halley = bHalley - bpob*(1.0 + 2.0/lnB);
+                        hh3 = bHh3 + 2.0*bpob*bpob*(1.0 + 3.0/lnB*(1.0 + 1.0/lnB))
+                            - 3.0*bHalley*bpob*(1.0 + 2.0/lnB);
+                    }
+                } else if (branch == Central) {
+                    if (vega > 0.0) {
+                        newton = (beta - b)/vega;
+                        halley = bHalley;
+                        hh3 = bHh3;
+                    }
+                } else {
+                    const Real bComp = normalisedBlackCallComplement(x, s);
+                    if (bComp > 0.0 && vega > 0.0) {
+                        const Real q = vega/bComp;
+                        newton = (std::log(bComp) - std::log(bMax - beta))/q;
+                        halley = bHalley + q;
+                        hh3 = bHh3 + 2.0*q*q + 3.0*q*bHalley;
+                    }
+                }
+
+                Real sNew = Null<Real>();
+                if (newton != Null<Real>()) {
+                    // third-order Householder step
+                    sNew = s + newton*(1.0 + 0.5*halley*newton)
+                        / (1.0 + newton*(halley + hh3*newton/6.0));
+                    if (std::fabs(sNew - s) <= 4*QL_EPSILON*s)
+                        return sNew;
+                }
+                // fall back to bisection if the step leaves the bracket
+                if (!(sNew > lo && sNew < hi))
+                    sNew = (hi < QL_MAX_REAL) ? Real(0.5*(lo + hi)) : Real(2.0*lo);
+                s = sNew;
+            }
+            QL_FAIL("implied standard deviation did not converge for "
+                    "log-moneyness " << x << " and normalised price " << beta
+                    << ", last bracket [" << lo << ", " << hi << "]");
+        }
+
+        // undiscounted price, displaced strike and forward are assumed
+        Real impliedStdDevJaeckel(Option::Type optionType,
+                                  Real strike,
+                                  Real forward,
+                                  Real undiscountedPrice) {
+            QL_REQUIRE(strike > 0.0, "strike + displacement ("
+                       << strike << ") must be positive");
+
+            const Real x = std::log(forward/strike);
+            Real beta = undiscountedPrice/std::sqrt(forward*strike);
+            auto theta = Integer(optionType);
+
+            // switch to the out-of-the-money option by put-call parity
+            if (theta*x > 0.0) {
+                const Real intrinsic = theta*2.0*std::sinh(0.5*x);
+                beta -= intrinsic;
+                // allow for rounding errors at the intrinsic value
+                if (beta < 0.0 && beta >= -4*QL_EPSILON*intrinsic)
+                    beta = 0.0;
+                QL_REQUIRE(beta >= 0.0,
+                           "option price (" << undiscountedPrice
+                           << ") below intrinsic value for "
+                           << optionType << " strike " << strike
+                           << ", forward " << forward);
+                theta = -theta;
+            }
+
+            // a put with log-moneyness x is a call with log-moneyness -x
+            const Real xCall = (theta > 0) ? x : Real(-x);
+            QL_REQUIRE(beta < std::exp(0.5*xCall),
+                       "option price (" << undiscountedPrice
+                       << ") not below its upper bound for "
+                       << optionType << " strike " << strike
+                       << ", forward " << forward);
+
+            return normalisedImpliedStdDev(xCall, beta);
+        }
+    }
+
+    Real blackFormulaImpliedStdDevJaeckel(Option::Type optionType,
+                                          Real strike,
+                                          Real forward,
+                                          Real blackPrice,
+                                          Real discount,
+                                          Real displacement) {
+        checkParameters(strike, forward, displacement);
+        QL_REQUIRE(discount>0.0,
+                   "discount (" << discount << ") must be positive");
+        QL_REQUIRE(blackPrice>=0.0,
+                   "option price (" << blackPrice << ") must be non-negative");
+
+        return impliedStdDevJaeckel(optionType, strike + displacement,
+                                    forward + displacement,
+                                    blackPrice/discount);
+    }
+
+    Real blackFormulaImpliedStdDevJaeckel(
+                        const ext::shared_ptr<PlainVanillaPayoff>& payoff,
+                        Real forward,
+                        Real blackPrice,
+                        Real discount,
+                        Real displacement) {
+        return blackFormulaImpliedStdDevJaeckel(
+            payoff->optionType(), payoff->strike(),
+            forward, blackPrice, discount, displacement);
+    }
+
+
     Real blackFormulaCashItmProbability(Option::Type optionType,
                                         Real strike,
                                         Real forward,
@@ -794,43 +995,52 @@ namespace QuantLib {
 
     }
 
-    Real bachelierBlackFormulaImpliedVol(Option::Type optionType,
-                                   Real strike,
-                                   Real forward,
-                                   Real tte,
-                                   Real bachelierPrice,
-                                   Real discount) {
-
-        const static Real SQRT_QL_EPSILON = std::sqrt(QL_EPSILON);
+    namespace {
+        // tte > 0 is assumed
+        Real bachelierImpliedVolApproximation(Option::Type optionType,
+                                              Real strike,
+                                              Real forward,
+                                              Real tte,
+                                              Real forwardPremium) {
+            const static Real SQRT_QL_EPSILON = std::sqrt(QL_EPSILON);
 
-        QL_REQUIRE(tte>0.0,
-                   "tte (" << tte << ") must be positive");
+            Real straddlePremium;
+            if (optionType==Option::Call){
+                straddlePremium = 2.0 * forwardPremium - (forward - strike);
+            } else {
+                straddlePremium = 2.0 * forwardPremium + (forward - strike);
+            }
 
-        Real forwardPremium = bachelierPrice/discount;
+            Real nu = (forward - strike) / straddlePremium;
+            QL_REQUIRE(nu<1.0 || close_enough(nu,1.0),
+                       "nu (" << nu << ") must be <= 1.0");
+            QL_REQUIRE(nu>-1.0 || close_enough(nu,-1.0),
+                         "nu (" << nu << ") must be >= -1.0");
 
-        Real straddlePremium;
-        if (optionType==Option::Call){
-            straddlePremium = 2.0 * forwardPremium - (forward - strike);
-        } else {
-            straddlePremium = 2.0 * forwardPremium + (forward - strike);
-        }
+            nu = std::max(-1.0 + QL_EPSILON, std::min(nu,1.0 - QL_EPSILON));
 
-        Real nu = (forward - strike) / straddlePremium;
-        QL_REQUIRE(nu<1.0 || close_enough(nu,1.0),
-                   "nu (" << nu << ") must be <= 1.0");
-        QL_REQUIRE(nu>-1.0 || close_enough(nu,-1.0),
-                     "nu (" << nu << ") must be >= -1.0");
+            // nu / arctanh(nu) -> 1 as nu -> 0
+            Real eta = (std::fabs(nu) < SQRT_QL_EPSILON) ? 1.0 : Real(nu / boost::math::atanh(nu));
 
-        nu = std::max(-1.0 + QL_EPSILON, std::min(nu,1.0 - QL_EPSILON));
+            Real heta = h(eta);
 
-        // nu / arctanh(nu) -> 1 as nu -> 0
-        Real eta = (std::fabs(nu) < SQRT_QL_EPSILON) ? 1.0 : Real(nu / boost::math::atanh(nu));
+            Real impliedBpvol = std::sqrt(M_PI / (2 * tte)) * straddlePremium * heta;
 
-        Real heta = h(eta);
+            return impliedBpvol;
+        }
+    }
 
-        Real impliedBpvol = std::sqrt(M_PI / (2 * tte)) * straddlePremium * heta;
+    Real bachelierBlackFormulaImpliedVol(Option::Type optionType,
+                                   Real strike,
+                                   Real forward,
+                                   Real tte,
+                                   Real bachelierPrice,
+                                   Real discount) {
+        QL_REQUIRE(tte>0.0,
+                   "tte (" << tte << ") must be positive");
 
-        return impliedBpvol;
+        return bachelierImpliedVolApproximation(optionType, strike, forward,
+                                                tte, bachelierPrice/discount);
     }
 
 
@@ -883,4 +1093,273 @@ namespace QuantLib {
         return bachelierBlackFormulaAssetItmProbability(payoff->optionType(),
             payoff->strike(), forward, stdDev);
     }
+
+    namespace {
+        void checkChain(const std::vector<Option::Type>& optionTypes,
+                        const Array& strikes,
+                        const Array& values) {
+            QL_REQUIRE(optionTypes.size() == strikes.size(),
+                       "number of option types (" << optionTypes.size()
+                       << ") differs from number of strikes ("
+                       << strikes.size() << ")");
+            QL_REQUIRE(values.size() == strikes.size(),
+                       "number of values (" << values.size()
+                       << ") differs from number of strikes ("
+                       << strikes.size() << ")");
+        }
+
+        void checkBlackChain(const Array& strikes,
+                             Real forward,
+                             const Array& stdDevs,
+                             Real discount,
+                             Real displacement) {
+            QL_REQUIRE(stdDevs.size() == strikes.size(),
+                       "number of stdDevs (" << stdDevs.size()
+                       << ") differs from number of strikes ("
+                       << strikes.size() << ")");
+            QL_REQUIRE(discount>0.0,
+                       "discount (" << discount << ") must be positive");
+            for (Size i=0; i < strikes.size(); ++i) {
+                checkParameters(strikes[i], forward, displacement);
+                QL_REQUIRE(stdDevs[i]>=0.0,
+                           "stdDev (" << stdDevs[i] << ") must be non-negative");
+            }
+        }
+
+        void checkBachelierChain(const Array& strikes,
+                                 const Array& stdDevs,
+                                 Real discount) {
+            QL_REQUIRE(stdDevs.size() == strikes.size(),
+                       "number of stdDevs (" << stdDevs.size()
+                       << ") differs from number of strikes ("
+                       << strikes.size() << ")");
+            QL_REQUIRE(discount>0.0,
+                       "discount (" << discount << ") must be positive");
+            for (Real stdDev : stdDevs)
+                QL_REQUIRE(stdDev>=0.0,
+                           "stdDev (" << stdDev << ") must be non-negative");
+        }
+    }
+
+    Array blackFormula(const std::vector<Option::Type>& optionTypes,
+                       const Array& strikes,
+                       Real forward,
+                       const Array& stdDevs,
+                       Real discount,
+                       Real displacement) {
+        checkChain(optionTypes, strikes, stdDevs);
+        checkBlackChain(strikes, forward, stdDevs, discount, displacement);
+
+        const Real f = forward + displacement;
+        const CumulativeNormalDistribution phi;
+
+        Array result(strikes.size());
+        for (Size i=0; i < strikes.size(); ++i) {
+            const auto sign = Integer(optionTypes[i]);
+            const Real k = strikes[i] + displacement;
+            const Real stdDev = stdDevs[i];
+
+            if (stdDev == 0.0) {
+                result[i] = std::max((f-k)*sign, Real(0.0))*discount;
+            } else if (k == 0.0) {
+                result[i] = (sign > 0) ? Real(f*discount) : 0.0;
+            } else {
+                const Real d1 = std::log(f/k)/stdDev + 0.5*stdDev;
+                const Real d2 = d1 - stdDev;
+                result[i] = std::max(Real(0.0), discount * sign
+                                     * (f*phi(sign*d1) - k*phi(sign*d2)));
+            }
+        }
+        return result;
+    }
+
+    Array blackFormulaForwardDerivative(const std::vector<Option::Type>& optionTypes,
+                                        const Array& strikes,
+                                        Real forward,
+                                        const Array& stdDevs,
+                                        Real discount,
+                                        Real displacement) {
+        checkChain(optionTypes, strikes, stdDevs);
+        checkBlackChain(strikes, forward, stdDevs, discount, displacement);
+
+        const Real f = forward + displacement;
+        const CumulativeNormalDistribution phi;
+
+        Array result(strikes.size());
+        for (Size i=0; i < strikes.size(); ++i) {
+            const auto sign = Integer(optionTypes[i]);
+            const Real k = strikes[i] + displacement;
+            const Real stdDev = stdDevs[i];
+
+            if (stdDev == 0.0) {
+                result[i] = ((f-k)*sign > 0.0) ? Real(sign*discount) : 0.0;
+            } else if (k == 0.0) {
+                result[i] = (sign > 0) ? discount : 0.0;
+            } else {
+                const Real d1 = std::log(f/k)/stdDev + 0.5*stdDev;
+                result[i] = sign*phi(sign*d1)*discount;
+            }
+        }
+        return result;
+    }
+
+    Array blackFormulaStdDevDerivative(const Array& strikes,
+                                       Real forward,
+                                       const Array& stdDevs,
+                                       Real discount,
+                                       Real displacement) {
+        checkBlackChain(strikes, forward, stdDevs, discount, displacement);
+
+        const Real f = forward + displacement;
+        const CumulativeNormalDistribution phi;
+
+        Array result(strikes.size());
+        for (Size i=0; i < strikes.size(); ++i) {
+            const Real k = strikes[i] + displacement;
+            const Real stdDev = stdDevs[i];
+
+            if (stdDev == 0.0 || k == 0.0) {
+                result[i] = 0.0;
+            } else {
+                const Real d1 = std::log(f/k)/stdDev + 0.5*stdDev;
+                result[i] = discount*f*phi.derivative(d1);
+            }
+        }
+        return result;
+    }
+
+    Array blackFormulaImpliedStdDevJaeckel(const std::vector<Option::Type>& optionTypes,
+                                           const Array& strikes,
+                                           Real forward,
+                                           const Array& blackPrices,
+                                           Real discount,
+                                           Real displacement) {
+        checkChain(optionTypes, strikes, blackPrices);
+        QL_REQUIRE(discount>0.0,
+                   "discount (" << discount << ") must be positive");
+        for (Size i=0; i < strikes.size(); ++i) {
+            checkParameters(strikes[i], forward, displacement);
+            QL_REQUIRE(blackPrices[i]>=0.0,
+                       "option price (" << blackPrices[i]
+                       << ") must be non-negative");
+        }
+
+        const Real f = forward + displacement;
+
+        Array result(strikes.size());
+        for (Size i=0; i < strikes.size(); ++i)
+            result[i] = impliedStdDevJaeckel(optionTypes[i],
+                                             strikes[i] + displacement, f,
+                                             blackPrices[i]/discount);
+        return result;
+    }
+
+    Array bachelierBlackFormula(const std::vector<Option::Type>& optionTypes,
+                                const Array& strikes,
+                                Real forward,
+                                const Array& stdDevs,
+                                Real discount) {
+        checkChain(optionTypes, strikes, stdDevs);
+        checkBachelierChain(strikes, stdDevs, discount);
+
+        const CumulativeNormalDistribution phi;
+
+        Array result(strikes.size());
+        for (Size i=0; i < strikes.size(); ++i) {
+            const Real d = (forward - strikes[i])*Integer(optionTypes[i]);
+            const Real stdDev = stdDevs[i];
+
+            if (stdDev == 0.0) {
+                result[i] = discount*std::max(d, Real(0.0));
+            } else {
+                const Real h = d/stdDev;
+                result[i] = std::max(Real(0.0), discount
+                                     * (stdDev*phi.derivative(h) + d*phi(h)));
+            }
+        }
+        return result;
+    }
+
+    Array bachelierBlackFormulaForwardDerivative(
+                                const std::vector<Option::Type>& optionTypes,
+                                const Array& strikes,
+                                Real forward,
+                                const Array& stdDevs,
+                                Real discount) {
+        checkChain(optionTypes, strikes, stdDevs);
+        checkBachelierChain(strikes, stdDevs, discount);
+
+        const CumulativeNormalDistribution phi;
+
+        Array result(strikes.size());
+        for (Size i=0; i < strikes.size(); ++i) {
+            const auto sign = Integer(optionTypes[i]);
+            const Real d = (forward - strikes[i])*sign;
+            const Real stdDev = stdDevs[i];
+
+            if (stdDev == 0.0)
+                result[i] = (d > 0.0) ? Real(sign*discount) : 0.0;
+            else
+                result[i] = sign*phi(d/stdDev)*discount;
+        }
+        return result;
+    }
+
+    Array bachelierBlackFormulaStdDevDerivative(const Array& strikes,
+                                                Real forward,
+                                                const Array& stdDevs,
+                                                Real discount) {
+        checkBachelierChain(strikes, stdDevs, discount);
+
+        const CumulativeNormalDistribution phi;
+
+        Array result(strikes.size());
+        for (Size i=0; i < strikes.size(); ++i) {
+            const Real stdDev = stdDevs[i];
+            result[i] = (stdDev == 0.0) ? Real(0.0)
+                : Real(discount*phi.derivative((forward - strikes[i])/stdDev));
+        }
+        return result;
+    }
+
+    Array bachelierBlackFormulaImpliedVol(const std::vector<Option::Type>& optionTypes,
+                                          const Array& strikes,
+                                          Real forward,
+                                          Real tte,
+                                          const Array& bachelierPrices,
+                                          Real discount) {
+        checkChain(optionTypes, strikes, bachelierPrices);
+        QL_REQUIRE(tte>0.0, "tte (" << tte << ") must be positive");
+        QL_REQUIRE(discount>0.0,
+                   "discount (" << discount << ") must be positive");
+
+        const Real sqrtT = std::sqrt(tte);
+        const CumulativeNormalDistribution phi;
+
+        Array result(strikes.size());
+        for (Size i=0; i < strikes.size(); ++i) {
+            Real vol = bachelierImpliedVolApproximation(
+                optionTypes[i], strikes[i], forward, tte,
+                bachelierPrices[i]/discount);
+
+            // Newton steps on the approximation
+            const Real d = (forward - strikes[i])*Integer(optionTypes[i]);
+            for (Size iter=0; iter < 3 && vol > 0.0; ++iter) {
+                const Real stdDev = vol*sqrtT;
+                const Real h = d/stdDev;
+                const Real vega = discount*phi.derivative(h)*sqrtT;
+                const Real price = discount*(stdDev*phi.derivative(h) + d*phi(h));
+                const Real refined = vol - (price - bachelierPrices[i])/vega;
+                if (!(vega > 0.0 && refined > 0.0))
+                    break;
+                const bool converged =
+                    std::fabs(refined - vol) <= 4*QL_EPSILON*refined;
+                vol = refined;
+                if (converged)
+                    break;
+            }
+            result[i] = vol;
+        }
+        return result;
+    }
 }
@@ -19,6 +19,7 @@
 */
 
 #include <ql/cashflows/cashflows.hpp>
+#include <ql/cashflows/staticleg.hpp>
 #include <ql/pricingengines/bond/discountingbondengine.hpp>
 #include <utility>
 
@@ -30,6 +31,7 @@ namespace QuantLib {
     : discountCurve_(std::move(discountCurve)),
       includeSettlementDateFlows_(includeSettlementDateFlows) {
         registerWith(discountCurve_);
+        arguments_.useStaticCashflows = true;
     }
 
     void DiscountingBondEngine::calculate() const {
@@ -42,11 +44,19 @@ namespace QuantLib {
                                        *includeSettlementDateFlows_ :
                                        Settings::instance().includeReferenceDateEvents();
 
-        results_.value = CashFlows::npv(arguments_.cashflows,
-                                        **discountCurve_,
-                                        includeRefDateFlows,
-                                        results_.valuationDate,
-                                        results_.valuationDate);
+        // use the compact representation of the cash flows when available
+        const StaticLeg* staticLeg = arguments_.staticCashflows.get();
+
+        results_.value = staticLeg != nullptr ?
+            staticLeg->npv(**discountCurve_,
+                           includeRefDateFlows,
+                           results_.valuationDate,
+                           results_.valuationDate) :
+            CashFlows::npv(arguments_.cashflows,
+                           **discountCurve_,
+                           includeRefDateFlows,
+                           results_.valuationDate,
+                           results_.valuationDate);
 
         // a bond's cashflow on settlement date is never taken into
         // account, so we might have to play it safe and recalculate
@@ -56,7 +66,11 @@ namespace QuantLib {
             results_.settlementValue = results_.value;
         } else {
             // no such luck
-            results_.settlementValue =
+            results_.settlementValue = staticLeg != nullptr ?
+                staticLeg->npv(**discountCurve_,
+                               false,
+                               arguments_.settlementDate,
+                               arguments_.settlementDate) :
                 CashFlows::npv(arguments_.cashflows,
                                **discountCurve_,
                                false,
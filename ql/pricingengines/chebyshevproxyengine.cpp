@@ -0,0 +1,82 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/pricingengines/chebyshevproxyengine.hpp>
+#include <string>
+
+namespace QuantLib {
+
+    ext::shared_ptr<MultiChebyshevInterpolation> makeChebyshevProxy(
+        const std::vector<Real>& lower,
+        const std::vector<Real>& upper,
+        const std::vector<Size>& nodes,
+        const ext::function<ext::function<Real(const Array&)>()>& pricerFactory,
+        bool parallel QL_UNUSED) {
+
+        const std::vector<Array> x =
+            MultiChebyshevInterpolation::gridPoints(lower, upper, nodes);
+
+        std::vector<Real> values(x.size());
+        std::vector<std::string> failures(x.size());
+
+#ifdef _OPENMP
+#pragma omp parallel if(parallel)
+#endif
+        {
+            // one pricer per thread, created one at a time
+            ext::function<Real(const Array&)> pricer;
+            std::string factoryFailure;
+#ifdef _OPENMP
+#pragma omp critical(chebyshev_proxy_pricer_factory)
+#endif
+            {
+                try {
+                    pricer = pricerFactory();
+                } catch (std::exception& e) {
+                    factoryFailure = e.what();
+                }
+            }
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for (long i=0; i < static_cast<long>(x.size()); ++i) {
+                if (!factoryFailure.empty()) {
+                    failures[i] = factoryFailure;
+                    continue;
+                }
+                try {
+                    values[i] = pricer(x[i]);
+                } catch (std::exception& e) {
+                    failures[i] = e.what();
+                }
+            }
+
+            // the pricer might unregister from shared observables
+#ifdef _OPENMP
+#pragma omp critical(chebyshev_proxy_pricer_factory)
+#endif
+            pricer = ext::function<Real(const Array&)>();
+        }
+        for (const auto& failure : failures)
+            QL_REQUIRE(failure.empty(), failure);
+
+        return ext::make_shared<MultiChebyshevInterpolation>(
+            lower, upper, nodes, values);
+    }
+
+}
@@ -0,0 +1,102 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file chebyshevproxyengine.hpp
+    \brief Pricing engine replaying a Chebyshev proxy of another engine
+*/
+
+#ifndef quantlib_chebyshev_proxy_engine_hpp
+#define quantlib_chebyshev_proxy_engine_hpp
+
+#include <ql/handle.hpp>
+#include <ql/pricingengine.hpp>
+#include <ql/quote.hpp>
+#include <ql/math/interpolations/multichebyshevinterpolation.hpp>
+#include <utility>
+
+namespace QuantLib {
+
+    //! samples a pricing function on a Chebyshev grid
+    /*! The pricer factory returns a function giving the price for a
+        vector of risk factors, e.g., by setting the spot, volatility
+        and rate quotes of an instrument priced by an expensive engine
+        and returning its NPV.
+
+        When parallel sampling is enabled and OpenMP is available, the
+        factory is called once per thread, one call at a time, and
+        each thread prices its share of the grid points with its own
+        function; the functions must therefore not share instruments,
+        quotes or engines.  They are also released one at a time.
+        Otherwise, the factory is called once.
+    */
+    ext::shared_ptr<MultiChebyshevInterpolation> makeChebyshevProxy(
+        const std::vector<Real>& lower,
+        const std::vector<Real>& upper,
+        const std::vector<Size>& nodes,
+        const ext::function<ext::function<Real(const Array&)>()>& pricerFactory,
+        bool parallel = false);
+
+    //! Pricing engine replaying a Chebyshev proxy of another engine
+    /*! The price is read from a proxy built by makeChebyshevProxy()
+        at the current values of the risk-factor quotes, which must
+        be given in the order used for sampling.  The first partial
+        derivatives with respect to the risk factors are returned as
+        the "factorSensitivities" additional result.
+
+        The engine does not check that the instrument matches the one
+        that was sampled.
+
+        \ingroup engines
+    */
+    template <class ArgumentsType, class ResultsType>
+    class ChebyshevProxyEngine
+        : public GenericEngine<ArgumentsType, ResultsType> {
+      public:
+        ChebyshevProxyEngine(ext::shared_ptr<MultiChebyshevInterpolation> proxy,
+                             std::vector<Handle<Quote> > factors)
+        : proxy_(std::move(proxy)), factors_(std::move(factors)) {
+            QL_REQUIRE(proxy_ != nullptr, "no proxy given");
+            QL_REQUIRE(factors_.size() == proxy_->dimension(),
+                       "mismatch between number of risk factors ("
+                       << factors_.size() << ") and proxy dimension ("
+                       << proxy_->dimension() << ")");
+            for (const auto& factor : factors_)
+                this->registerWith(factor);
+        }
+
+        void calculate() const override {
+            Array x(factors_.size());
+            for (Size i=0; i < x.size(); ++i)
+                x[i] = factors_[i]->value();
+
+            this->results_.value = (*proxy_)(x);
+
+            std::vector<Real> sensitivities(x.size());
+            for (Size i=0; i < x.size(); ++i)
+                sensitivities[i] = proxy_->derivative(x, i);
+            this->results_.additionalResults["factorSensitivities"]
+                = sensitivities;
+        }
+
+      private:
+        ext::shared_ptr<MultiChebyshevInterpolation> proxy_;
+        std::vector<Handle<Quote> > factors_;
+    };
+
+}
+
+#endif
@@ -19,6 +19,7 @@
 */
 
 #include <ql/cashflows/cashflows.hpp>
+#include <ql/cashflows/staticleg.hpp>
 #include <ql/pricingengines/swap/discountingswapengine.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <utility>
@@ -34,6 +35,7 @@ namespace QuantLib {
       includeSettlementDateFlows_(includeSettlementDateFlows), settlementDate_(settlementDate),
       npvDate_(npvDate) {
         registerWith(discountCurve_);
+        arguments_.useStaticLegs = true;
     }
 
     void DiscountingSwapEngine::calculate() const {
@@ -77,23 +79,35 @@ namespace QuantLib {
         for (Size i=0; i<n; ++i) {
             try {
                 const YieldTermStructure& discount_ref = **discountCurve_;
-                std::tie(results_.legNPV[i], results_.legBPS[i]) =
-                    CashFlows::npvbps(arguments_.legs[i],
-                                      discount_ref,
-                                      includeRefDateFlows,
-                                      settlementDate,
-                                      results_.valuationDate);
+                // use the compact representation of the leg when available
+                const StaticLeg* staticLeg =
+                    i < arguments_.staticLegs.size() ? arguments_.staticLegs[i].get() : nullptr;
+                if (staticLeg != nullptr)
+                    std::tie(results_.legNPV[i], results_.legBPS[i]) =
+                        staticLeg->npvbps(discount_ref,
+                                          includeRefDateFlows,
+                                          settlementDate,
+                                          results_.valuationDate);
+                else
+                    std::tie(results_.legNPV[i], results_.legBPS[i]) =
+                        CashFlows::npvbps(arguments_.legs[i],
+                                          discount_ref,
+                                          includeRefDateFlows,
+                                          settlementDate,
+                                          results_.valuationDate);
                 results_.legNPV[i] *= arguments_.payer[i];
                 results_.legBPS[i] *= arguments_.payer[i];
 
                 if (!arguments_.legs[i].empty()) {
-                    Date d1 = CashFlows::startDate(arguments_.legs[i]);
+                    Date d1 = staticLeg != nullptr ? staticLeg->startDate() :
+                                                     CashFlows::startDate(arguments_.legs[i]);
                     if (d1>=refDate)
                         results_.startDiscounts[i] = discountCurve_->discount(d1);
                     else
                         results_.startDiscounts[i] = Null<DiscountFactor>();
 
-                    Date d2 = CashFlows::maturityDate(arguments_.legs[i]);
+                    Date d2 = staticLeg != nullptr ? staticLeg->maturityDate() :
+                                                     CashFlows::maturityDate(arguments_.legs[i]);
                     if (d2>=refDate)
                         results_.endDiscounts[i] = discountCurve_->discount(d2);
                     else
@@ -89,6 +89,41 @@ namespace QuantLib {
                                  floatSchedule.dates().end(), expiry0 - 1) -
                 floatSchedule.dates().begin();
 
+            // exercise values only depend on state grid values of the
+            // model, which are cached there and shared with other
+            // swaptions on the same dates (e.g. in calibration baskets)
+            Array exerciseValues, numeraires;
+            Real zerobond0 = 0.0;
+            if (expiry0 > settlement) {
+                Array floatingLegNpv(z.size(), 0.0), fixedLegNpv(z.size(), 0.0);
+                for (Size l = k1; l < arguments_.floatingCoupons.size(); l++) {
+                    Array forwards = model_->forwardRate(
+                        arguments_.floatingFixingDates[l], expiry0, z,
+                        arguments_.swap->iborIndex());
+                    Array discounts = model_->zerobond(
+                        arguments_.floatingPayDates[l], expiry0, z, discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        floatingLegNpv[k] += arguments_.nominal *
+                                             arguments_.floatingAccrualTimes[l] *
+                                             (arguments_.floatingSpreads[l] + forwards[k]) *
+                                             discounts[k];
+                }
+                for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
+                    Array discounts = model_->zerobond(
+                        arguments_.fixedPayDates[l], expiry0, z, discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        fixedLegNpv[k] += arguments_.fixedCoupons[l] * discounts[k];
+                }
+                numeraires = model_->numeraire(expiry0Time, z, discountCurve_);
+                exerciseValues = Array(z.size());
+                for (Size k = 0; k < z.size(); k++)
+                    exerciseValues[k] = (type == Option::Call ? 1.0 : -1.0) *
+                                        (floatingLegNpv[k] - fixedLegNpv[k]) /
+                                        numeraires[k];
+                if (probabilities_ != None)
+                    zerobond0 = model_->zerobond(expiry0Time, 0.0, 0.0, discountCurve_);
+            }
+
             // a lazy object is not thread safe, neither is the caching
             // in gsrprocess. therefore we trigger computations here such
             // that neither lazy object recalculation nor write access
@@ -99,20 +134,6 @@ namespace QuantLib {
             if (expiry1Time != Null<Real>())
                 model_->yGrid(stddevs_, integrationPoints_, expiry1Time,
                               expiry0Time, 0.0);
-            if (expiry0 > settlement) {
-                for (Size l = k1; l < arguments_.floatingCoupons.size(); l++) {
-                    model_->forwardRate(arguments_.floatingFixingDates[l],
-                                        expiry0, 0.0,
-                                        arguments_.swap->iborIndex());
-                    model_->zerobond(arguments_.floatingPayDates[l], expiry0,
-                                     0.0, discountCurve_);
-                }
-                for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                    model_->zerobond(arguments_.fixedPayDates[l], expiry0, 0.0,
-                                     discountCurve_);
-                }
-                model_->numeraire(expiry0Time, 0.0, discountCurve_);
-            }
 #endif
 
 #pragma omp parallel for default(shared) firstprivate(p) if(expiry0>settlement)
@@ -250,30 +271,7 @@ namespace QuantLib {
                 // end probability computation
 
                 if (expiry0 > settlement) {
-                    Real floatingLegNpv = 0.0;
-                    for (Size l = k1; l < arguments_.floatingCoupons.size();
-                         l++) {
-                        floatingLegNpv +=
-                            arguments_.nominal *
-                            arguments_.floatingAccrualTimes[l] *
-                            (arguments_.floatingSpreads[l] +
-                             model_->forwardRate(
-                                 arguments_.floatingFixingDates[l], expiry0,
-                                 z[k], arguments_.swap->iborIndex())) *
-                            model_->zerobond(arguments_.floatingPayDates[l],
-                                             expiry0, z[k], discountCurve_);
-                    }
-                    Real fixedLegNpv = 0.0;
-                    for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                        fixedLegNpv +=
-                            arguments_.fixedCoupons[l] *
-                            model_->zerobond(arguments_.fixedPayDates[l],
-                                             expiry0, z[k], discountCurve_);
-                    }
-                    Real exerciseValue =
-                        (type == Option::Call ? 1.0 : -1.0) *
-                        (floatingLegNpv - fixedLegNpv) /
-                        model_->numeraire(expiry0Time, z[k], discountCurve_);
+                    Real exerciseValue = exerciseValues[k];
 
                     // for probability computation
                     if (probabilities_ != None) {
@@ -285,21 +283,12 @@ namespace QuantLib {
                             npvp0.back()[k] =
                                 probabilities_ == Naive
                                     ? Real(1.0)
-                                    : 1.0 / (model_->zerobond(expiry0Time, 0.0,
-                                                              0.0,
-                                                              discountCurve_) *
-                                             model_->numeraire(expiry0, z[k],
-                                                               discountCurve_));
+                                    : 1.0 / (zerobond0 * numeraires[k]);
                         if (exerciseValue >= npv0[k]) {
                             npvp0[idx - minIdxAlive][k] =
                                 probabilities_ == Naive
                                     ? Real(1.0)
-                                    : 1.0 /
-                                          (model_->zerobond(expiry0Time, 0.0,
-                                                            0.0,
-                                                            discountCurve_) *
-                                           model_->numeraire(expiry0Time, z[k],
-                                                             discountCurve_));
+                                    : 1.0 / (zerobond0 * numeraires[k]);
                             for (Size ii = idx - minIdxAlive + 1;
                                  ii < npvp0.size(); ii++)
                                 npvp0[ii][k] = 0.0;
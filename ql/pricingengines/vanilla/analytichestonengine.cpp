@@ -35,6 +35,7 @@
 #include <ql/math/functional.hpp>
 #include <ql/pricingengines/blackcalculator.hpp>
 #include <ql/pricingengines/vanilla/analytichestonengine.hpp>
+#include <algorithm>
 #include <utility>
 
 #if defined(QL_PATCH_MSVC)
@@ -116,6 +117,61 @@ namespace QuantLib {
             const Real v0T2_, logEpsilon_;
             mutable Size evaluations_ = 0;
         };
+
+
+        // characteristic function together with the derivatives of its
+        // logarithm with respect to theta, kappa, sigma, rho and v0
+        std::complex<Real> chFWithLogDerivatives(
+            const std::complex<Real>& z, Time t,
+            Real theta, Real kappa, Real sigma, Real rho, Real v0,
+            std::complex<Real> derivatives[5]) {
+
+            typedef std::complex<Real> Complex;
+
+            const Real sigma2 = sigma*sigma;
+            const Complex iz(-z.imag(), z.real());
+
+            const Complex g = kappa - rho*sigma*iz;
+            const Complex a = z*z + iz;
+            const Complex D = std::sqrt(g*g + a*sigma2);
+            const Complex m = g - D;
+            const Complex n = g + D;
+            const Complex G = m/n;
+            const Complex e = std::exp(-D*t);
+            const Complex l = 1.0 - G*e;
+
+            // log(chF) = v0*A + kappa*theta*B
+            const Complex A = m*(1.0-e)/(sigma2*l);
+            const Complex B = (m*t - 2.0*std::log(l/(1.0-G)))/sigma2;
+
+            // partial derivatives of A and B with respect to g and sigma^2
+            Complex dA[2], dB[2];
+            for (Size x=0; x<2; ++x) {
+                const Complex dD = (x == 0) ? Complex(g/D) : Complex(0.5*a/D);
+                const Real dg = (x == 0) ? 1.0 : 0.0;
+                const Complex dm = dg - dD;
+                const Complex dn = dg + dD;
+                const Complex dG = (dm*n - m*dn)/(n*n);
+                const Complex de = -t*e*dD;
+                const Complex dl = -(dG*e + G*de);
+
+                dA[x] = (dm*(1.0-e) - m*de)/(sigma2*l) - A*dl/l;
+                dB[x] = (dm*t - 2.0*(dl/l + dG/(1.0-G)))/sigma2;
+            }
+            dA[1] -= A/sigma2;
+            dB[1] -= B/sigma2;
+
+            const Complex dg = v0*dA[0] + kappa*theta*dB[0];
+            const Complex dSigma2 = v0*dA[1] + kappa*theta*dB[1];
+
+            derivatives[0] = kappa*B;
+            derivatives[1] = dg + theta*B;
+            derivatives[2] = -rho*iz*dg + 2.0*sigma*dSigma2;
+            derivatives[3] = -sigma*iz*dg;
+            derivatives[4] = A;
+
+            return std::exp(v0*A + kappa*theta*B);
+        }
     }
 
     // helper class for integration
@@ -156,6 +212,10 @@ namespace QuantLib {
 
       Real operator()(Real phi) const;
 
+      //! complex term whose imaginary part, divided by phi, is
+      //! returned by operator() for the Gatheral formula and phi != 0
+      std::complex<Real> gatheralChF(Real phi) const;
+
     private:
         const Size j_;
         //     const VanillaOption::arguments& arg_;
@@ -243,7 +303,8 @@ namespace QuantLib {
       engine_(nullptr) {}
 
 
-    Real AnalyticHestonEngine::Fj_Helper::operator()(Real phi) const
+    std::complex<Real>
+    AnalyticHestonEngine::Fj_Helper::gatheralChF(Real phi) const
     {
         const Real rpsig(rsigma_*phi);
 
@@ -255,33 +316,38 @@ namespace QuantLib {
         const std::complex<Real> addOnTerm =
             engine_ != nullptr ? engine_->addOnTerm(phi, term_, j_) : Real(0.0);
 
+        if (sigma_ > 1e-5) {
+            const std::complex<Real> p = (t1-d)/(t1+d);
+            const std::complex<Real> g
+                                    = std::log((1.0 - p*ex)/(1.0 - p));
+
+            return
+                std::exp(v0_*(t1-d)*(1.0-ex)/(sigma2_*(1.0-ex*p))
+                         + (kappa_*theta_)/sigma2_*((t1-d)*term_-2.0*g)
+                         + std::complex<Real>(0.0, phi*(dd_-sx_))
+                         + addOnTerm
+                         );
+        }
+        else {
+            const std::complex<Real> td = phi/(2.0*t1)
+                           *std::complex<Real>(-phi, (j_== 1)? 1 : -1);
+            const std::complex<Real> p = td*sigma2_/(t1+d);
+            const std::complex<Real> g = p*(1.0-ex);
+
+            return
+                std::exp(v0_*td*(1.0-ex)/(1.0-p*ex)
+                         + (kappa_*theta_)*(td*term_-2.0*g/sigma2_)
+                         + std::complex<Real>(0.0, phi*(dd_-sx_))
+                         + addOnTerm
+                         );
+        }
+    }
+
+    Real AnalyticHestonEngine::Fj_Helper::operator()(Real phi) const
+    {
         if (cpxLog_ == Gatheral) {
             if (phi != 0.0) {
-                if (sigma_ > 1e-5) {
-                    const std::complex<Real> p = (t1-d)/(t1+d);
-                    const std::complex<Real> g
-                                            = std::log((1.0 - p*ex)/(1.0 - p));
-
-                    return
-                        std::exp(v0_*(t1-d)*(1.0-ex)/(sigma2_*(1.0-ex*p))
-                                 + (kappa_*theta_)/sigma2_*((t1-d)*term_-2.0*g)
-                                 + std::complex<Real>(0.0, phi*(dd_-sx_))
-                                 + addOnTerm
-                                 ).imag()/phi;
-                }
-                else {
-                    const std::complex<Real> td = phi/(2.0*t1)
-                                   *std::complex<Real>(-phi, (j_== 1)? 1 : -1);
-                    const std::complex<Real> p = td*sigma2_/(t1+d);
-                    const std::complex<Real> g = p*(1.0-ex);
-
-                    return
-                        std::exp(v0_*td*(1.0-ex)/(1.0-p*ex)
-                                 + (kappa_*theta_)*(td*term_-2.0*g/sigma2_)
-                                 + std::complex<Real>(0.0, phi*(dd_-sx_))
-                                 + addOnTerm
-                                 ).imag()/phi;
-                }
+                return gatheralChF(phi).imag()/phi;
             }
             else {
                 // use l'Hospital's rule to get lim_{phi->0}
@@ -307,6 +373,16 @@ namespace QuantLib {
             }
         }
         else if (cpxLog_ == BranchCorrection) {
+            const Real rpsig(rsigma_*phi);
+
+            const std::complex<Real> t1 = t0_+std::complex<Real>(0, -rpsig);
+            const std::complex<Real> d =
+                std::sqrt(t1*t1 - sigma2_*phi
+                          *std::complex<Real>(-phi, (j_== 1)? 1 : -1));
+            const std::complex<Real> ex = std::exp(-d*term_);
+            const std::complex<Real> addOnTerm =
+                engine_ != nullptr ? engine_->addOnTerm(phi, term_, j_) : Real(0.0);
+
             const std::complex<Real> p = (t1+d)/(t1-d);
 
             // next term: g = std::log((1.0 - p*std::exp(d*term_))/(1.0 - p))
@@ -361,6 +437,19 @@ namespace QuantLib {
     }
 
 
+    // values of the characteristic function on the integration nodes
+    class AnalyticHestonEngine::ChFNodes {
+      public:
+        // formula actually used, i.e., with the optimal control
+        // variate already selected
+        ComplexLogFormula cpxLog;
+        std::vector<Real> u, w;
+        // Gatheral: integrands of P_1 and P_2 at unit forward and strike;
+        // Andersen-Piterbarg: difference to the control variate
+        std::vector<std::complex<Real> > f1, f2;
+    };
+
+
     AnalyticHestonEngine::AP_Helper::AP_Helper(
         Time term, Real fwd, Real strike, ComplexLogFormula cpxLog,
         const AnalyticHestonEngine* const enginePtr)
@@ -405,6 +494,12 @@ namespace QuantLib {
     }
 
     Real AnalyticHestonEngine::AP_Helper::operator()(Real u) const {
+        return (std::exp(std::complex<Real>(0.0, u*freq_))
+            * chFDifference(u) / (u*u + 0.25)).real();
+    }
+
+    std::complex<Real>
+    AnalyticHestonEngine::AP_Helper::chFDifference(Real u) const {
         QL_REQUIRE(   enginePtr_->addOnTerm(u, term_, 1)
                         == std::complex<Real>(0.0)
                    && enginePtr_->addOnTerm(u, term_, 2)
@@ -428,8 +523,7 @@ namespace QuantLib {
             QL_FAIL("unknown control variate");
         }
 
-        return (std::exp(std::complex<Real>(0.0, u*freq_))
-            * (phiBS - enginePtr_->chF(z, term_)) / (u*u + 0.25)).real();
+        return phiBS - enginePtr_->chF(z, term_);
     }
 
     Real AnalyticHestonEngine::AP_Helper::controlVariateValue() const {
@@ -676,6 +770,13 @@ namespace QuantLib {
             ext::dynamic_pointer_cast<PlainVanillaPayoff>(arguments_.payoff);
         QL_REQUIRE(payoff, "non plain vanilla payoff given");
 
+        if (cacheChF_ && nodesCanBeShared()) {
+            results_.value = prices(arguments_.exercise->lastDate(),
+                                    std::vector<ext::shared_ptr<PlainVanillaPayoff> >(
+                                        1, payoff)).front();
+            return;
+        }
+
         const ext::shared_ptr<HestonProcess>& process = model_->process();
 
         const Real riskFreeDiscount = process->riskFreeRate()->discount(
@@ -708,6 +809,264 @@ namespace QuantLib {
     }
 
 
+    void AnalyticHestonEngine::enableChFCaching(bool b) {
+        QL_REQUIRE(!b || chFDependsOnModelOnly(),
+                   "characteristic-function caching not supported "
+                   "by this engine");
+        cacheChF_ = b;
+        if (!cacheChF_)
+            cachedChFNodes_.clear();
+    }
+
+    bool AnalyticHestonEngine::nodesCanBeShared() const {
+        return integration_->isGaussianQuadrature()
+            && cpxLog_ != BranchCorrection
+            && chFDependsOnModelOnly();
+    }
+
+    ext::shared_ptr<AnalyticHestonEngine::ChFNodes>
+    AnalyticHestonEngine::chFNodes(Time term) const {
+        if (cacheChF_) {
+            const Array params = model_->params();
+            if (params.size() != cachedParams_.size()
+                || !std::equal(params.begin(), params.end(),
+                               cachedParams_.begin())) {
+                cachedChFNodes_.clear();
+                cachedParams_ = params;
+            } else {
+                const auto iter = cachedChFNodes_.find(term);
+                if (iter != cachedChFNodes_.end())
+                    return iter->second;
+            }
+        }
+
+        const Real kappa = model_->kappa();
+        const Real theta = model_->theta();
+        const Real sigma = model_->sigma();
+        const Real v0    = model_->v0();
+        const Real rho   = model_->rho();
+
+        const ext::shared_ptr<ChFNodes> nodes = ext::make_shared<ChFNodes>();
+        nodes->cpxLog = (cpxLog_ == OptimalCV)
+            ? optimalControlVariate(term, v0, kappa, theta, sigma, rho)
+            : cpxLog_;
+
+        if (nodes->cpxLog == Gatheral) {
+            const Real c_inf = std::min(0.2, std::max(0.0001,
+                std::sqrt(1.0-rho*rho)/sigma))*(v0 + kappa*theta*term);
+            integration_->gaussianNodes(c_inf, nodes->u, nodes->w);
+
+            // unit spot, strike and discount ratio leave out the
+            // strike-dependent phase, which is added when pricing
+            const Fj_Helper f1(kappa, theta, sigma, v0, 1.0, rho, this,
+                               Gatheral, term, 1.0, 1.0, 1);
+            const Fj_Helper f2(kappa, theta, sigma, v0, 1.0, rho, this,
+                               Gatheral, term, 1.0, 1.0, 2);
+
+            nodes->f1.reserve(nodes->u.size());
+            nodes->f2.reserve(nodes->u.size());
+            for (Real u : nodes->u) {
+                nodes->f1.push_back(f1.gatheralChF(u));
+                nodes->f2.push_back(f2.gatheralChF(u));
+            }
+            evaluations_ += 2*nodes->u.size();
+        }
+        else {
+            const Real c_inf =
+                std::sqrt(1.0-rho*rho)*(v0 + kappa*theta*term)/sigma;
+            integration_->gaussianNodes(c_inf, nodes->u, nodes->w);
+
+            const AP_Helper helper(term, 1.0, 1.0, nodes->cpxLog, this);
+
+            nodes->f1.reserve(nodes->u.size());
+            for (Real u : nodes->u)
+                nodes->f1.push_back(helper.chFDifference(u));
+            evaluations_ += nodes->u.size();
+        }
+
+        if (cacheChF_)
+            cachedChFNodes_[term] = nodes;
+
+        return nodes;
+    }
+
+    std::vector<Real> AnalyticHestonEngine::prices(
+        const Date& maturity,
+        const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs) const {
+
+        const ext::shared_ptr<HestonProcess>& process = model_->process();
+
+        const Real riskFreeDiscount =
+            process->riskFreeRate()->discount(maturity);
+        const Real dividendDiscount =
+            process->dividendYield()->discount(maturity);
+
+        const Real spotPrice = process->s0()->value();
+        QL_REQUIRE(spotPrice > 0.0, "negative or null underlying given");
+
+        const Time term = process->time(maturity);
+
+        for (const auto& payoff : payoffs)
+            QL_REQUIRE(payoff, "null payoff given");
+
+        std::vector<Real> values(payoffs.size());
+        evaluations_ = 0;
+
+        if (!nodesCanBeShared()) {
+            for (Size i=0; i<payoffs.size(); ++i) {
+                Size evaluations;
+                doCalculation(riskFreeDiscount, dividendDiscount, spotPrice,
+                              payoffs[i]->strike(), term,
+                              model_->kappa(), model_->theta(),
+                              model_->sigma(), model_->v0(), model_->rho(),
+                              *payoffs[i], *integration_, cpxLog_, this,
+                              values[i], evaluations);
+                evaluations_ += evaluations;
+            }
+            return values;
+        }
+
+        const ext::shared_ptr<ChFNodes> nodes = chFNodes(term);
+        const std::vector<Real>& u = nodes->u;
+        const std::vector<Real>& w = nodes->w;
+
+        const Real fwdPrice = spotPrice*dividendDiscount/riskFreeDiscount;
+
+        for (Size i=0; i<payoffs.size(); ++i) {
+            const Real strikePrice = payoffs[i]->strike();
+            const Real freq = std::log(fwdPrice/strikePrice);
+
+            if (nodes->cpxLog == Gatheral) {
+                Real p1 = 0.0, p2 = 0.0;
+                for (Size k=0; k<u.size(); ++k) {
+                    const std::complex<Real> phase =
+                        std::exp(std::complex<Real>(0.0, u[k]*freq));
+                    p1 += w[k]*(nodes->f1[k]*phase).imag()/u[k];
+                    p2 += w[k]*(nodes->f2[k]*phase).imag()/u[k];
+                }
+                p1 /= M_PI;
+                p2 /= M_PI;
+
+                switch (payoffs[i]->optionType()) {
+                  case Option::Call:
+                    values[i] = spotPrice*dividendDiscount*(p1+0.5)
+                        - strikePrice*riskFreeDiscount*(p2+0.5);
+                    break;
+                  case Option::Put:
+                    values[i] = spotPrice*dividendDiscount*(p1-0.5)
+                        - strikePrice*riskFreeDiscount*(p2-0.5);
+                    break;
+                  default:
+                    QL_FAIL("unknown option type");
+                }
+            }
+            else {
+                Real h = 0.0;
+                for (Size k=0; k<u.size(); ++k) {
+                    h += w[k]*(std::exp(std::complex<Real>(0.0, u[k]*freq))
+                               * nodes->f1[k]).real()/(u[k]*u[k] + 0.25);
+                }
+
+                const Real cvValue = AP_Helper(term, fwdPrice, strikePrice,
+                                               nodes->cpxLog, this)
+                    .controlVariateValue();
+                const Real h_cv = h*std::sqrt(strikePrice*fwdPrice)/M_PI;
+
+                switch (payoffs[i]->optionType()) {
+                  case Option::Call:
+                    values[i] = (cvValue + h_cv)*riskFreeDiscount;
+                    break;
+                  case Option::Put:
+                    values[i] = (cvValue + h_cv - (fwdPrice - strikePrice))
+                        *riskFreeDiscount;
+                    break;
+                  default:
+                    QL_FAIL("unknown option type");
+                }
+            }
+        }
+
+        return values;
+    }
+
+
+    Array AnalyticHestonEngine::priceSensitivities(
+        const Date& maturity, const PlainVanillaPayoff& payoff) const {
+
+        const ext::shared_ptr<HestonProcess>& process = model_->process();
+
+        const Real riskFreeDiscount =
+            process->riskFreeRate()->discount(maturity);
+        const Real dividendDiscount =
+            process->dividendYield()->discount(maturity);
+
+        const Real spotPrice = process->s0()->value();
+        QL_REQUIRE(spotPrice > 0.0, "negative or null underlying given");
+
+        const Time term = process->time(maturity);
+        const Real strikePrice = payoff.strike();
+        const Real fwdPrice = spotPrice*dividendDiscount/riskFreeDiscount;
+        const Real freq = std::log(fwdPrice/strikePrice);
+
+        const Real kappa = model_->kappa();
+        const Real theta = model_->theta();
+        const Real sigma = model_->sigma();
+        const Real v0    = model_->v0();
+        const Real rho   = model_->rho();
+
+        QL_REQUIRE(sigma > 1e-4,
+                   "price sensitivities require sigma > 1e-4");
+        QL_REQUIRE(   addOnTerm(1.0, term, 1) == std::complex<Real>(0.0)
+                   && addOnTerm(1.0, term, 2) == std::complex<Real>(0.0),
+                   "only Heston model is supported");
+
+        // Lewis' formula: the price is an integral over
+        // Re(exp(i*u*freq)*chF(u-i/2))/(u^2+1/4); puts and calls
+        // share the sensitivities since the forward does not depend
+        // on the model parameters
+        const Real c_inf =
+            std::sqrt(1.0-rho*rho)*(v0 + kappa*theta*term)/sigma;
+        const Real factor =
+            -riskFreeDiscount*std::sqrt(strikePrice*fwdPrice)/M_PI;
+
+        Array sensitivities(5, 0.0);
+        std::complex<Real> derivatives[5];
+
+        if (integration_->isGaussianQuadrature()) {
+            std::vector<Real> u, w;
+            integration_->gaussianNodes(c_inf, u, w);
+
+            for (Size k=0; k<u.size(); ++k) {
+                const std::complex<Real> phi = chFWithLogDerivatives(
+                    std::complex<Real>(u[k], -0.5), term,
+                    theta, kappa, sigma, rho, v0, derivatives);
+                const std::complex<Real> f =
+                    std::exp(std::complex<Real>(0.0, u[k]*freq))*phi
+                    * (w[k]/(u[k]*u[k] + 0.25));
+                for (Size i=0; i<5; ++i)
+                    sensitivities[i] += (f*derivatives[i]).real();
+            }
+            evaluations_ = u.size();
+        }
+        else {
+            evaluations_ = 0;
+            for (Size i=0; i<5; ++i) {
+                sensitivities[i] = integration_->calculate(c_inf,
+                    [&](Real u) -> Real {
+                        const std::complex<Real> phi = chFWithLogDerivatives(
+                            std::complex<Real>(u, -0.5), term,
+                            theta, kappa, sigma, rho, v0, derivatives);
+                        return (std::exp(std::complex<Real>(0.0, u*freq))
+                                * phi*derivatives[i]).real()/(u*u + 0.25);
+                    });
+                evaluations_ += integration_->numberOfEvaluations();
+            }
+        }
+
+        return sensitivities*factor;
+    }
+
+
     AnalyticHestonEngine::Integration::Integration(Algorithm intAlgo,
                                                    ext::shared_ptr<Integrator> integrator)
     : intAlgo_(intAlgo), integrator_(std::move(integrator)) {}
@@ -808,6 +1167,38 @@ namespace QuantLib {
         }
     }
 
+    bool AnalyticHestonEngine::Integration::isGaussianQuadrature() const {
+        return intAlgo_ == GaussLaguerre
+            || intAlgo_ == GaussLegendre
+            || intAlgo_ == GaussChebyshev
+            || intAlgo_ == GaussChebyshev2nd;
+    }
+
+    void AnalyticHestonEngine::Integration::gaussianNodes(
+        Real c_inf, std::vector<Real>& nodes, std::vector<Real>& weights) const {
+        QL_REQUIRE(isGaussianQuadrature(), "Gaussian quadrature required");
+
+        const Array& x = gaussianQuadrature_->x();
+        const Array& w = gaussianQuadrature_->weights();
+
+        nodes.clear();
+        weights.clear();
+        nodes.reserve(x.size());
+        weights.reserve(x.size());
+
+        for (Size i=0; i<x.size(); ++i) {
+            if (intAlgo_ == GaussLaguerre) {
+                nodes.push_back(x[i]);
+                weights.push_back(w[i]);
+            }
+            // same transformation as in integrand1
+            else if ((1.0-x[i])*c_inf > QL_EPSILON) {
+                nodes.push_back(-std::log(0.5-0.5*x[i])/c_inf);
+                weights.push_back(w[i]/((1.0-x[i])*c_inf));
+            }
+        }
+    }
+
     bool AnalyticHestonEngine::Integration::isAdaptiveIntegration() const {
         return intAlgo_ == GaussLobatto
             || intAlgo_ == GaussKronrod
@@ -30,9 +30,12 @@
 #include <ql/math/integrals/gaussianquadratures.hpp>
 #include <ql/pricingengines/genericmodelengine.hpp>
 #include <ql/models/equity/hestonmodel.hpp>
+#include <ql/instruments/payoffs.hpp>
 #include <ql/instruments/vanillaoption.hpp>
 #include <ql/functional.hpp>
 #include <complex>
+#include <map>
+#include <vector>
 
 namespace QuantLib {
 
@@ -132,6 +135,32 @@ namespace QuantLib {
         void calculate() const override;
         Size numberOfEvaluations() const;
 
+        // prices plain-vanilla options expiring on the same date.
+        // For Gaussian quadratures together with Gatheral's formula or
+        // the Andersen-Piterbarg control variates, the characteristic
+        // function is evaluated once on the integration nodes and
+        // reused for all strikes; otherwise the options are priced
+        // one by one.
+        std::vector<Real> prices(
+            const Date& maturity,
+            const std::vector<ext::shared_ptr<PlainVanillaPayoff> >& payoffs) const;
+
+        // sensitivities of a plain-vanilla option price with respect to
+        // theta, kappa, sigma, rho and v0, i.e., in the order of
+        // HestonModel::params(), obtained by differentiating the
+        // characteristic function under the Fourier integral.
+        Array priceSensitivities(const Date& maturity,
+                                 const PlainVanillaPayoff& payoff) const;
+
+        // keeps the node values of the characteristic function for each
+        // expiry as long as the model parameters do not change, so that
+        // subsequent calls to calculate() or prices() for other strikes
+        // at the same expiry don't evaluate it again. Useful when many
+        // helpers sharing this engine are calibrated. Not available for
+        // engines whose add-on term depends on more than the model
+        // parameters, see chFDependsOnModelOnly().
+        void enableChFCaching(bool b = true);
+
         static void doCalculation(Real riskFreeDiscount,
                                   Real dividendDiscount,
                                   Real spotPrice,
@@ -163,6 +192,9 @@ namespace QuantLib {
             Real operator()(Real u) const;
             Real controlVariateValue() const;
 
+            //! strike-independent part of the integrand
+            std::complex<Real> chFDifference(Real u) const;
+
           private:
             const Time term_;
             const Real fwd_, strike_, freq_;
@@ -178,14 +210,25 @@ namespace QuantLib {
         virtual std::complex<Real> addOnTerm(Real phi,
                                              Time t,
                                              Size j) const;
+        // whether the characteristic function only depends on the
+        // term and on the parameters of the Heston model, so that
+        // its node values can be shared across strikes and cached
+        virtual bool chFDependsOnModelOnly() const { return true; }
 
       private:
         class Fj_Helper;
+        class ChFNodes;
+
+        bool nodesCanBeShared() const;
+        ext::shared_ptr<ChFNodes> chFNodes(Time term) const;
 
         mutable Size evaluations_;
         const ComplexLogFormula cpxLog_;
         const ext::shared_ptr<Integration> integration_;
         const Real andersenPiterbargEpsilon_;
+        bool cacheChF_ = false;
+        mutable Array cachedParams_;
+        mutable std::map<Time, ext::shared_ptr<ChFNodes> > cachedChFNodes_;
     };
 
 
@@ -227,6 +270,13 @@ namespace QuantLib {
 
         Size numberOfEvaluations() const;
         bool isAdaptiveIntegration() const;
+        bool isGaussianQuadrature() const;
+
+        // nodes and weights of a Gaussian quadrature,
+        // mapped onto the positive real axis
+        void gaussianNodes(Real c_inf,
+                           std::vector<Real>& nodes,
+                           std::vector<Real>& weights) const;
 
       private:
         enum Algorithm
@@ -80,6 +80,8 @@ namespace QuantLib {
 
       protected:
         std::complex<Real> addOnTerm(Real phi, Time t, Size j) const override;
+        // the add-on term depends on the Hull-White model as well
+        bool chFDependsOnModelOnly() const override { return false; }
 
         const ext::shared_ptr<HullWhite> hullWhiteModel_;
 
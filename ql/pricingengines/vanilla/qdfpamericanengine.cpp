@@ -27,6 +27,7 @@
 #include <ql/math/interpolations/chebyshevinterpolation.hpp>
 #include <ql/pricingengines/blackcalculator.hpp>
 #include <ql/pricingengines/vanilla/qdfpamericanengine.hpp>
+#include <map>
 #include <utility>
 #ifndef QL_BOOST_HAS_TANH_SINH
 #    include <ql/math/integrals/gausslobattointegral.hpp>
@@ -426,8 +427,70 @@ namespace QuantLib {
         return scheme;
     }
 
+    std::vector<Real> QdFpAmericanEngine::calculateChain(
+            Option::Type type, const Date& maturity,
+            const std::vector<Real>& strikes) const {
+
+        QL_REQUIRE(type == Option::Put || type == Option::Call,
+                   "unknown option type");
+
+        const Time T = process_->time(maturity);
+        const Real S = process_->x0();
+        const Rate r = -std::log(process_->riskFreeRate()->discount(maturity))/T;
+        const Rate q = -std::log(process_->dividendYield()->discount(maturity))/T;
+
+        QL_REQUIRE(S >= 0, "zero or positive underlying value is required");
+
+        // calls are priced as puts on (K, S, q, r)
+        const bool isPut = (type == Option::Put);
+        const Rate rp = isPut ? r : q;
+        const Rate qp = isPut ? q : r;
+
+        std::vector<Real> npvs(strikes.size());
+        std::map<Volatility, std::vector<Size> > chains;
+        for (Size i=0; i < strikes.size(); ++i) {
+            const Real K = strikes[i];
+            const Volatility vol = process_->blackVolatility()->blackVol(T, K);
+
+            QL_REQUIRE(K >= 0, "zero or positive strike is required");
+            QL_REQUIRE(vol >= 0, "zero or positive volatility is required");
+
+            const Real edgeCaseValue = isPut
+                ? putEdgeCaseValue(S, K, rp, qp, vol, T)
+                : putEdgeCaseValue(K, S, rp, qp, vol, T);
+
+            if (edgeCaseValue != Null<Real>())
+                npvs[i] = edgeCaseValue;
+            else
+                chains[vol].push_back(i);
+        }
+
+        // put prices are homogeneous in spot and strike
+        for (const auto& chain : chains) {
+            const std::vector<Size>& idx = chain.second;
+
+            std::vector<Real> spots(idx.size());
+            for (Size j=0; j < idx.size(); ++j)
+                spots[j] = isPut ? S/strikes[idx[j]] : strikes[idx[j]]/S;
+
+            const std::vector<Real> values =
+                calculatePuts(spots, 1.0, rp, qp, chain.first, T);
+
+            for (Size j=0; j < idx.size(); ++j)
+                npvs[idx[j]] = (isPut ? strikes[idx[j]] : S)*values[j];
+        }
+
+        return npvs;
+    }
+
     Real QdFpAmericanEngine::calculatePut(
             Real S, Real K, Rate r, Rate q, Volatility vol, Time T) const {
+        return calculatePuts(std::vector<Real>(1, S), K, r, q, vol, T)[0];
+    }
+
+    std::vector<Real> QdFpAmericanEngine::calculatePuts(
+            const std::vector<Real>& S, Real K,
+            Rate r, Rate q, Volatility vol, Time T) const {
 
         if (r < 0.0 && q < r)
             QL_FAIL("double-boundary case q<r<0 for a put option is given");
@@ -435,10 +498,12 @@ namespace QuantLib {
         const Real xmax =  QdPlusAmericanEngine::xMax(K, r, q);
         const Size n = iterationScheme_->getNumberOfChebyshevInterpolationNodes();
 
+        // the boundary does not depend on the spot, which is only
+        // used to bracket the initial QD+ guess
         const ext::shared_ptr<ChebyshevInterpolation> interp =
             QdPlusAmericanEngine(
                     process_, n+1, QdPlusAmericanEngine::Halley, 1e-8)
-                .getPutExerciseBoundary(S, K, r, q, vol, T);
+                .getPutExerciseBoundary(S.front(), K, r, q, vol, T);
 
         const Array z = interp->nodes();
         const Array x = 0.5*std::sqrt(T)*(1.0+z);
@@ -503,16 +568,47 @@ namespace QuantLib {
             interp->updateY(y);
         }
 
-        const detail::QdPlusAddOnValue aov(T, S, K, r, q, vol, xmax, interp);
-        const Real addOn =
-           (*iterationScheme_->getExerciseBoundaryToPriceIntegrator())(
-               aov, 0.0, std::sqrt(T));
+        const ext::shared_ptr<Integrator> integrator =
+            iterationScheme_->getExerciseBoundaryToPriceIntegrator();
+        const auto legendreIntegrator =
+            ext::dynamic_pointer_cast<GaussLegendreIntegrator>(integrator);
+
+        std::vector<Real> addOns(S.size(), 0.0);
+        if (legendreIntegrator != nullptr) {
+            // fixed nodes: one boundary evaluation for all spots
+            const detail::QdPlusAddOnValue aov(
+                T, S.front(), K, r, q, vol, xmax, interp);
+            const Array& x_i = legendreIntegrator->getIntegration()->x();
+            const Array& w_i = legendreIntegrator->getIntegration()->weights();
+            const Real c = 0.5*std::sqrt(T);
+
+            for (Integer i = x_i.size()-1; i >= 0; --i) {
+                const Real z = c*x_i[i] + c;
+                const Real b_t = aov.exerciseBoundary(z);
+                for (Size j=0; j < S.size(); ++j)
+                    addOns[j] += w_i[i] * aov(z, b_t, S[j]);
+            }
+            for (Real& addOn : addOns)
+                addOn *= c;
+        }
+        else {
+            for (Size j=0; j < S.size(); ++j) {
+                const detail::QdPlusAddOnValue aov(
+                    T, S[j], K, r, q, vol, xmax, interp);
+                addOns[j] = (*integrator)(aov, 0.0, std::sqrt(T));
+            }
+        }
+
+        std::vector<Real> npvs(S.size());
+        for (Size j=0; j < S.size(); ++j) {
+            const Real europeanValue = BlackCalculator(
+                Option::Put, K, S[j]*std::exp((r-q)*T),
+                vol*std::sqrt(T), std::exp(-r*T)).value();
 
-        const Real europeanValue = BlackCalculator(
-            Option::Put, K, S*std::exp((r-q)*T),
-            vol*std::sqrt(T), std::exp(-r*T)).value();
+            npvs[j] = std::max(europeanValue, 0.0) + std::max(0.0, addOns[j]);
+        }
 
-        return std::max(europeanValue, 0.0) + std::max(0.0, addOn);
+        return npvs;
     }
 
 }
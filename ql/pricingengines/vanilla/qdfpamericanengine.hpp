@@ -131,11 +131,29 @@ namespace QuantLib {
         static ext::shared_ptr<QdFpIterationScheme> accurateScheme();
         static ext::shared_ptr<QdFpIterationScheme> highPrecisionScheme();
 
+        //! prices of an option chain with common type and maturity
+        /*! The exercise boundary depends on the strike only through
+            a scaling factor.  It is therefore solved once for each
+            distinct volatility of the chain and reused across the
+            corresponding strikes.  If the scheme converts the
+            boundary into prices with a Gauss-Legendre rule, the
+            boundary is evaluated once per node for all strikes.
+
+            Market data are read from the process as in calculate().
+        */
+        std::vector<Real> calculateChain(
+            Option::Type type, const Date& maturity,
+            const std::vector<Real>& strikes) const;
+
       protected:
         Real calculatePut(
             Real S, Real K, Rate r, Rate q, Volatility vol, Time T) const override;
 
       private:
+        std::vector<Real> calculatePuts(
+            const std::vector<Real>& S, Real K,
+            Rate r, Rate q, Volatility vol, Time T) const;
+
         const ext::shared_ptr<QdFpIterationScheme> iterationScheme_;
         const FixedPointEquation fpEquation_;
     };
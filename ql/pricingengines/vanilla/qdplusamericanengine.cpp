@@ -129,10 +129,18 @@ namespace QuantLib {
 
 
     Real detail::QdPlusAddOnValue::operator()(Real z) const {
+        return (*this)(z, exerciseBoundary(z), S_);
+    }
+
+    Real detail::QdPlusAddOnValue::exerciseBoundary(Real z) const {
         const Real t = z*z;
         const Real q = (*q_z_)(2*std::sqrt(std::max(0.0, T_-t)/T_) - 1, true);
-        const Real b_t = xmax_*std::exp(-std::sqrt(std::max(0.0, q)));
+        return xmax_*std::exp(-std::sqrt(std::max(0.0, q)));
+    }
 
+    Real detail::QdPlusAddOnValue::operator()(
+        Real z, Real b_t, Real S) const {
+        const Real t = z*z;
         const Real dr = std::exp(-r_*t);
         const Real dq = std::exp(-q_*t);
         const Real v = vol_*std::sqrt(t);
@@ -140,16 +148,16 @@ namespace QuantLib {
         Real r;
         if (v >= QL_EPSILON) {
             if (b_t > QL_EPSILON) {
-                const Real dp = std::log(S_*dq/(b_t*dr))/v + 0.5*v;
-                r = 2*z*(r_*K_*dr*Phi_(-dp+v) - q_*S_*dq*Phi_(-dp));
+                const Real dp = std::log(S*dq/(b_t*dr))/v + 0.5*v;
+                r = 2*z*(r_*K_*dr*Phi_(-dp+v) - q_*S*dq*Phi_(-dp));
             }
             else
                 r = 0.0;
         }
-        else if (close_enough(S_*dq, b_t*dr))
-            r = z*(r_*K_*dr - q_*S_*dq);
-        else if (b_t*dr > S_*dq)
-            r = 2*z*(r_*K_*dr - q_*S_*dq);
+        else if (close_enough(S*dq, b_t*dr))
+            r = z*(r_*K_*dr - q_*S*dq);
+        else if (b_t*dr > S*dq)
+            r = 2*z*(r_*K_*dr - q_*S*dq);
         else
             r = 0.0;
 
@@ -197,6 +205,16 @@ namespace QuantLib {
     Real detail::QdPutCallParityEngine::calculatePutWithEdgeCases(
         Real S, Real K, Rate r, Rate q, Volatility vol, Time T) const {
 
+        const Real edgeCaseValue = putEdgeCaseValue(S, K, r, q, vol, T);
+        if (edgeCaseValue != Null<Real>())
+            return edgeCaseValue;
+
+        return calculatePut(S, K, r, q, vol, T);
+    }
+
+    Real detail::QdPutCallParityEngine::putEdgeCaseValue(
+        Real S, Real K, Rate r, Rate q, Volatility vol, Time T) const {
+
         if (close(K, 0.0))
             return 0.0;
 
@@ -223,7 +241,7 @@ namespace QuantLib {
                 return std::max(npv0, npvT);
         }
 
-        return calculatePut(S, K, r, q, vol, T);
+        return Null<Real>();
     }
 
 
@@ -48,6 +48,10 @@ namespace QuantLib {
             virtual Real calculatePut(
                 Real S, Real K, Rate r, Rate q, Volatility vol, Time T) const = 0;
 
+            //! put value for the edge cases, Null<Real>() otherwise
+            Real putEdgeCaseValue(
+                Real S, Real K, Rate r, Rate q, Volatility vol, Time T) const;
+
             const ext::shared_ptr<GeneralizedBlackScholesProcess> process_;
 
           private:
@@ -67,6 +71,11 @@ namespace QuantLib {
                              ext::shared_ptr<Interpolation> q_z);
 
             Real operator()(Real z) const;
+
+            //! exercise boundary at time to maturity T-z^2
+            Real exerciseBoundary(Real z) const;
+            //! integrand for the spot S given the exercise boundary b_t
+            Real operator()(Real z, Real b_t, Real S) const;
           private:
             const Time T_;
             const Real S_, K_, xmax_;
@@ -222,6 +222,13 @@
 #endif
 // clang-format on
 
+// silence warnings about parameters unused in some configurations
+#if defined(__GNUC__) || defined(__clang__)
+#    define QL_UNUSED __attribute__((__unused__))
+#else
+#    define QL_UNUSED
+#endif
+
 /*! \deprecated Use the noexcept keyword instead.
                 Deprecated in version 1.27.
 */
@@ -41,7 +41,12 @@ template <class Curve> class GlobalBootstrap {
     typedef typename Curve::interpolator_type Interpolator; // Linear, LogLinear, ...
 
   public:
-    GlobalBootstrap(Real accuracy = Null<Real>());
+    /*! The optimizer and end criteria default to a Levenberg-Marquardt
+        minimization with tolerances given by the accuracy.
+    */
+    GlobalBootstrap(Real accuracy = Null<Real>(),
+                    ext::shared_ptr<OptimizationMethod> optimizer = nullptr,
+                    ext::shared_ptr<EndCriteria> endCriteria = nullptr);
     /*! The set of (alive) additional dates is added to the interpolation grid. The set of additional dates must only
       depend on the current global evaluation date.  The additionalErrors functor must yield at least as many values
       such that
@@ -61,7 +66,9 @@ template <class Curve> class GlobalBootstrap {
     GlobalBootstrap(std::vector<ext::shared_ptr<typename Traits::helper> > additionalHelpers,
                     ext::function<std::vector<Date>()> additionalDates,
                     ext::function<Array()> additionalErrors,
-                    Real accuracy = Null<Real>());
+                    Real accuracy = Null<Real>(),
+                    ext::shared_ptr<OptimizationMethod> optimizer = nullptr,
+                    ext::shared_ptr<EndCriteria> endCriteria = nullptr);
     void setup(Curve *ts);
     void calculate() const;
 
@@ -69,6 +76,8 @@ template <class Curve> class GlobalBootstrap {
     void initialize() const;
     Curve *ts_;
     Real accuracy_;
+    ext::shared_ptr<OptimizationMethod> optimizer_;
+    ext::shared_ptr<EndCriteria> endCriteria_;
     mutable std::vector<ext::shared_ptr<typename Traits::helper> > additionalHelpers_;
     ext::function<std::vector<Date>()> additionalDates_;
     ext::function<Array()> additionalErrors_;
@@ -82,15 +91,22 @@ template <class Curve> class GlobalBootstrap {
 // template definitions
 
 template <class Curve>
-GlobalBootstrap<Curve>::GlobalBootstrap(Real accuracy) : ts_(0), accuracy_(accuracy) {}
+GlobalBootstrap<Curve>::GlobalBootstrap(Real accuracy,
+                                        ext::shared_ptr<OptimizationMethod> optimizer,
+                                        ext::shared_ptr<EndCriteria> endCriteria)
+: ts_(0), accuracy_(accuracy), optimizer_(std::move(optimizer)),
+  endCriteria_(std::move(endCriteria)) {}
 
 template <class Curve>
 GlobalBootstrap<Curve>::GlobalBootstrap(
     std::vector<ext::shared_ptr<typename Traits::helper> > additionalHelpers,
     ext::function<std::vector<Date>()> additionalDates,
     ext::function<Array()> additionalErrors,
-    Real accuracy)
-: ts_(nullptr), accuracy_(accuracy), additionalHelpers_(std::move(additionalHelpers)),
+    Real accuracy,
+    ext::shared_ptr<OptimizationMethod> optimizer,
+    ext::shared_ptr<EndCriteria> endCriteria)
+: ts_(nullptr), accuracy_(accuracy), optimizer_(std::move(optimizer)),
+  endCriteria_(std::move(endCriteria)), additionalHelpers_(std::move(additionalHelpers)),
   additionalDates_(std::move(additionalDates)), additionalErrors_(std::move(additionalErrors)) {}
 
 template <class Curve> void GlobalBootstrap<Curve>::setup(Curve *ts) {
@@ -221,8 +237,12 @@ template <class Curve> void GlobalBootstrap<Curve>::calculate() const {
 
     // setup optimizer and EndCriteria
     Real optEps = accuracy;
-    LevenbergMarquardt optimizer(optEps, optEps, optEps); // FIXME hardcoded tolerances
-    EndCriteria ec(1000, 10, optEps, optEps, optEps);      // FIXME hardcoded values here as well
+    ext::shared_ptr<OptimizationMethod> optimizer =
+        optimizer_ != nullptr ? optimizer_ :
+                                ext::make_shared<LevenbergMarquardt>(optEps, optEps, optEps);
+    ext::shared_ptr<EndCriteria> ec =
+        endCriteria_ != nullptr ? endCriteria_ :
+                                  ext::make_shared<EndCriteria>(1000, 10, optEps, optEps, optEps);
 
     // setup interpolation
     if (!validCurve_) {
@@ -306,7 +326,7 @@ template <class Curve> void GlobalBootstrap<Curve>::calculate() const {
     Problem problem(cost, noConstraint, guess);
 
     // run optimization
-    optimizer.minimize(problem, ec);
+    optimizer->minimize(problem, *ec);
 
     // evaluate target function on best value found to ensure that data_ contains the optimal value
     Real finalTargetError = cost.value(problem.currentValue());
@@ -35,7 +35,11 @@
 #include <ql/timegrid.hpp>
 #include <ql/utilities/null.hpp>
 #include <cmath>
+#include <iomanip>
+#include <istream>
 #include <limits>
+#include <ostream>
+#include <string>
 #include <utility>
 
 namespace QuantLib {
@@ -173,13 +177,33 @@ namespace QuantLib {
     class CombinedCostFunction : public CostFunction {
       public:
         CombinedCostFunction(ext::shared_ptr<AndreasenHugeCostFunction> putCostFct,
-                             ext::shared_ptr<AndreasenHugeCostFunction> callCostFct)
-        : putCostFct_(std::move(putCostFct)), callCostFct_(std::move(callCostFct)) {}
+                             ext::shared_ptr<AndreasenHugeCostFunction> callCostFct,
+                             bool parallel = false)
+        : putCostFct_(std::move(putCostFct)), callCostFct_(std::move(callCostFct)),
+          parallel_(parallel) {}
 
         Array values(const Array& sig) const override {
             if ((putCostFct_ != nullptr) && (callCostFct_ != nullptr)) {
-                const Array pv = putCostFct_->values(sig);
-                const Array cv = callCostFct_->values(sig);
+                // the put and call branches share no mutable state
+                const AndreasenHugeCostFunction* costFcts[]
+                    = { putCostFct_.get(), callCostFct_.get() };
+                Array branchValues[2];
+                std::string failures[2];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(parallel_)
+#endif
+                for (long i=0; i < 2; ++i) {
+                    try {
+                        branchValues[i] = costFcts[i]->values(sig);
+                    } catch (std::exception& e) {
+                        failures[i] = e.what();
+                    }
+                }
+                for (const auto& failure : failures)
+                    QL_REQUIRE(failure.empty(), failure);
+
+                const Array& pv = branchValues[0];
+                const Array& cv = branchValues[1];
 
                 Array retVal(pv.size() + cv.size());
                 std::copy(pv.begin(), pv.end(), retVal.begin());
@@ -209,6 +233,7 @@ namespace QuantLib {
       private:
         const ext::shared_ptr<AndreasenHugeCostFunction> putCostFct_;
         const ext::shared_ptr<AndreasenHugeCostFunction> callCostFct_;
+        const bool parallel_;
     };
 
 
@@ -367,7 +392,19 @@ namespace QuantLib {
         gridPoints_ = mesher_->locations(0);
         gridInFwd_ = Exp(gridPoints_)*spot_->value();
 
+        // start values: the loaded volatilities are used as they are,
+        // the previous calibration is only a starting point
+        std::vector<Array> startSigmas;
+        const bool loaded = !loadedSigmas_.empty();
+        if (loaded) {
+            startSigmas.swap(loadedSigmas_);
+        } else if (warmStart_ && calibrationResults_.size() == expiries_.size()) {
+            for (const auto& result : calibrationResults_)
+                startSigmas.push_back(result.sigmas);
+        }
+
         localVolCache_.clear();
+        priceCache_.clear();
         calibrationResults_.clear();
 
         avgError_ = 0.0;
@@ -391,15 +428,22 @@ namespace QuantLib {
             const ext::shared_ptr<AndreasenHugeCostFunction> callCostFct =
                 buildCostFunction(i, Option::Call, npvCalls);
 
-            CombinedCostFunction costFunction(putCostFct, callCostFct);
+            CombinedCostFunction costFunction(
+                putCostFct, callCostFct, parallelCalibration_);
 
-            PositiveConstraint positiveConstraint;
-            Problem problem(costFunction,
-                positiveConstraint, costFunction.initialValues());
+            Array sig;
+            if (loaded) {
+                sig = startSigmas[i];
+            } else {
+                PositiveConstraint positiveConstraint;
+                Problem problem(costFunction, positiveConstraint,
+                    startSigmas.empty() ? costFunction.initialValues()
+                                        : startSigmas[i]);
 
-            optimizationMethod_->minimize(problem, endCriteria_);
+                optimizationMethod_->minimize(problem, endCriteria_);
 
-            const Array& sig = problem.currentValue();
+                sig = problem.currentValue();
+            }
 
             const SingleStepCalibrationResult calibrationResult = {
                 npvPuts, npvCalls, sig,
@@ -450,6 +494,73 @@ namespace QuantLib {
         avgError_ /= calibrationSet_.size();
     }
 
+    void AndreasenHugeVolatilityInterpl::save(std::ostream& out) const {
+        calculate();
+
+        const std::streamsize precision = out.precision();
+        out << std::setprecision(std::numeric_limits<Real>::max_digits10)
+            << "AndreasenHugeVolatilityInterpl 1\n"
+            << Integer(interpolationType_) << " "
+            << Integer(calibrationType_) << " "
+            << expiries_.size() << "\n";
+        for (Size i=0; i < expiries_.size(); ++i) {
+            const Array& sig = calibrationResults_[i].sigmas;
+            out << expiries_[i].serialNumber() << " " << sig.size();
+            for (Real s : sig)
+                out << " " << s;
+            out << "\n";
+        }
+        out << std::setprecision(precision);
+        QL_REQUIRE(out.good(), "could not write Andreasen-Huge calibration");
+    }
+
+    void AndreasenHugeVolatilityInterpl::load(std::istream& in) {
+        std::string tag;
+        Integer version = 0;
+        in >> tag >> version;
+        QL_REQUIRE(in && tag == "AndreasenHugeVolatilityInterpl" && version == 1,
+                   "not a saved Andreasen-Huge calibration");
+
+        Integer interpolationType = 0, calibrationType = 0;
+        Size nExpiries = 0;
+        in >> interpolationType >> calibrationType >> nExpiries;
+        QL_REQUIRE(in, "invalid Andreasen-Huge calibration header");
+        QL_REQUIRE(interpolationType == Integer(interpolationType_)
+                   && calibrationType == Integer(calibrationType_),
+                   "saved calibration uses a different interpolation "
+                   "or calibration type");
+        QL_REQUIRE(nExpiries == expiries_.size(),
+                   "saved calibration has " << nExpiries << " expiries, "
+                   << expiries_.size() << " expected");
+
+        std::vector<Array> sigmas(nExpiries);
+        for (Size i=0; i < nExpiries; ++i) {
+            Date::serial_type serial = 0;
+            Size nSigmas = 0;
+            in >> serial >> nSigmas;
+            QL_REQUIRE(in, "truncated Andreasen-Huge calibration");
+            QL_REQUIRE(Date(serial) == expiries_[i],
+                       "saved expiry " << Date(serial)
+                       << " does not match " << expiries_[i]);
+
+            const Size nOptions = std::count_if(
+                calibrationMatrix_[i].begin(), calibrationMatrix_[i].end(),
+                [](Size n) { return n != Null<Size>(); });
+            QL_REQUIRE(nSigmas == nOptions,
+                       "saved calibration has " << nSigmas
+                       << " volatilities for expiry " << expiries_[i]
+                       << ", " << nOptions << " expected");
+
+            sigmas[i] = Array(nSigmas);
+            for (Size j=0; j < nSigmas; ++j)
+                in >> sigmas[i][j];
+        }
+        QL_REQUIRE(in, "truncated Andreasen-Huge calibration");
+
+        loadedSigmas_.swap(sigmas);
+        LazyObject::update();
+    }
+
     Date AndreasenHugeVolatilityInterpl::maxDate() const {
         return expiries_.back();
     }
@@ -514,6 +625,8 @@ namespace QuantLib {
     Real AndreasenHugeVolatilityInterpl::optionPrice(
         Time t, Real strike, Option::Type optionType) const {
 
+        calculate();
+
         TimeValueCacheType::const_iterator f = priceCache_.find(t);
 
         const DiscountFactor df = rTS_->discount(t);
@@ -532,8 +645,6 @@ namespace QuantLib {
             return price*df*fwd;
         }
 
-        calculate();
-
 
         ext::shared_ptr<Array> prices(
             ext::make_shared<Array>(gridPoints_));
@@ -596,13 +707,13 @@ namespace QuantLib {
 
     Volatility AndreasenHugeVolatilityInterpl::localVol(Time t, Real strike)
     const {
+        calculate();
+
         TimeValueCacheType::const_iterator f = localVolCache_.find(t);
 
         if (f != localVolCache_.end())
             return getCacheValue(strike, f);
 
-        calculate();
-
         ext::shared_ptr<Array> localVol(
             ext::make_shared<Array>(gridPoints_.size()));
 
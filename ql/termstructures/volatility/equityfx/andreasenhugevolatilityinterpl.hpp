@@ -34,6 +34,7 @@
 #include <ql/termstructures/volatility/equityfx/localvoltermstructure.hpp>
 
 #include <ql/tuple.hpp>
+#include <iosfwd>
 #include <utility>
 
 namespace QuantLib {
@@ -92,6 +93,44 @@ namespace QuantLib {
 
         Volatility localVol(Time t, Real strike) const;
 
+        //! \name Calibration speed-ups
+        /*! The expiries are calibrated one after the other, since each
+            step starts from the prices of the previous one.  For the
+            CallPut calibration type, the put and call prices of a step
+            can be computed concurrently when parallel calibration is
+            enabled and OpenMP is available; the results do not change.
+
+            With warm start enabled, a recalibration, e.g., after a
+            quote changed, starts the optimization of each expiry from
+            the volatilities found by the previous calibration instead
+            of a flat guess.  This usually needs far fewer iterations;
+            the result can differ within the optimizer's tolerance.
+        */
+        //@{
+        void enableParallelCalibration(bool b = true) { parallelCalibration_ = b; }
+        void disableParallelCalibration(bool b = true) { parallelCalibration_ = !b; }
+        bool allowsParallelCalibration() const { return parallelCalibration_; }
+
+        void enableWarmStart(bool b = true) { warmStart_ = b; }
+        void disableWarmStart(bool b = true) { warmStart_ = !b; }
+        bool allowsWarmStart() const { return warmStart_; }
+        //@}
+
+        //! \name Persistence
+        /*! save() writes the calibrated volatilities of each expiry as
+            plain text with full precision.  After load(), the next
+            calculation uses them as they are and only solves the
+            forward equation once per expiry, so that a surface set up
+            with the same calibration set, interpolation and
+            calibration type can be rebuilt, e.g., in another process,
+            without running the optimizer.  Later recalculations
+            calibrate again.
+        */
+        //@{
+        void save(std::ostream& out) const;
+        void load(std::istream& in);
+        //@}
+
       protected:
         void performCalculations() const override;
 
@@ -146,6 +185,9 @@ namespace QuantLib {
         mutable std::vector<SingleStepCalibrationResult> calibrationResults_;
 
         mutable TimeValueCacheType localVolCache_, priceCache_;
+
+        bool parallelCalibration_ = false, warmStart_ = false;
+        mutable std::vector<Array> loadedSigmas_;
     };
 
 }
@@ -0,0 +1,275 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/math/interpolations/cubicinterpolation.hpp>
+#include <ql/termstructures/volatility/equityfx/compactblackvariancesurface.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace QuantLib {
+
+    namespace {
+
+        // index of the interval containing x, extended at both ends
+        Size locate(const std::vector<Real>& x, Real v) {
+            if (v < x.front())
+                return 0;
+            else if (v >= x.back())
+                return x.size()-2;
+            else
+                return std::upper_bound(x.begin(), x.end()-1, v)
+                    - x.begin() - 1;
+        }
+
+        // same as above, searching from the previous interval
+        Size locate(const std::vector<Real>& x, Real v, Size hint) {
+            if (v < x[hint])
+                return locate(x, v);
+            const Size last = x.size()-2;
+            while (hint < last && v >= x[hint+1])
+                ++hint;
+            return hint;
+        }
+
+        // derivatives at the nodes of the natural cubic spline
+        void splineDerivatives(const std::vector<Real>& x,
+                               const std::vector<Real>& y,
+                               std::vector<Real>& dydx) {
+            const CubicNaturalSpline spline(x.begin(), x.end(), y.begin());
+            for (Size i=0; i < x.size(); ++i)
+                dydx[i] = spline.derivative(x[i]);
+        }
+
+    }
+
+    CompactBlackVarianceSurface::CompactBlackVarianceSurface(
+        const Date& referenceDate,
+        const Calendar& cal,
+        const std::vector<Date>& dates,
+        std::vector<Real> strikes,
+        const Matrix& blackVolMatrix,
+        DayCounter dayCounter,
+        InterpolationType interpolationType,
+        Extrapolation lowerExtrapolation,
+        Extrapolation upperExtrapolation)
+    : BlackVarianceTermStructure(referenceDate, cal),
+      dayCounter_(std::move(dayCounter)), maxDate_(dates.back()),
+      times_(dates.size()+1), strikes_(std::move(strikes)),
+      interpolationType_(interpolationType),
+      lowerExtrapolation_(lowerExtrapolation),
+      upperExtrapolation_(upperExtrapolation) {
+
+        QL_REQUIRE(dates.size()==blackVolMatrix.columns(),
+                   "mismatch between date vector and vol matrix colums");
+        QL_REQUIRE(strikes_.size()==blackVolMatrix.rows(),
+                   "mismatch between money-strike vector and vol matrix rows");
+        QL_REQUIRE(strikes_.size() > 1, "at least two strikes required");
+        for (Size j=1; j < strikes_.size(); ++j)
+            QL_REQUIRE(strikes_[j] > strikes_[j-1],
+                       "strikes must be sorted unique!");
+
+        QL_REQUIRE(dates[0]>=referenceDate,
+                   "cannot have dates[0] < referenceDate");
+
+        const Size nTimes = times_.size(), nStrikes = strikes_.size();
+
+        // variances, one row per time including t=0
+        std::vector<std::vector<Real> > variances(
+            nTimes, std::vector<Real>(nStrikes, 0.0));
+        times_[0] = 0.0;
+        for (Size i=1; i < nTimes; ++i) {
+            times_[i] = timeFromReference(dates[i-1]);
+            QL_REQUIRE(times_[i]>times_[i-1],
+                       "dates must be sorted unique!");
+            for (Size j=0; j < nStrikes; ++j)
+                variances[i][j] = times_[i] *
+                    blackVolMatrix[j][i-1]*blackVolMatrix[j][i-1];
+        }
+
+        const Size n = coefficientsPerCell();
+        coefficients_.resize((nTimes-1)*(nStrikes-1)*n);
+
+        if (interpolationType_ == Bilinear) {
+            for (Size i=0; i < nTimes-1; ++i) {
+                const Real dt = times_[i+1] - times_[i];
+                for (Size j=0; j < nStrikes-1; ++j) {
+                    const Real dk = strikes_[j+1] - strikes_[j];
+                    const Real f00 = variances[i][j], f01 = variances[i][j+1];
+                    const Real f10 = variances[i+1][j], f11 = variances[i+1][j+1];
+
+                    Real* c = &coefficients_[(i*(nStrikes-1) + j)*n];
+                    c[0] = f00;
+                    c[1] = (f01 - f00)/dk;
+                    c[2] = (f10 - f00)/dt;
+                    c[3] = (f11 - f10 - f01 + f00)/(dt*dk);
+                }
+            }
+            return;
+        }
+
+        // The bicubic spline is the tensor product of natural cubic
+        // splines; on each cell it is the bicubic polynomial matching
+        // values and first derivatives at the corners.
+        std::vector<std::vector<Real> >
+            dfdt(nTimes, std::vector<Real>(nStrikes)),
+            dfdk(nTimes, std::vector<Real>(nStrikes)),
+            d2fdtdk(nTimes, std::vector<Real>(nStrikes));
+
+        std::vector<Real> column(nTimes), dColumn(nTimes);
+        for (Size j=0; j < nStrikes; ++j) {
+            for (Size i=0; i < nTimes; ++i)
+                column[i] = variances[i][j];
+            splineDerivatives(times_, column, dColumn);
+            for (Size i=0; i < nTimes; ++i)
+                dfdt[i][j] = dColumn[i];
+        }
+        for (Size i=0; i < nTimes; ++i) {
+            splineDerivatives(strikes_, variances[i], dfdk[i]);
+            splineDerivatives(strikes_, dfdt[i], d2fdtdk[i]);
+        }
+
+        // Hermite basis in the normalized offset
+        const Real M[4][4] = { {  1.0,  0.0,  0.0,  0.0 },
+                               {  0.0,  0.0,  1.0,  0.0 },
+                               { -3.0,  3.0, -2.0, -1.0 },
+                               {  2.0, -2.0,  1.0,  1.0 } };
+
+        for (Size i=0; i < nTimes-1; ++i) {
+            const Real dt = times_[i+1] - times_[i];
+            for (Size j=0; j < nStrikes-1; ++j) {
+                const Real dk = strikes_[j+1] - strikes_[j];
+
+                Real F[4][4];
+                for (Size a=0; a < 2; ++a)
+                    for (Size b=0; b < 2; ++b) {
+                        F[a][b]     = variances[i+a][j+b];
+                        F[a][b+2]   = dfdk[i+a][j+b]*dk;
+                        F[a+2][b]   = dfdt[i+a][j+b]*dt;
+                        F[a+2][b+2] = d2fdtdk[i+a][j+b]*dt*dk;
+                    }
+
+                // A = M F M^T, rescaled to raw time and strike offsets
+                Real* c = &coefficients_[(i*(nStrikes-1) + j)*n];
+                Real scaleT = 1.0;
+                for (Size a=0; a < 4; ++a) {
+                    Real scaleK = 1.0;
+                    for (Size b=0; b < 4; ++b) {
+                        Real sum = 0.0;
+                        for (Size p=0; p < 4; ++p)
+                            for (Size q=0; q < 4; ++q)
+                                sum += M[a][p]*F[p][q]*M[b][q];
+                        c[4*a+b] = sum/(scaleT*scaleK);
+                        scaleK *= dk;
+                    }
+                    scaleT *= dt;
+                }
+            }
+        }
+    }
+
+    Size CompactBlackVarianceSurface::coefficientsPerCell() const {
+        return (interpolationType_ == Bilinear) ? 4 : 16;
+    }
+
+    Real CompactBlackVarianceSurface::clampStrike(Real strike) const {
+        // enforce constant extrapolation when required
+        if (strike < strikes_.front()
+            && lowerExtrapolation_ == ConstantExtrapolation)
+            return strikes_.front();
+        if (strike > strikes_.back()
+            && upperExtrapolation_ == ConstantExtrapolation)
+            return strikes_.back();
+        return strike;
+    }
+
+    void CompactBlackVarianceSurface::collapse(
+        Size timeCell, Size strikeCell, Real dt, Real* d) const {
+        const Size n = coefficientsPerCell();
+        const Real* c =
+            &coefficients_[(timeCell*(strikes_.size()-1) + strikeCell)*n];
+        if (interpolationType_ == Bilinear) {
+            d[0] = c[0] + dt*c[2];
+            d[1] = c[1] + dt*c[3];
+            d[2] = d[3] = 0.0;
+        } else {
+            for (Size b=0; b < 4; ++b)
+                d[b] = c[b] + dt*(c[4+b] + dt*(c[8+b] + dt*c[12+b]));
+        }
+    }
+
+    Real CompactBlackVarianceSurface::blackVarianceImpl(Time t,
+                                                        Real strike) const {
+        if (t==0.0) return 0.0;
+
+        strike = clampStrike(strike);
+
+        const Time tc = std::min(t, times_.back());
+        const Size i = locate(times_, tc), j = locate(strikes_, strike);
+
+        Real d[4];
+        collapse(i, j, tc - times_[i], d);
+
+        const Real dk = strike - strikes_[j];
+        const Real variance = d[0] + dk*(d[1] + dk*(d[2] + dk*d[3]));
+
+        // t>times_.back(): extrapolate at constant volatility
+        return (t <= times_.back()) ? variance : variance*t/times_.back();
+    }
+
+    Array CompactBlackVarianceSurface::blackVariances(
+        Time t, const Array& strikes, bool extrapolate) const {
+        checkRange(t, extrapolate);
+        for (Real strike : strikes)
+            checkStrike(strike, extrapolate);
+
+        Array result(strikes.size(), 0.0);
+        if (t==0.0 || strikes.empty())
+            return result;
+
+        const Size nCells = strikes_.size()-1;
+        const Time tc = std::min(t, times_.back());
+        const Size i = locate(times_, tc);
+        const Real scale = (t <= times_.back()) ? 1.0 : t/times_.back();
+
+        // cubics in the strike offset, one per strike cell
+        std::vector<Real> d(4*nCells);
+        for (Size j=0; j < nCells; ++j)
+            collapse(i, j, tc - times_[i], &d[4*j]);
+
+        Size hint = 0;
+        for (Size k=0; k < strikes.size(); ++k) {
+            const Real strike = clampStrike(strikes[k]);
+            hint = locate(strikes_, strike, hint);
+            const Real* p = &d[4*hint];
+            const Real dk = strike - strikes_[hint];
+            result[k] = scale*(p[0] + dk*(p[1] + dk*(p[2] + dk*p[3])));
+        }
+
+        return result;
+    }
+
+    Array CompactBlackVarianceSurface::blackVols(
+        Time t, const Array& strikes, bool extrapolate) const {
+        // same convention as BlackVarianceTermStructure::blackVolImpl
+        const Time nonZeroMaturity = (t==0.0 ? 0.00001 : t);
+        Array result = blackVariances(nonZeroMaturity, strikes, extrapolate);
+        for (Real& v : result)
+            v = std::sqrt(v/nonZeroMaturity);
+        return result;
+    }
+
+}
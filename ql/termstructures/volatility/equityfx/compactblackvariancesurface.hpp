@@ -0,0 +1,114 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file compactblackvariancesurface.hpp
+    \brief Immutable Black variance surface with precomputed interpolation
+*/
+
+#ifndef quantlib_compact_black_variance_surface_hpp
+#define quantlib_compact_black_variance_surface_hpp
+
+#include <ql/termstructures/volatility/equityfx/blackvoltermstructure.hpp>
+#include <ql/math/array.hpp>
+#include <ql/math/matrix.hpp>
+
+namespace QuantLib {
+
+    //! Immutable Black variance surface with precomputed interpolation
+    /*! The surface takes the same input as BlackVarianceSurface and
+        returns the same variances, up to rounding, for bilinear and
+        bicubic-spline interpolation.  The market data cannot change
+        after construction; in exchange, the interpolation is reduced
+        once to polynomial coefficients stored contiguously cell by
+        cell, so that a look-up is two interval searches and a
+        polynomial evaluation without virtual calls or temporary
+        splines.
+
+        blackVariances() and blackVols() evaluate a whole vector of
+        strikes at a given time: the time dependence is collapsed
+        once for all strikes, and the strike search starts from the
+        previous strike, which makes this the fastest way to query
+        the surface on a grid of strikes.
+
+        \ingroup volatility
+    */
+    class CompactBlackVarianceSurface : public BlackVarianceTermStructure {
+      public:
+        enum InterpolationType { Bilinear, Bicubic };
+        enum Extrapolation { ConstantExtrapolation,
+                             InterpolatorDefaultExtrapolation };
+        CompactBlackVarianceSurface(
+            const Date& referenceDate,
+            const Calendar& cal,
+            const std::vector<Date>& dates,
+            std::vector<Real> strikes,
+            const Matrix& blackVolMatrix,
+            DayCounter dayCounter,
+            InterpolationType interpolationType = Bilinear,
+            Extrapolation lowerExtrapolation = InterpolatorDefaultExtrapolation,
+            Extrapolation upperExtrapolation = InterpolatorDefaultExtrapolation);
+        //! \name TermStructure interface
+        //@{
+        DayCounter dayCounter() const override { return dayCounter_; }
+        Date maxDate() const override { return maxDate_; }
+        //@}
+        //! \name VolatilityTermStructure interface
+        //@{
+        Real minStrike() const override { return strikes_.front(); }
+        Real maxStrike() const override { return strikes_.back(); }
+        //@}
+        //! \name Inspectors
+        //@{
+        const std::vector<Time>& times() const { return times_; }
+        const std::vector<Real>& strikes() const { return strikes_; }
+        InterpolationType interpolationType() const {
+            return interpolationType_;
+        }
+        //@}
+        //! \name Bulk look-up
+        //@{
+        Array blackVariances(Time t,
+                             const Array& strikes,
+                             bool extrapolate = false) const;
+        Array blackVols(Time t,
+                        const Array& strikes,
+                        bool extrapolate = false) const;
+        //@}
+      protected:
+        Real blackVarianceImpl(Time t, Real strike) const override;
+
+      private:
+        Size coefficientsPerCell() const;
+        Real clampStrike(Real strike) const;
+        // collapses the polynomial of a cell to a cubic in the strike
+        void collapse(Size timeCell, Size strikeCell, Real dt, Real* d) const;
+
+        DayCounter dayCounter_;
+        Date maxDate_;
+        std::vector<Time> times_;
+        std::vector<Real> strikes_;
+        InterpolationType interpolationType_;
+        Extrapolation lowerExtrapolation_, upperExtrapolation_;
+        // polynomial coefficients in time and strike offsets,
+        // cell by cell, strike cells running fastest
+        std::vector<Real> coefficients_;
+    };
+
+}
+
+
+#endif
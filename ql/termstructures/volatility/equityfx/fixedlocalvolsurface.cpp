@@ -21,6 +21,11 @@
 #include <ql/math/interpolations/linearinterpolation.hpp>
 #include <ql/termstructures/volatility/equityfx/fixedlocalvolsurface.hpp>
 #include <ql/time/calendars/nullcalendar.hpp>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
 #include <utility>
 
 
@@ -138,6 +143,69 @@ namespace QuantLib {
         return strikes_.back()->back();
     }
 
+    void FixedLocalVolSurface::save(std::ostream& out) const {
+        const Size nStrikes = localVolMatrix_->rows();
+        const std::streamsize precision = out.precision();
+        out << std::setprecision(std::numeric_limits<Real>::max_digits10)
+            << "FixedLocalVolSurface 1\n"
+            << referenceDate().serialNumber() << " "
+            << Integer(lowerExtrapolation_) << " "
+            << Integer(upperExtrapolation_) << "\n"
+            << times_.size() << " " << nStrikes << "\n";
+        for (Time t : times_)
+            out << t << " ";
+        out << "\n";
+        for (const auto& strikes : strikes_) {
+            for (Real k : *strikes)
+                out << k << " ";
+            out << "\n";
+        }
+        for (Size i=0; i < nStrikes; ++i) {
+            for (Size j=0; j < times_.size(); ++j)
+                out << (*localVolMatrix_)[i][j] << " ";
+            out << "\n";
+        }
+        out << std::setprecision(precision);
+        QL_REQUIRE(out.good(), "could not write local volatility surface");
+    }
+
+    ext::shared_ptr<FixedLocalVolSurface>
+    FixedLocalVolSurface::load(std::istream& in, const DayCounter& dayCounter) {
+        std::string tag;
+        Integer version = 0;
+        in >> tag >> version;
+        QL_REQUIRE(in && tag == "FixedLocalVolSurface" && version == 1,
+                   "not a saved local volatility surface");
+
+        Date::serial_type serial = 0;
+        Integer lower = 0, upper = 0;
+        Size nTimes = 0, nStrikes = 0;
+        in >> serial >> lower >> upper >> nTimes >> nStrikes;
+        QL_REQUIRE(in && nTimes > 0 && nStrikes > 0,
+                   "invalid local volatility surface header");
+
+        std::vector<Time> times(nTimes);
+        for (Size j=0; j < nTimes; ++j)
+            in >> times[j];
+
+        std::vector<ext::shared_ptr<std::vector<Real> > > strikes(nTimes);
+        for (Size j=0; j < nTimes; ++j) {
+            strikes[j] = ext::make_shared<std::vector<Real> >(nStrikes);
+            for (Size i=0; i < nStrikes; ++i)
+                in >> (*strikes[j])[i];
+        }
+
+        auto localVolMatrix = ext::make_shared<Matrix>(nStrikes, nTimes);
+        for (Size i=0; i < nStrikes; ++i)
+            for (Size j=0; j < nTimes; ++j)
+                in >> (*localVolMatrix)[i][j];
+        QL_REQUIRE(in, "truncated local volatility surface");
+
+        return ext::make_shared<FixedLocalVolSurface>(
+            Date(serial), times, strikes, localVolMatrix, dayCounter,
+            Extrapolation(lower), Extrapolation(upper));
+    }
+
     Volatility FixedLocalVolSurface::localVolImpl(Time t, Real strike) const {
         t = std::min(times_.back(), std::max(t, times_.front()));
 
@@ -30,6 +30,7 @@
 #include <ql/math/interpolations/linearinterpolation.hpp>
 
 #include <ql/termstructures/volatility/equityfx/localvoltermstructure.hpp>
+#include <iosfwd>
 
 namespace QuantLib {
 
@@ -67,6 +68,29 @@ namespace QuantLib {
         Real minStrike() const override;
         Real maxStrike() const override;
 
+        //! \name Inspectors
+        //@{
+        const std::vector<Time>& times() const { return times_; }
+        const std::vector<ext::shared_ptr<std::vector<Real> > >& strikes() const {
+            return strikes_;
+        }
+        const Matrix& localVolMatrix() const { return *localVolMatrix_; }
+        //@}
+
+        //! \name Persistence
+        /*! The surface is written as plain text with full precision,
+            so that a calibrated surface, e.g., the leverage function of
+            a Heston stochastic local volatility model, can be stored and
+            read back without calibrating it again.  The day counter is
+            not written and must be passed when loading; the loaded
+            surface uses linear interpolation.
+        */
+        //@{
+        void save(std::ostream& out) const;
+        static ext::shared_ptr<FixedLocalVolSurface> load(std::istream& in,
+                                                          const DayCounter& dayCounter);
+        //@}
+
         template <class Interpolator>
         void setInterpolation(const Interpolator& i = Interpolator()) {
             for (Size j=0; j < times_.size(); ++j) {
@@ -0,0 +1,185 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/exercise.hpp>
+#include <ql/instruments/vanillaoption.hpp>
+#include <ql/pricingengines/blackformula.hpp>
+#include <ql/quotes/simplequote.hpp>
+#include <ql/termstructures/volatility/equityfx/impliedvolatilitysurfacebuilder.hpp>
+#include <ql/utilities/null.hpp>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace QuantLib {
+
+    ImpliedVolatilitySurfaceBuilder::ImpliedVolatilitySurfaceBuilder(
+        const Date& referenceDate,
+        DayCounter dayCounter,
+        std::vector<Date> expiries,
+        std::vector<Real> strikes,
+        std::vector<Option::Type> types)
+    : referenceDate_(referenceDate), dayCounter_(std::move(dayCounter)),
+      expiries_(std::move(expiries)), strikes_(std::move(strikes)),
+      types_(std::move(types)),
+      times_(expiries_.size()), cells_(expiries_.size()),
+      forwards_(expiries_.size(), Null<Real>()),
+      vols_(expiries_.size(), Null<Real>()) {
+
+        QL_REQUIRE(strikes_.size() == expiries_.size()
+                   && types_.size() == expiries_.size(),
+                   "mismatch between number of expiries ("
+                   << expiries_.size() << "), strikes ("
+                   << strikes_.size() << ") and option types ("
+                   << types_.size() << ")");
+
+        for (Size i=0; i < expiries_.size(); ++i) {
+            QL_REQUIRE(expiries_[i] > referenceDate_,
+                       "expiry " << expiries_[i]
+                       << " not after reference date " << referenceDate_);
+            QL_REQUIRE(strikes_[i] > 0.0,
+                       "positive strike required: " << strikes_[i]
+                       << " given");
+            times_[i] = dayCounter_.yearFraction(referenceDate_, expiries_[i]);
+        }
+
+        gridExpiries_ = expiries_;
+        std::sort(gridExpiries_.begin(), gridExpiries_.end());
+        gridExpiries_.erase(
+            std::unique(gridExpiries_.begin(), gridExpiries_.end()),
+            gridExpiries_.end());
+
+        gridStrikes_ = strikes_;
+        std::sort(gridStrikes_.begin(), gridStrikes_.end());
+        gridStrikes_.erase(
+            std::unique(gridStrikes_.begin(), gridStrikes_.end()),
+            gridStrikes_.end());
+
+        // cells are stored expiry-major
+        for (Size i=0; i < expiries_.size(); ++i) {
+            const Size l = std::lower_bound(
+                gridExpiries_.begin(), gridExpiries_.end(), expiries_[i])
+                - gridExpiries_.begin();
+            const Size k = std::lower_bound(
+                gridStrikes_.begin(), gridStrikes_.end(), strikes_[i])
+                - gridStrikes_.begin();
+            cells_[i] = l*gridStrikes_.size() + k;
+        }
+    }
+
+    void ImpliedVolatilitySurfaceBuilder::setPrices(
+        const std::vector<Real>& prices,
+        const std::vector<Real>& forwards,
+        const std::vector<DiscountFactor>& discounts) {
+
+        const Size n = expiries_.size();
+        QL_REQUIRE(prices.size() == n && forwards.size() == n
+                   && discounts.size() == n,
+                   "mismatch between number of quotes (" << n
+                   << "), prices (" << prices.size()
+                   << "), forwards (" << forwards.size()
+                   << ") and discount factors (" << discounts.size() << ")");
+
+        std::copy(forwards.begin(), forwards.end(), forwards_.begin());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(parallelInversion_)
+#endif
+        for (long i=0; i < static_cast<long>(n); ++i) {
+            try {
+                vols_[i] = blackFormulaImpliedStdDevJaeckel(
+                    types_[i], strikes_[i], forwards[i],
+                    prices[i], discounts[i]) / std::sqrt(times_[i]);
+            } catch (std::exception&) {
+                vols_[i] = Null<Real>();
+            }
+        }
+    }
+
+    std::vector<Size> ImpliedVolatilitySurfaceBuilder::selectedQuotes() const {
+        std::vector<Size> selected(
+            gridExpiries_.size()*gridStrikes_.size(), Null<Size>());
+
+        for (Size i=0; i < expiries_.size(); ++i) {
+            if (vols_[i] == Null<Real>())
+                continue;
+
+            Size& j = selected[cells_[i]];
+            const Option::Type otm = (strikes_[i] >= forwards_[i])
+                ? Option::Call : Option::Put;
+            if (j == Null<Size>() || (types_[j] != otm && types_[i] == otm))
+                j = i;
+        }
+
+        return selected;
+    }
+
+    ext::shared_ptr<BlackVarianceSurface>
+    ImpliedVolatilitySurfaceBuilder::blackVarianceSurface(
+        const Calendar& calendar,
+        BlackVarianceSurface::Extrapolation lowerExtrapolation,
+        BlackVarianceSurface::Extrapolation upperExtrapolation) const {
+
+        const std::vector<Size> selected = selectedQuotes();
+
+        const Size nStrikes = gridStrikes_.size();
+        Matrix blackVols(nStrikes, gridExpiries_.size());
+        for (Size l=0; l < gridExpiries_.size(); ++l) {
+            for (Size k=0; k < nStrikes; ++k) {
+                const Size i = selected[l*nStrikes + k];
+                QL_REQUIRE(i != Null<Size>(),
+                           "no implied volatility for expiry "
+                           << gridExpiries_[l] << " and strike "
+                           << gridStrikes_[k]);
+                blackVols[k][l] = vols_[i];
+            }
+        }
+
+        return ext::make_shared<BlackVarianceSurface>(
+            referenceDate_, calendar, gridExpiries_, gridStrikes_,
+            blackVols, dayCounter_, lowerExtrapolation, upperExtrapolation);
+    }
+
+    AndreasenHugeVolatilityInterpl::CalibrationSet
+    ImpliedVolatilitySurfaceBuilder::calibrationSet(
+        const DayCounter& dayCounter) const {
+
+        const bool rescale = !dayCounter.empty() && dayCounter != dayCounter_;
+
+        AndreasenHugeVolatilityInterpl::CalibrationSet calibrationSet;
+        for (Size i : selectedQuotes()) {
+            if (i == Null<Size>())
+                continue;
+
+            // same total variance over the target year fraction
+            const Volatility vol = rescale
+                ? Volatility(vols_[i]*std::sqrt(
+                      times_[i]/dayCounter.yearFraction(
+                          referenceDate_, expiries_[i])))
+                : vols_[i];
+
+            calibrationSet.push_back(std::make_pair(
+                ext::make_shared<VanillaOption>(
+                    ext::make_shared<PlainVanillaPayoff>(types_[i], strikes_[i]),
+                    ext::make_shared<EuropeanExercise>(expiries_[i])),
+                ext::make_shared<SimpleQuote>(vol)));
+        }
+
+        return calibrationSet;
+    }
+
+}
@@ -0,0 +1,128 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file impliedvolatilitysurfacebuilder.hpp
+    \brief Black volatility surfaces from raw option quotes
+*/
+
+#ifndef quantlib_implied_volatility_surface_builder_hpp
+#define quantlib_implied_volatility_surface_builder_hpp
+
+#include <ql/termstructures/volatility/equityfx/andreasenhugevolatilityinterpl.hpp>
+#include <ql/termstructures/volatility/equityfx/blackvariancesurface.hpp>
+#include <ql/time/calendars/nullcalendar.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Black volatility surfaces from raw option quotes
+    /*! The builder inverts the undiscounted Black formula for the
+        mid prices of European options given together with their
+        forwards and discount factors, without building processes,
+        instruments or engines.  The layout of the quotes is fixed at
+        construction; setPrices() can then be called repeatedly as
+        the market moves and writes the volatilities in place.
+
+        If both a call and a put are quoted for the same expiry and
+        strike, the out-of-the-money one is used to build surfaces or
+        calibration sets.  Quotes whose price cannot be inverted,
+        e.g., because it violates the no-arbitrage bounds, get a
+        Null<Real>() volatility and are skipped.
+
+        Expiries and strikes are matched exactly.
+    */
+    class ImpliedVolatilitySurfaceBuilder {
+      public:
+        ImpliedVolatilitySurfaceBuilder(const Date& referenceDate,
+                                        DayCounter dayCounter,
+                                        std::vector<Date> expiries,
+                                        std::vector<Real> strikes,
+                                        std::vector<Option::Type> types);
+
+        //! inverts the given prices, in the order of the quotes
+        void setPrices(const std::vector<Real>& prices,
+                       const std::vector<Real>& forwards,
+                       const std::vector<DiscountFactor>& discounts);
+
+        //! \name Inspectors
+        //@{
+        Size size() const { return strikes_.size(); }
+        const std::vector<Date>& expiries() const { return expiries_; }
+        const std::vector<Real>& strikes() const { return strikes_; }
+        const std::vector<Option::Type>& types() const { return types_; }
+        //! volatilities of the quotes, Null<Real>() if not inverted
+        const std::vector<Volatility>& impliedVolatilities() const {
+            return vols_;
+        }
+        //@}
+
+        //! \name Surfaces
+        //@{
+        /*! The quotes used must cover the full grid of distinct
+            expiries and strikes.
+        */
+        ext::shared_ptr<BlackVarianceSurface> blackVarianceSurface(
+            const Calendar& calendar = NullCalendar(),
+            BlackVarianceSurface::Extrapolation lowerExtrapolation =
+                BlackVarianceSurface::InterpolatorDefaultExtrapolation,
+            BlackVarianceSurface::Extrapolation upperExtrapolation =
+                BlackVarianceSurface::InterpolatorDefaultExtrapolation) const;
+
+        //! European options and volatility quotes for the calibration
+        /*! The volatilities are quoted with the builder's day counter.
+            If the calibration measures time with a different one, as
+            AndreasenHugeVolatilityInterpl does with the day counter of
+            its risk-free rate term structure, it must be passed so
+            that the quotes are rescaled to the same total variances.
+        */
+        AndreasenHugeVolatilityInterpl::CalibrationSet calibrationSet(
+            const DayCounter& dayCounter = DayCounter()) const;
+        //@}
+
+        //! \name Parallel inversion
+        /*! The quotes are inverted concurrently when parallel
+            inversion is enabled and OpenMP is available.
+        */
+        //@{
+        void enableParallelInversion(bool b = true) { parallelInversion_ = b; }
+        void disableParallelInversion(bool b = true) { parallelInversion_ = !b; }
+        bool allowsParallelInversion() const { return parallelInversion_; }
+        //@}
+
+      private:
+        // quote used for each (expiry, strike) cell, Null<Size>() if none
+        std::vector<Size> selectedQuotes() const;
+
+        const Date referenceDate_;
+        const DayCounter dayCounter_;
+        const std::vector<Date> expiries_;
+        const std::vector<Real> strikes_;
+        const std::vector<Option::Type> types_;
+
+        std::vector<Time> times_;
+        std::vector<Date> gridExpiries_;
+        std::vector<Real> gridStrikes_;
+        std::vector<Size> cells_;
+
+        std::vector<Real> forwards_;
+        std::vector<Volatility> vols_;
+        bool parallelInversion_ = false;
+    };
+
+}
+
+#endif
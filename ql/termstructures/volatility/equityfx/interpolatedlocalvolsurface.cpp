@@ -0,0 +1,234 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/termstructures/volatility/equityfx/interpolatedlocalvolsurface.hpp>
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace QuantLib {
+
+    InterpolatedLocalVolSurface::InterpolatedLocalVolSurface(
+        Handle<LocalVolTermStructure> localVol,
+        std::vector<Time> times,
+        const std::vector<Real>& strikes,
+        Real illegalLocalVolOverwrite)
+    : LocalVolTermStructure(localVol->businessDayConvention(),
+                            localVol->dayCounter()),
+      localVol_(std::move(localVol)), times_(std::move(times)),
+      logStrikes_(strikes.size()),
+      illegalLocalVolOverwrite_(illegalLocalVolOverwrite) {
+
+        QL_REQUIRE(!times_.empty(), "no times given");
+        QL_REQUIRE(times_.front() >= 0.0, "negative time given");
+        QL_REQUIRE(strikes.size() > 1, "at least two strikes required");
+        for (Size i=1; i < times_.size(); ++i)
+            QL_REQUIRE(times_[i] > times_[i-1],
+                       "times must be strictly increasing");
+        for (Size i=0; i < strikes.size(); ++i) {
+            QL_REQUIRE(strikes[i] > 0.0, "strikes must be positive");
+            QL_REQUIRE(i == 0 || strikes[i] > strikes[i-1],
+                       "strikes must be strictly increasing");
+            logStrikes_[i] = std::log(strikes[i]);
+        }
+
+        setInterpolation<Linear>();
+        registerWith(localVol_);
+    }
+
+    InterpolatedLocalVolSurface::InterpolatedLocalVolSurface(
+        Handle<LocalVolTermStructure> localVol,
+        Time maxTime,
+        Size timeSteps,
+        Real minStrike,
+        Real maxStrike,
+        Size strikeSteps,
+        Real illegalLocalVolOverwrite)
+    : LocalVolTermStructure(localVol->businessDayConvention(),
+                            localVol->dayCounter()),
+      localVol_(std::move(localVol)), times_(timeSteps+1),
+      logStrikes_(strikeSteps+1),
+      illegalLocalVolOverwrite_(illegalLocalVolOverwrite) {
+
+        QL_REQUIRE(maxTime > 0.0, "positive maximum time required");
+        QL_REQUIRE(timeSteps > 0 && strikeSteps > 0,
+                   "at least one time and one strike step required");
+        QL_REQUIRE(minStrike > 0.0 && maxStrike > minStrike,
+                   "invalid strike range [" << minStrike << ", "
+                   << maxStrike << "]");
+
+        for (Size i=0; i <= timeSteps; ++i)
+            times_[i] = maxTime*i/timeSteps;
+
+        const Real xMin = std::log(minStrike), xMax = std::log(maxStrike);
+        for (Size j=0; j <= strikeSteps; ++j)
+            logStrikes_[j] = xMin + (xMax-xMin)*j/strikeSteps;
+
+        setInterpolation<Linear>();
+        registerWith(localVol_);
+    }
+
+    const Date& InterpolatedLocalVolSurface::referenceDate() const {
+        return localVol_->referenceDate();
+    }
+
+    Calendar InterpolatedLocalVolSurface::calendar() const {
+        return localVol_->calendar();
+    }
+
+    DayCounter InterpolatedLocalVolSurface::dayCounter() const {
+        return localVol_->dayCounter();
+    }
+
+    Natural InterpolatedLocalVolSurface::settlementDays() const {
+        return localVol_->settlementDays();
+    }
+
+    Date InterpolatedLocalVolSurface::maxDate() const {
+        return localVol_->maxDate();
+    }
+
+    Time InterpolatedLocalVolSurface::maxTime() const {
+        return localVol_->maxTime();
+    }
+
+    Real InterpolatedLocalVolSurface::minStrike() const {
+        return std::exp(logStrikes_.front());
+    }
+
+    Real InterpolatedLocalVolSurface::maxStrike() const {
+        return std::exp(logStrikes_.back());
+    }
+
+    void InterpolatedLocalVolSurface::update() {
+        // the reference date is taken from the underlying surface,
+        // therefore the TermStructure part has nothing to update
+        LazyObject::update();
+    }
+
+    const Matrix& InterpolatedLocalVolSurface::localVolMatrix() const {
+        calculate();
+        return localVolMatrix_;
+    }
+
+    void InterpolatedLocalVolSurface::performCalculations() const {
+        const Size nTimes = times_.size(), nStrikes = logStrikes_.size();
+
+        std::vector<Real> strikes(nStrikes);
+        std::transform(logStrikes_.begin(), logStrikes_.end(),
+                       strikes.begin(), [](Real x) { return std::exp(x); });
+
+        localVolMatrix_ = Matrix(nTimes, nStrikes);
+        std::vector<std::string> failures(nTimes);
+
+        const auto sample = [&](Size i) {
+            for (Size j=0; j < nStrikes; ++j) {
+                if (illegalLocalVolOverwrite_ < 0.0) {
+                    localVolMatrix_[i][j]
+                        = localVol_->localVol(times_[i], strikes[j], true);
+                }
+                else {
+                    try {
+                        localVolMatrix_[i][j]
+                            = localVol_->localVol(times_[i], strikes[j], true);
+                    } catch (Error&) {
+                        localVolMatrix_[i][j] = illegalLocalVolOverwrite_;
+                    }
+                }
+            }
+        };
+
+        // the first slice is done serially, so that lazy parts of the
+        // underlying surface are calculated before the parallel loop
+        sample(0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(parallelSampling_)
+#endif
+        for (long i=1; i < static_cast<long>(nTimes); ++i) {
+            try {
+                sample(i);
+            } catch (std::exception& e) {
+                failures[i] = e.what();
+            }
+        }
+        for (Size i=1; i < nTimes; ++i)
+            QL_REQUIRE(failures[i].empty(), failures[i]);
+
+        buildInterpolations();
+    }
+
+    void InterpolatedLocalVolSurface::buildInterpolations() const {
+        interpolations_.clear();
+        interpolations_.reserve(times_.size());
+        for (Size i=0; i < times_.size(); ++i)
+            interpolations_.push_back(
+                interpolate_(logStrikes_, localVolMatrix_.row_begin(i)));
+    }
+
+    Size InterpolatedLocalVolSurface::locateTime(Time t) const {
+        if (t <= times_.front())
+            return 0;
+        else if (t >= times_.back())
+            return times_.size()-1;
+        else
+            return std::upper_bound(times_.begin(), times_.end(), t)
+                - times_.begin() - 1;
+    }
+
+    Volatility InterpolatedLocalVolSurface::localVolImpl(Time t,
+                                                         Real strike) const {
+        calculate();
+
+        const Real x = std::min(logStrikes_.back(),
+            std::max(logStrikes_.front(), std::log(strike)));
+
+        const Size i = locateTime(t);
+        const Volatility v1 = interpolations_[i](x);
+        if (i+1 == times_.size() || t <= times_[i])
+            return v1;
+
+        const Volatility v2 = interpolations_[i+1](x);
+        const Real w = (t - times_[i])/(times_[i+1] - times_[i]);
+        return v1 + w*(v2 - v1);
+    }
+
+    Array InterpolatedLocalVolSurface::localVolatilities(
+        Time t, const Array& logStrikes) const {
+        calculate();
+
+        const Size i = locateTime(t);
+        const bool interpolateInTime = (i+1 < times_.size() && t > times_[i]);
+        const Real w = interpolateInTime
+            ? Real((t - times_[i])/(times_[i+1] - times_[i])) : 0.0;
+
+        const Interpolation& f1 = interpolations_[i];
+        const Interpolation& f2 = interpolations_[interpolateInTime ? i+1 : i];
+        const Real xMin = logStrikes_.front(), xMax = logStrikes_.back();
+
+        Array result(logStrikes.size());
+        Size hint1 = 0, hint2 = 0;
+        for (Size k=0; k < logStrikes.size(); ++k) {
+            const Real x = std::min(xMax, std::max(xMin, logStrikes[k]));
+            const Volatility v1 = f1(x, hint1);
+            result[k] = interpolateInTime
+                ? Volatility(v1 + w*(f2(x, hint2) - v1)) : v1;
+        }
+
+        return result;
+    }
+
+}
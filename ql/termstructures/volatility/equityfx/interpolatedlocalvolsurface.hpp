@@ -0,0 +1,160 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file interpolatedlocalvolsurface.hpp
+    \brief Local volatility surface sampled once on a time/log-strike grid
+*/
+
+#ifndef quantlib_interpolated_local_vol_surface_hpp
+#define quantlib_interpolated_local_vol_surface_hpp
+
+#include <ql/handle.hpp>
+#include <ql/patterns/lazyobject.hpp>
+#include <ql/math/array.hpp>
+#include <ql/math/matrix.hpp>
+#include <ql/math/interpolation.hpp>
+#include <ql/math/interpolations/linearinterpolation.hpp>
+#include <ql/termstructures/volatility/equityfx/localvoltermstructure.hpp>
+#include <ql/functional.hpp>
+
+namespace QuantLib {
+
+    //! Local volatility surface sampled once on a time/log-strike grid
+    /*! The given local volatility, e.g., a LocalVolSurface deriving
+        Dupire's formula from a Black volatility surface, is evaluated
+        once on a grid of times and log-strikes.  Subsequent look-ups
+        interpolate along the log-strike within the two neighbouring
+        time slices and linearly in time between them; outside of the
+        grid the volatility is extrapolated flat.
+
+        The surface can be passed as external local volatility to a
+        GeneralizedBlackScholesProcess, so that Monte Carlo and finite
+        difference engines avoid the finite-difference bumps of the
+        Black volatility surface at each path step or grid node.
+        FdmBlackScholesOp recognizes the surface and uses the batch
+        look-up below on its log-spot grid.
+
+        Local volatilities that cannot be calculated at a node throw,
+        unless a value for illegal nodes is given.
+
+        \ingroup volatility
+    */
+    class InterpolatedLocalVolSurface : public LocalVolTermStructure,
+                                        public LazyObject {
+      public:
+        InterpolatedLocalVolSurface(Handle<LocalVolTermStructure> localVol,
+                                    std::vector<Time> times,
+                                    const std::vector<Real>& strikes,
+                                    Real illegalLocalVolOverwrite = -Null<Real>());
+        //! equally spaced times and log-strikes
+        InterpolatedLocalVolSurface(Handle<LocalVolTermStructure> localVol,
+                                    Time maxTime,
+                                    Size timeSteps,
+                                    Real minStrike,
+                                    Real maxStrike,
+                                    Size strikeSteps,
+                                    Real illegalLocalVolOverwrite = -Null<Real>());
+
+        //! \name TermStructure interface
+        //@{
+        const Date& referenceDate() const override;
+        Calendar calendar() const override;
+        DayCounter dayCounter() const override;
+        Natural settlementDays() const override;
+        Date maxDate() const override;
+        Time maxTime() const override;
+        //@}
+        //! \name VolatilityTermStructure interface
+        //@{
+        Real minStrike() const override;
+        Real maxStrike() const override;
+        //@}
+        //! \name Observer interface
+        //@{
+        void update() override;
+        //@}
+
+        //! \name Inspectors
+        //@{
+        const std::vector<Time>& times() const { return times_; }
+        const std::vector<Real>& logStrikes() const { return logStrikes_; }
+        //! value used for nodes where the local volatility is illegal
+        Real illegalLocalVolOverwrite() const {
+            return illegalLocalVolOverwrite_;
+        }
+        //! local volatilities, one row per time
+        const Matrix& localVolMatrix() const;
+        //@}
+
+        //! local volatilities at the given log-strikes
+        /*! The time slices are located once for all points and the
+            interval search along the log-strike starts from the
+            previous point, so that this is the fastest way to
+            evaluate the surface on a spot grid.
+        */
+        Array localVolatilities(Time t, const Array& logStrikes) const;
+
+        //! interpolation along the log-strike, linear by default
+        template <class Interpolator>
+        void setInterpolation(const Interpolator& i = Interpolator()) {
+            const auto interpolator = ext::make_shared<Interpolator>(i);
+            interpolate_ = [interpolator](const std::vector<Real>& x,
+                                          const Real* y) {
+                return Interpolation(
+                    interpolator->interpolate(x.begin(), x.end(), y));
+            };
+            if (!interpolations_.empty())
+                buildInterpolations();
+            notifyObservers();
+        }
+
+        //! \name Parallel sampling
+        /*! When enabled and OpenMP is available, the time slices are
+            sampled concurrently.  The results do not change.
+
+            \warning the underlying local volatility must be safe to
+                     use from several threads once calculated.
+        */
+        //@{
+        void enableParallelSampling(bool b = true) { parallelSampling_ = b; }
+        void disableParallelSampling(bool b = true) { parallelSampling_ = !b; }
+        bool allowsParallelSampling() const { return parallelSampling_; }
+        //@}
+
+      protected:
+        Volatility localVolImpl(Time t, Real strike) const override;
+        void performCalculations() const override;
+
+      private:
+        void buildInterpolations() const;
+        Size locateTime(Time t) const;
+
+        Handle<LocalVolTermStructure> localVol_;
+        std::vector<Time> times_;
+        std::vector<Real> logStrikes_;
+        Real illegalLocalVolOverwrite_;
+        ext::function<Interpolation(const std::vector<Real>&, const Real*)>
+            interpolate_;
+        bool parallelSampling_ = false;
+
+        mutable Matrix localVolMatrix_;
+        mutable std::vector<Interpolation> interpolations_;
+    };
+
+}
+
+#endif
@@ -43,24 +43,27 @@ namespace QuantLib {
 
     ext::shared_ptr<SmileSection>
     StrippedOptionletAdapter::smileSectionImpl(Time t) const {
-        std::vector< Rate > optionletStrikes =
-            optionletStripper_->optionletStrikes(
-                0); // strikes are the same for all times ?!
-        std::vector< Real > stddevs;
-        stddevs.reserve(optionletStrikes.size());
-        for (Real optionletStrike : optionletStrikes) {
-            stddevs.push_back(volatilityImpl(t, optionletStrike) * std::sqrt(t));
-        }
-        // Extrapolation may be a problem with splines, but since minStrike()
-        // and maxStrike() are set, we assume that no one will use stddevs for
-        // strikes outside these strikes
-        CubicInterpolation::BoundaryCondition bc =
-            optionletStrikes.size() >= 4 ? CubicInterpolation::Lagrange
-                                         : CubicInterpolation::SecondDerivative;
-        return ext::make_shared< InterpolatedSmileSection< Cubic > >(
-            t, optionletStrikes, stddevs, Null< Real >(),
-            Cubic(CubicInterpolation::Spline, false, bc, 0.0, bc, 0.0),
-            Actual365Fixed(), volatilityType(), displacement());
+        calculate();
+        return smileSectionCache_.section(t, 0.0, [&]() {
+            std::vector< Rate > optionletStrikes =
+                optionletStripper_->optionletStrikes(
+                    0); // strikes are the same for all times ?!
+            std::vector< Real > stddevs;
+            stddevs.reserve(optionletStrikes.size());
+            for (Real optionletStrike : optionletStrikes) {
+                stddevs.push_back(volatilityImpl(t, optionletStrike) * std::sqrt(t));
+            }
+            // Extrapolation may be a problem with splines, but since minStrike()
+            // and maxStrike() are set, we assume that no one will use stddevs for
+            // strikes outside these strikes
+            CubicInterpolation::BoundaryCondition bc =
+                optionletStrikes.size() >= 4 ? CubicInterpolation::Lagrange
+                                             : CubicInterpolation::SecondDerivative;
+            return ext::make_shared< InterpolatedSmileSection< Cubic > >(
+                t, optionletStrikes, stddevs, Null< Real >(),
+                Cubic(CubicInterpolation::Spline, false, bc, 0.0, bc, 0.0),
+                Actual365Fixed(), volatilityType(), displacement());
+        });
     }
 
     Volatility StrippedOptionletAdapter::volatilityImpl(Time length,
@@ -81,6 +84,8 @@ namespace QuantLib {
 
     void StrippedOptionletAdapter::performCalculations() const {
 
+        smileSectionCache_.clear();
+
         //const std::vector<Rate>& atmForward = optionletStripper_->atmOptionletRate();
         //const std::vector<Time>& optionletTimes = optionletStripper_->optionletTimes();
 
@@ -31,6 +31,7 @@
 #include <ql/termstructures/volatility/optionlet/optionletvolatilitystructure.hpp>
 #include <ql/math/interpolation.hpp>
 #include <ql/math/interpolations/sabrinterpolation.hpp>
+#include <ql/termstructures/volatility/smilesectioncache.hpp>
 
 namespace QuantLib {
 
@@ -66,6 +67,16 @@ namespace QuantLib {
           VolatilityType volatilityType() const override;
           Real displacement() const override;
 
+          //! \name Smile-section cache
+          /*! Smile sections are cached by option time; the cache is
+              emptied whenever the adapter is recalculated and a size
+              of zero disables it.
+          */
+          //@{
+          void setSmileSectionCacheSize(Size n) { smileSectionCache_.setMaxSize(n); }
+          Size smileSectionCacheSize() const { return smileSectionCache_.maxSize(); }
+          //@}
+
         protected:
           //! \name OptionletVolatilityStructure interface
           //@{
@@ -76,6 +87,7 @@ namespace QuantLib {
           const ext::shared_ptr<StrippedOptionletBase> optionletStripper_;
           Size nInterpolations_;
           mutable std::vector<ext::shared_ptr<Interpolation> > strikeInterpolations_;
+          SmileSectionCache smileSectionCache_;
     };
 
     inline void StrippedOptionletAdapter::update() {
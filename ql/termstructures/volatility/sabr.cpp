@@ -195,6 +195,134 @@ namespace QuantLib {
                                              alpha, beta, nu, rho,shift, volatilityType);
     }
 
+    Real unsafeShiftedSabrVolatilityGradient(Rate strike,
+                                             Rate forward,
+                                             Time expiryTime,
+                                             Real alpha,
+                                             Real beta,
+                                             Real nu,
+                                             Real rho,
+                                             Real shift,
+                                             VolatilityType volatilityType,
+                                             Array& gradient) {
+        // same expansion as in unsafeSabrLogNormalVolatility and
+        // unsafeSabrNormalVolatility, differentiated term by term
+        const Real f = forward + shift, k = strike + shift;
+        const Real logFK = std::log(f*k);
+        const Real oneMinusBeta = 1.0-beta;
+        const Real A = std::pow(f*k, oneMinusBeta);
+        const Real sqrtA = std::sqrt(A);
+        Real logM;
+        if (!close(f, k))
+            logM = std::log(f/k);
+        else {
+            const Real epsilon = (f-k)/k;
+            logM = epsilon - .5 * epsilon * epsilon;
+        }
+        const Real z = (nu/alpha)*sqrtA*logM;
+        const Real dzdAlpha = -z/alpha;
+        const Real dzdBeta = -0.5*logFK*z;
+        const Real dzdNu = sqrtA*logM/alpha;
+
+        // multiplier z/x(z) and its derivatives
+        Real multiplier, dMdz, dMdRho;
+        static const Real m = 10;
+        if (std::fabs(z*z)>QL_EPSILON * m) {
+            const Real sqrtB = std::sqrt(1.0-2.0*rho*z+z*z);
+            const Real tmp = sqrtB+z-rho;
+            const Real xx = std::log(tmp/(1.0-rho));
+            const Real dxdRho = (-z/sqrtB-1.0)/tmp + 1.0/(1.0-rho);
+            multiplier = z/xx;
+            dMdz = (xx - z/sqrtB)/(xx*xx);
+            dMdRho = -z*dxdRho/(xx*xx);
+        } else {
+            multiplier = 1.0 - 0.5*rho*z - (3.0*rho*rho-2.0)*z*z/12.0;
+            dMdz = -0.5*rho - (3.0*rho*rho-2.0)*z/6.0;
+            dMdRho = -0.5*z - 0.5*rho*z*z;
+        }
+
+        // (1-beta)^2 log^2(f/k) correction in the denominator
+        const Real C = oneMinusBeta*oneMinusBeta*logM*logM;
+        const Real E = 1.0+C/24.0+C*C/1920.0;
+        const Real dEdBeta = (1.0/24.0+C/960.0)*(-2.0*oneMinusBeta*logM*logM);
+
+        // time-dependent correction
+        const Real c1 = volatilityType == VolatilityType::Normal ?
+            Real(-beta*(2.0-beta)) : Real(oneMinusBeta*oneMinusBeta);
+        const Real dc1dBeta = -2.0*oneMinusBeta;
+        const Real d = 1.0 + expiryTime *
+            (c1*alpha*alpha/(24.0*A)
+             + 0.25*rho*beta*nu*alpha/sqrtA
+             + (2.0-3.0*rho*rho)*(nu*nu/24.0));
+        const Real dddAlpha = expiryTime *
+            (c1*alpha/(12.0*A) + 0.25*rho*beta*nu/sqrtA);
+        const Real dddBeta = expiryTime *
+            ((dc1dBeta + c1*logFK)*alpha*alpha/(24.0*A)
+             + 0.25*rho*nu*alpha*(1.0+0.5*beta*logFK)/sqrtA);
+        const Real dddNu = expiryTime *
+            (0.25*rho*beta*alpha/sqrtA + (2.0-3.0*rho*rho)*nu/12.0);
+        const Real dddRho = expiryTime *
+            (0.25*beta*nu*alpha/sqrtA - 0.25*rho*nu*nu);
+
+        // both (f k)^(beta/2) and 1/sqrtA have log-derivative log(f k)/2
+        Real scale;
+        if (volatilityType == VolatilityType::Normal) {
+            const Real D = logM*logM;
+            const Real E1 = 1.0 + D/24.0 + D*D/1920.0;
+            scale = alpha*std::pow(f*k, beta/2.0)*E1/E;
+        } else {
+            scale = alpha/(sqrtA*E);
+        }
+        const Real dLogScaledBeta = 0.5*logFK - dEdBeta/E;
+        const Real vol = scale*multiplier*d;
+
+        gradient = Array(4);
+        gradient[0] = vol/alpha + scale*(dMdz*dzdAlpha*d + multiplier*dddAlpha);
+        gradient[1] = vol*dLogScaledBeta
+                    + scale*(dMdz*dzdBeta*d + multiplier*dddBeta);
+        gradient[2] = scale*(dMdz*dzdNu*d + multiplier*dddNu);
+        gradient[3] = scale*(dMdRho*d + multiplier*dddRho);
+        return vol;
+    }
+
+    std::vector<Real> shiftedSabrVolatilities(const std::vector<Rate>& strikes,
+                                              Rate forward,
+                                              Time expiryTime,
+                                              Real alpha,
+                                              Real beta,
+                                              Real nu,
+                                              Real rho,
+                                              Real shift,
+                                              VolatilityType volatilityType) {
+        QL_REQUIRE(forward + shift > 0.0, "at the money forward rate + shift must be "
+                   "positive: " << io::rate(forward) << " " << io::rate(shift) << " not allowed");
+        QL_REQUIRE(expiryTime>=0.0, "expiry time must be non-negative: "
+                                   << expiryTime << " not allowed");
+        validateSabrParameters(alpha, beta, nu, rho);
+
+        std::vector<Real> result(strikes.size());
+        for (Size i=0; i<strikes.size(); ++i) {
+            QL_REQUIRE(strikes[i] + shift > 0.0, "strike+shift must be positive: "
+                       << io::rate(strikes[i]) << "+" << io::rate(shift) << " not allowed");
+            result[i] = unsafeShiftedSabrVolatility(strikes[i], forward, expiryTime,
+                                                    alpha, beta, nu, rho, shift,
+                                                    volatilityType);
+        }
+        return result;
+    }
+
+    std::vector<Real> sabrVolatilities(const std::vector<Rate>& strikes,
+                                       Rate forward,
+                                       Time expiryTime,
+                                       Real alpha,
+                                       Real beta,
+                                       Real nu,
+                                       Real rho,
+                                       VolatilityType volatilityType) {
+        return shiftedSabrVolatilities(strikes, forward, expiryTime,
+                                       alpha, beta, nu, rho, 0.0, volatilityType);
+    }
+
     namespace {
         struct SabrFlochKennedyVolatility {
             Real F, alpha, beta, nu, rho, t;
@@ -29,7 +29,9 @@
 #define quantlib_sabr_hpp
 
 #include <ql/types.hpp>
+#include <ql/math/array.hpp>
 #include <ql/termstructures/volatility/volatilitytype.hpp>
+#include <vector>
 
 namespace QuantLib {
 
@@ -90,6 +92,46 @@ namespace QuantLib {
                                  Real shift,
                                  VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
 
+    //! shifted %SABR volatility together with its parameter derivatives
+    /*! Returns the same value as unsafeShiftedSabrVolatility and
+        fills \p gradient with its partial derivatives with respect
+        to alpha, beta, nu and rho (in this order).  No check is
+        performed on the inputs.
+    */
+    Real unsafeShiftedSabrVolatilityGradient(Rate strike,
+                                             Rate forward,
+                                             Time expiryTime,
+                                             Real alpha,
+                                             Real beta,
+                                             Real nu,
+                                             Real rho,
+                                             Real shift,
+                                             VolatilityType volatilityType,
+                                             Array& gradient);
+
+    //! shifted %SABR volatilities for a set of strikes
+    /*! Inputs are validated once for the whole set; the result is
+        the same as calling shiftedSabrVolatility for each strike.
+    */
+    std::vector<Real> shiftedSabrVolatilities(const std::vector<Rate>& strikes,
+                                              Rate forward,
+                                              Time expiryTime,
+                                              Real alpha,
+                                              Real beta,
+                                              Real nu,
+                                              Real rho,
+                                              Real shift,
+                                              VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
+
+    std::vector<Real> sabrVolatilities(const std::vector<Rate>& strikes,
+                                       Rate forward,
+                                       Time expiryTime,
+                                       Real alpha,
+                                       Real beta,
+                                       Real nu,
+                                       Real rho,
+                                       VolatilityType volatilityType = VolatilityType::ShiftedLognormal);
+
     Real sabrFlochKennedyVolatility(Rate strike,
                                     Rate forward,
                                     Time expiryTime,
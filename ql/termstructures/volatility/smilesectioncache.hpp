@@ -0,0 +1,100 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file smilesectioncache.hpp
+    \brief bounded cache of smile sections
+*/
+
+#ifndef quantlib_smile_section_cache_hpp
+#define quantlib_smile_section_cache_hpp
+
+#include <ql/termstructures/volatility/smilesection.hpp>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace QuantLib {
+
+    //! bounded, thread-safe cache of smile sections
+    /*! Smile sections are stored by option time and, for swaption
+        volatilities, swap length.  Once the cache holds the maximum
+        number of sections it is emptied before the next one is
+        stored; a maximum size of zero disables caching.
+
+        Sections are built outside of the lock, so that the building
+        function can use the cache itself; if two threads build the
+        same section concurrently, the first one stored is returned
+        to both.
+
+        The owner must clear the cache whenever the sections it
+        returned become outdated, e.g., in its performCalculations()
+        method.
+    */
+    class SmileSectionCache {
+      public:
+        explicit SmileSectionCache(Size maxSize = 1000) : maxSize_(maxSize) {}
+
+        template <class F>
+        ext::shared_ptr<SmileSection> section(Time optionTime,
+                                              Time swapLength,
+                                              const F& build) const {
+            const std::pair<Time, Time> key(optionTime, swapLength);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (maxSize_ == 0)
+                    return build();
+                const auto iter = sections_.find(key);
+                if (iter != sections_.end())
+                    return iter->second;
+            }
+
+            ext::shared_ptr<SmileSection> section = build();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (sections_.size() >= maxSize_)
+                sections_.clear();
+            return sections_.emplace(key, section).first->second;
+        }
+
+        void clear() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            sections_.clear();
+        }
+        Size size() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return sections_.size();
+        }
+        Size maxSize() const {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return maxSize_;
+        }
+        void setMaxSize(Size maxSize) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            maxSize_ = maxSize;
+            sections_.clear();
+        }
+
+      private:
+        mutable std::mutex mutex_;
+        mutable std::map<std::pair<Time, Time>, ext::shared_ptr<SmileSection> >
+            sections_;
+        Size maxSize_;
+    };
+
+}
+
+#endif
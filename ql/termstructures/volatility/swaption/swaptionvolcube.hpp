@@ -27,6 +27,7 @@
 
 #include <ql/termstructures/volatility/swaption/swaptionvoldiscrete.hpp>
 #include <ql/termstructures/volatility/smilesection.hpp>
+#include <ql/termstructures/volatility/smilesectioncache.hpp>
 
 namespace QuantLib {
 
@@ -80,6 +81,16 @@ namespace QuantLib {
         ext::shared_ptr<SwapIndex> shortSwapIndexBase() const { return shortSwapIndexBase_; }
         bool vegaWeightedSmileFit() const { return vegaWeightedSmileFit_; }
         //@}
+        //! \name Smile-section cache
+        /*! Smile sections are cached by option time and swap length,
+            since e.g. CMS coupon pricers query the same sections
+            repeatedly.  The cache is emptied whenever the cube is
+            recalculated; a size of zero disables it.
+        */
+        //@{
+        void setSmileSectionCacheSize(Size n) { smileSectionCache_.setMaxSize(n); }
+        Size smileSectionCacheSize() const { return smileSectionCache_.maxSize(); }
+        //@}
         //! \name LazyObject interface
         //@{
         void performCalculations() const override {
@@ -87,6 +98,7 @@ namespace QuantLib {
                        "too few strikes (" << nStrikes_
                                            << ") required are at least "
                                            << requiredNumberOfStrikes());
+            smileSectionCache_.clear();
             SwaptionVolatilityDiscrete::performCalculations();
         }
         //@}
@@ -107,6 +119,7 @@ namespace QuantLib {
         std::vector<std::vector<Handle<Quote> > > volSpreads_;
         ext::shared_ptr<SwapIndex> swapIndexBase_, shortSwapIndexBase_;
         bool vegaWeightedSmileFit_;
+        SmileSectionCache smileSectionCache_;
     };
 
     // inline
@@ -37,7 +37,9 @@
 #include <ql/quote.hpp>
 #include <ql/termstructures/volatility/sabrsmilesection.hpp>
 #include <ql/termstructures/volatility/swaption/swaptionvolcube.hpp>
+#include <string>
 #include <utility>
+#include <vector>
 
 
 #ifndef SWAPTIONVOLCUBE_VEGAWEIGHTED_TOL
@@ -158,6 +160,28 @@ namespace QuantLib {
                            const std::vector<Real> &beta,
                            const Period& swapTenor);
         void updateAfterRecalibration();
+        //! \name Parallel calibration
+        /*! When enabled and OpenMP is available, the smiles of the
+            cube are fitted concurrently.  Market data are collected
+            beforehand, so that only the fits run in parallel.
+
+            \warning this requires the default optimization method,
+                     since one passed to the constructor would be
+                     shared by all the fits.
+        */
+        //@{
+        //! enable parallel fits in subsequent calculations
+        void enableParallelCalibration(bool b = true) {
+            QL_REQUIRE(!b || !optMethod_,
+                       "parallel calibration not available when an "
+                       "optimization method is given");
+            parallelCalibration_ = b;
+        }
+        //! disable parallel fits in subsequent calculations
+        void disableParallelCalibration(bool b = true) { parallelCalibration_ = !b; }
+        //! tells whether parallel fits are enabled
+        bool allowsParallelCalibration() const { return parallelCalibration_; }
+        //@}
      protected:
         void registerWithParametersGuess();
         void setParameterGuess() const;
@@ -191,6 +215,7 @@ namespace QuantLib {
         const bool backwardFlat_;
         const Real cutoffStrike_;
         VolatilityType volatilityType_;
+        bool parallelCalibration_ = false;
 
         class PrivateObserver : public Observer {
           public:
@@ -332,6 +357,7 @@ namespace QuantLib {
             denseParameters_ = sabrCalibration(volCubeAtmCalibrated_);
             denseParameters_.updateInterpolators();
         }
+        smileSectionCache_.clear();
         notifyObservers();
     }
 
@@ -354,31 +380,44 @@ namespace QuantLib {
 
         const std::vector<Matrix>& tmpMarketVolCube = marketVolCube.points();
 
-        std::vector<Real> strikes(strikeSpreads_.size());
-        std::vector<Real> volatilities(strikeSpreads_.size());
-
+        // market data and guesses are collected first, since they
+        // involve term structures and other lazy objects; the smile
+        // fits themselves only depend on these inputs.
+        const Size nSmiles = optionTimes.size()*swapLengths.size();
+        std::vector<std::vector<Real> > strikes(nSmiles), volatilities(nSmiles);
+        std::vector<std::vector<Real> > guesses(nSmiles);
+        std::vector<Real> shifts(nSmiles);
         for (Size j=0; j<optionTimes.size(); j++) {
             for (Size k=0; k<swapLengths.size(); k++) {
+                const Size n = j*swapLengths.size()+k;
                 Rate atmForward = atmStrike(optionDates[j], swapTenors[k]);
-                Real shiftTmp = atmVol_->shift(optionTimes[j], swapLengths[k]);
-                strikes.clear();
-                volatilities.clear();
+                shifts[n] = atmVol_->shift(optionTimes[j], swapLengths[k]);
                 for (Size i=0; i<nStrikes_; i++){
                     Real strike = atmForward+strikeSpreads_[i];
-                    if(strike + shiftTmp >=cutoffStrike_) {
-                        strikes.push_back(strike);
-                        volatilities.push_back(tmpMarketVolCube[i][j][k]);
+                    if(strike + shifts[n] >=cutoffStrike_) {
+                        strikes[n].push_back(strike);
+                        volatilities[n].push_back(tmpMarketVolCube[i][j][k]);
                     }
                 }
+                forwards[j][k] = atmForward;
+                guesses[n] = parametersGuess_(optionTimes[j], swapLengths[k]);
+            }
+        }
 
-                const std::vector<Real>& guess =
-                    parametersGuess_(optionTimes[j], swapLengths[k]);
-
+        std::vector<std::string> failures(nSmiles);
+        #if defined(_OPENMP)
+        #pragma omp parallel for schedule(dynamic) if(parallelCalibration_)
+        #endif
+        for (long n=0; n<static_cast<long>(nSmiles); ++n) {
+            const Size j = n / swapLengths.size(), k = n % swapLengths.size();
+            try {
+                const std::vector<Real>& guess = guesses[n];
                 const ext::shared_ptr<typename Model::Interpolation> sabrInterpolation =
                     ext::shared_ptr<typename Model::Interpolation>(new
-                                          (typename Model::Interpolation)(strikes.begin(), strikes.end(),
-                                          volatilities.begin(),
-                                          optionTimes[j], atmForward,
+                                          (typename Model::Interpolation)(strikes[n].begin(),
+                                          strikes[n].end(),
+                                          volatilities[n].begin(),
+                                          optionTimes[j], forwards[j][k],
                                           guess[0], guess[1],
                                           guess[2], guess[3],
                                           isParameterFixed_[0],
@@ -391,20 +430,26 @@ namespace QuantLib {
                                           errorAccept_,
                                           useMaxError_,
                                           maxGuesses_,
-                                          shiftTmp,
+                                          shifts[n],
                                           volatilityType_));
                 sabrInterpolation->update();
 
-                Real rmsError = sabrInterpolation->rmsError();
-                Real maxError = sabrInterpolation->maxError();
                 alphas     [j][k] = sabrInterpolation->alpha();
                 betas      [j][k] = sabrInterpolation->beta();
                 nus        [j][k] = sabrInterpolation->nu();
                 rhos       [j][k] = sabrInterpolation->rho();
-                forwards   [j][k] = atmForward;
-                errors     [j][k] = rmsError;
-                maxErrors  [j][k] = maxError;
+                errors     [j][k] = sabrInterpolation->rmsError();
+                maxErrors  [j][k] = sabrInterpolation->maxError();
                 endCriteria[j][k] = sabrInterpolation->endCriteria();
+            } catch (std::exception& e) {
+                failures[n] = e.what();
+            }
+        }
+
+        for (Size j=0; j<optionTimes.size(); j++) {
+            for (Size k=0; k<swapLengths.size(); k++) {
+                const Size n = j*swapLengths.size()+k;
+                QL_REQUIRE(failures[n].empty(), failures[n]);
 
                 QL_ENSURE(endCriteria[j][k] != Integer(EndCriteria::MaxIterations),
                           "global swaptions calibration failed: "
@@ -419,7 +464,7 @@ namespace QuantLib {
                           "   rho = " <<  rhos[j][k]  << "\n"
                           );
 
-                QL_ENSURE((useMaxError_ ? maxError : rmsError) < maxErrorTolerance_,
+                QL_ENSURE((useMaxError_ ? maxErrors[j][k] : errors[j][k]) < maxErrorTolerance_,
                           "global swaptions calibration failed: "
                           "error tolerance exceeded: "
                               << "\n"
@@ -782,10 +827,13 @@ namespace QuantLib {
     template<class Model> ext::shared_ptr<SmileSection>
     SwaptionVolCube1x<Model>::smileSectionImpl(Time optionTime,
                                        Time swapLength) const {
-        if (isAtmCalibrated_)
-            return smileSection(optionTime, swapLength, denseParameters_);
-        else
-            return smileSection(optionTime, swapLength, sparseParameters_);
+        calculate();
+        return smileSectionCache_.section(optionTime, swapLength, [&]() {
+            if (isAtmCalibrated_)
+                return smileSection(optionTime, swapLength, denseParameters_);
+            else
+                return smileSection(optionTime, swapLength, sparseParameters_);
+        });
     }
 
     template<class Model> Matrix SwaptionVolCube1x<Model>::sparseSabrParameters() const {
@@ -845,6 +893,7 @@ namespace QuantLib {
             sabrCalibrationSection(volCubeAtmCalibrated_, denseParameters_,
                                    swapTenor);
         }
+        smileSectionCache_.clear();
         notifyObservers();
 
     }
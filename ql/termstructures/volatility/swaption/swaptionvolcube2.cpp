@@ -85,30 +85,32 @@ namespace QuantLib {
     SwaptionVolCube2::smileSectionImpl(const Date& optionDate,
                                        const Period& swapTenor) const {
         calculate();
-        Rate atmForward = atmStrike(optionDate, swapTenor);
-        Volatility atmVol = atmVol_->volatility(optionDate,
-                                                swapTenor,
-                                                atmForward);
         Time optionTime = timeFromReference(optionDate);
-        Real exerciseTimeSqrt = std::sqrt(optionTime);
-        std::vector<Real> strikes, stdDevs;
-        strikes.reserve(nStrikes_);
-        stdDevs.reserve(nStrikes_);
         Time length = swapLength(swapTenor);
-        for (Size i=0; i<nStrikes_; ++i) {
-            strikes.push_back(atmForward + strikeSpreads_[i]);
-            stdDevs.push_back(exerciseTimeSqrt*(
-                atmVol + volSpreadsInterpolator_[i](length, optionTime)));
-        }
-        Real shift = atmVol_->shift(optionTime,length);
-        return ext::shared_ptr<SmileSection>(new
-            InterpolatedSmileSection<Linear>(optionTime,
-                                             strikes,
-                                             stdDevs,
-                                             atmForward,
-                                             Linear(),
-                                             Actual365Fixed(),
-                                             volatilityType(),
-                                             shift));
+        return smileSectionCache_.section(optionTime, length, [&]() {
+            Rate atmForward = atmStrike(optionDate, swapTenor);
+            Volatility atmVol = atmVol_->volatility(optionDate,
+                                                    swapTenor,
+                                                    atmForward);
+            Real exerciseTimeSqrt = std::sqrt(optionTime);
+            std::vector<Real> strikes, stdDevs;
+            strikes.reserve(nStrikes_);
+            stdDevs.reserve(nStrikes_);
+            for (Size i=0; i<nStrikes_; ++i) {
+                strikes.push_back(atmForward + strikeSpreads_[i]);
+                stdDevs.push_back(exerciseTimeSqrt*(
+                    atmVol + volSpreadsInterpolator_[i](length, optionTime)));
+            }
+            Real shift = atmVol_->shift(optionTime,length);
+            return ext::shared_ptr<SmileSection>(new
+                InterpolatedSmileSection<Linear>(optionTime,
+                                                 strikes,
+                                                 stdDevs,
+                                                 atmForward,
+                                                 Linear(),
+                                                 Actual365Fixed(),
+                                                 volatilityType(),
+                                                 shift));
+        });
     }
 }
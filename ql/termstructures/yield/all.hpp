@@ -4,6 +4,7 @@
 #include <ql/termstructures/yield/bondhelpers.hpp>
 #include <ql/termstructures/yield/bootstraptraits.hpp>
 #include <ql/termstructures/yield/compositezeroyieldstructure.hpp>
+#include <ql/termstructures/yield/curvebootstrapscheduler.hpp>
 #include <ql/termstructures/yield/discountcurve.hpp>
 #include <ql/termstructures/yield/drifttermstructure.hpp>
 #include <ql/termstructures/yield/fittedbonddiscountcurve.hpp>
@@ -0,0 +1,216 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/patterns/lazyobjectprofiler.hpp>
+#include <ql/termstructures/yield/curvebootstrapscheduler.hpp>
+#include <ql/utilities/dataformatters.hpp>
+#include <map>
+#include <set>
+
+namespace QuantLib {
+
+    namespace {
+
+        // collects the curves that the given helper depends on, as
+        // well as the lazy objects outside the schedule.  The walk
+        // goes through the observables the helper is registered with
+        // (quotes, handles, indexes, other term structures...) and
+        // stops whenever one of the scheduled curves is reached.
+        void collectDependencies(const RateHelper& helper,
+                                 const std::map<const Observable*, Size>& curves,
+                                 Size self,
+                                 std::set<const Observable*>& visited,
+                                 std::set<Size>& dependencies,
+                                 std::vector<ext::shared_ptr<LazyObject> >& unscheduled) {
+            std::vector<ext::shared_ptr<Observable> > stack = helper.observables();
+            while (!stack.empty()) {
+                ext::shared_ptr<Observable> o = stack.back();
+                stack.pop_back();
+                if (!visited.insert(o.get()).second)
+                    continue;
+                auto c = curves.find(o.get());
+                if (c != curves.end()) {
+                    if (c->second != self)
+                        dependencies.insert(c->second);
+                    continue;
+                }
+                auto lazy = ext::dynamic_pointer_cast<LazyObject>(o);
+                if (lazy != nullptr)
+                    unscheduled.push_back(lazy);
+                auto* observer = dynamic_cast<Observer*>(o.get());
+                if (observer != nullptr) {
+                    std::vector<ext::shared_ptr<Observable> > next =
+                        observer->observables();
+                    stack.insert(stack.end(), next.begin(), next.end());
+                }
+            }
+        }
+
+    }
+
+    Size CurveBootstrapScheduler::add(
+                ext::shared_ptr<YieldTermStructure> curve,
+                const std::vector<ext::shared_ptr<RateHelper> >& instruments) {
+        QL_REQUIRE(curve, "null curve given");
+        for (const auto& c : curves_)
+            QL_REQUIRE(c != curve, "curve already scheduled");
+        for (const auto& h : instruments) {
+            QL_REQUIRE(h, "null helper given");
+            for (Size i=0; i<instruments_.size(); ++i) {
+                QL_REQUIRE(std::find(instruments_[i].begin(), instruments_[i].end(), h) ==
+                               instruments_[i].end(),
+                           "helper already used for the " << io::ordinal(i + 1) << " curve");
+            }
+        }
+        curves_.push_back(std::move(curve));
+        instruments_.push_back(instruments);
+        discovered_ = false;
+        return curves_.size() - 1;
+    }
+
+    const ext::shared_ptr<YieldTermStructure>&
+    CurveBootstrapScheduler::curve(Size i) const {
+        QL_REQUIRE(i < curves_.size(), "curve #" << i << " doesn't exist");
+        return curves_[i];
+    }
+
+    const std::vector<Size>& CurveBootstrapScheduler::dependencies(Size i) const {
+        QL_REQUIRE(i < curves_.size(), "curve #" << i << " doesn't exist");
+        discoverDependencies();
+        return dependencies_[i];
+    }
+
+    const std::vector<ext::shared_ptr<LazyObject> >&
+    CurveBootstrapScheduler::unscheduledDependencies(Size i) const {
+        QL_REQUIRE(i < curves_.size(), "curve #" << i << " doesn't exist");
+        discoverDependencies();
+        return unscheduled_[i];
+    }
+
+    const std::vector<std::vector<Size> >& CurveBootstrapScheduler::levels() const {
+        discoverDependencies();
+        return levels_;
+    }
+
+    void CurveBootstrapScheduler::discoverDependencies() const {
+        if (discovered_)
+            return;
+
+        Size n = curves_.size();
+        std::map<const Observable*, Size> curves;
+        for (Size i=0; i<n; ++i)
+            curves[curves_[i].get()] = i;
+
+        dependencies_.assign(n, std::vector<Size>());
+        unscheduled_.assign(n, std::vector<ext::shared_ptr<LazyObject> >());
+        for (Size i=0; i<n; ++i) {
+            std::set<const Observable*> visited;
+            std::set<Size> found;
+            for (const auto& h : instruments_[i])
+                collectDependencies(*h, curves, i, visited, found, unscheduled_[i]);
+            dependencies_[i].assign(found.begin(), found.end());
+        }
+
+        // each curve goes one level above the highest of its dependencies
+        levels_.clear();
+        std::vector<Size> level(n, Null<Size>());
+        Size assigned = 0;
+        while (assigned < n) {
+            std::vector<Size> current;
+            for (Size i=0; i<n; ++i) {
+                if (level[i] != Null<Size>())
+                    continue;
+                bool ready = true;
+                for (Size d : dependencies_[i]) {
+                    if (level[d] == Null<Size>() || level[d] == levels_.size()) {
+                        ready = false;
+                        break;
+                    }
+                }
+                if (ready)
+                    current.push_back(i);
+            }
+            QL_REQUIRE(!current.empty(),
+                       "circular dependency between the scheduled curves");
+            for (Size i : current)
+                level[i] = levels_.size();
+            assigned += current.size();
+            levels_.push_back(current);
+        }
+
+        discovered_ = true;
+    }
+
+    void CurveBootstrapScheduler::bootstrap() const {
+        #ifdef _OPENMP
+        ObservableSettings& settings = ObservableSettings::instance();
+        // notifications can only be dropped safely if they are
+        // enabled; deferred or batched updates would be collected
+        // concurrently
+        bool parallel = settings.updatesEnabled() && !settings.updatesBatched();
+        #if defined(QL_ENABLE_PROFILING)
+        // the profiler is not thread-safe
+        if (LazyObjectProfiler::instance().enabled())
+            parallel = false;
+        #endif
+        #endif
+
+        for (const auto& level : levels()) {
+            std::vector<std::string> errors(level.size());
+
+            #ifdef _OPENMP
+            bool concurrent = parallel && level.size() > 1;
+            if (concurrent) {
+                // nothing outside the schedule must be calculated
+                // concurrently; the walk only reaches objects whose
+                // scheduled dependencies are in previous levels
+                for (Size i : level) {
+                    try {
+                        for (const auto& lazy : unscheduled_[i])
+                            lazy->calculate();
+                    } catch (std::exception& e) {
+                        QL_FAIL(io::ordinal(i + 1) << " curve: " << e.what());
+                    }
+                }
+                settings.disableUpdates(false);
+            }
+            #endif
+
+            #pragma omp parallel for schedule(dynamic) if(concurrent)
+            for (long k=0; k<(long)level.size(); ++k) {
+                try {
+                    // the curves perform their bootstrap on first access
+                    curves_[level[k]]->maxDate();
+                } catch (std::exception& e) {
+                    errors[k] = e.what();
+                } catch (...) {
+                    errors[k] = "unknown error";
+                }
+            }
+
+            #ifdef _OPENMP
+            if (concurrent)
+                settings.enableUpdates();
+            #endif
+
+            for (Size k=0; k<level.size(); ++k)
+                QL_REQUIRE(errors[k].empty(),
+                           io::ordinal(level[k] + 1) << " curve: " << errors[k]);
+        }
+    }
+
+}
@@ -0,0 +1,101 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file curvebootstrapscheduler.hpp
+    \brief Scheduler for bootstrapping interdependent yield curves
+*/
+
+#ifndef quantlib_curve_bootstrap_scheduler_hpp
+#define quantlib_curve_bootstrap_scheduler_hpp
+
+#include <ql/termstructures/yield/ratehelpers.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! bootstraps a set of interdependent yield curves
+    /*! Curves are added together with the helpers used to bootstrap
+        them.  The dependencies between curves (e.g., an IBOR curve
+        bootstrapped on swaps discounted on an OIS curve, or a
+        cross-currency curve using both) are discovered by walking
+        the observables that each helper is registered with, such as
+        term-structure handles and indexes, until one of the other
+        curves is reached.  The curves are then grouped in levels so
+        that each curve only depends on curves in previous levels.
+
+        When the library is compiled with OpenMP support, the curves
+        in the same level are bootstrapped concurrently; otherwise,
+        or when the lazy-object profiler is enabled, they are
+        bootstrapped one after the other in level order.  Lazy
+        objects that are not scheduled but are reached by the walk,
+        e.g., an exogenous discount curve shared by several curves,
+        are calculated one after the other before the level of the
+        curves depending on them, so that they are never calculated
+        concurrently.
+
+        \warning During the concurrent phase, notifications are
+                 disabled for the whole process through
+                 ObservableSettings, since the observer pattern is
+                 not thread-safe.  Any notification sent in the
+                 meantime is lost, including the ones sent by other
+                 threads, e.g., when setting the value of a quote
+                 unrelated to the curves; observers are not
+                 notified again when updates are enabled.  No other
+                 thread should use the library while bootstrap() is
+                 running.  A helper can only be used for one curve;
+                 this is checked when the curves are added.
+
+        \ingroup yieldtermstructures
+    */
+    class CurveBootstrapScheduler {
+      public:
+        /*! Adds a curve to the schedule and returns its position.
+            The curve is bootstrapped when it is first queried, as
+            is the case for PiecewiseYieldCurve.
+        */
+        Size add(ext::shared_ptr<YieldTermStructure> curve,
+                 const std::vector<ext::shared_ptr<RateHelper> >& instruments);
+        //! \name Inspectors
+        //@{
+        Size size() const { return curves_.size(); }
+        const ext::shared_ptr<YieldTermStructure>& curve(Size i) const;
+        //! positions of the curves the i-th curve depends on
+        const std::vector<Size>& dependencies(Size i) const;
+        //! lazy objects outside the schedule the i-th curve depends on
+        const std::vector<ext::shared_ptr<LazyObject> >&
+        unscheduledDependencies(Size i) const;
+        /*! curves grouped by level; the curves in a level only
+            depend on curves in previous levels.
+        */
+        const std::vector<std::vector<Size> >& levels() const;
+        //@}
+        //! bootstraps all the curves
+        void bootstrap() const;
+
+      private:
+        void discoverDependencies() const;
+        std::vector<ext::shared_ptr<YieldTermStructure> > curves_;
+        std::vector<std::vector<ext::shared_ptr<RateHelper> > > instruments_;
+        mutable std::vector<std::vector<Size> > dependencies_, levels_;
+        mutable std::vector<std::vector<ext::shared_ptr<LazyObject> > >
+            unscheduled_;
+        mutable bool discovered_ = false;
+    };
+
+}
+
+#endif
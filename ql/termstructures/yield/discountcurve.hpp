@@ -95,6 +95,8 @@ namespace QuantLib {
         //! \name YieldTermStructure implementation
         //@{
         DiscountFactor discountImpl(Time) const override;
+        void discountsImpl(const std::vector<Time>& times,
+                           std::vector<DiscountFactor>& discounts) const override;
         //@}
         mutable std::vector<Date> dates_;
       private:
@@ -168,6 +170,20 @@ namespace QuantLib {
         return dMax * std::exp(- instFwdMax * (t-tMax));
     }
 
+    template <class T>
+    void InterpolatedDiscountCurve<T>::discountsImpl(
+                                const std::vector<Time>& times,
+                                std::vector<DiscountFactor>& discounts) const {
+        this->interpolation_(times, discounts, true);
+
+        // flat fwd extrapolation
+        Time tMax = this->times_.back();
+        for (Size i=0; i<times.size(); ++i) {
+            if (times[i] > tMax)
+                discounts[i] = discountImpl(times[i]);
+        }
+    }
+
     template <class T>
     InterpolatedDiscountCurve<T>::InterpolatedDiscountCurve(
                                     const DayCounter& dayCounter,
@@ -19,6 +19,8 @@
 */
 
 #include <ql/cashflows/cashflows.hpp>
+#include <ql/cashflows/fixedratecoupon.hpp>
+#include <ql/cashflows/simplecashflow.hpp>
 #include <ql/math/optimization/constraint.hpp>
 #include <ql/math/optimization/costfunction.hpp>
 #include <ql/math/optimization/simplex.hpp>
@@ -26,6 +28,7 @@
 #include <ql/termstructures/yield/fittedbonddiscountcurve.hpp>
 #include <ql/time/daycounters/simpledaycounter.hpp>
 #include <ql/utilities/dataformatters.hpp>
+#include <string>
 #include <utility>
 
 using std::vector;
@@ -173,6 +176,88 @@ namespace QuantLib {
             QL_REQUIRE(l2_.size() == size(),
                        "Given penalty factors do not cover all parameters");
         }
+
+        // store the cash flows of the bonds whose amounts don't
+        // depend on the fitted curve, so that the cost function can
+        // price them without going through their pricing engines
+        cashflowTimes_.assign(n, std::vector<Time>());
+        cashflowAmounts_.assign(n, std::vector<Real>());
+        notionals_.assign(n, 0.0);
+        accruedAmounts_.assign(n, 0.0);
+        for (Size i=0; i<n; ++i) {
+            const ext::shared_ptr<BondHelper>& helper = curve_->bondHelpers_[i];
+            ext::shared_ptr<Bond> bond = helper->bond();
+            Date bondSettlement = bond->settlementDate();
+
+            std::vector<Time> times(1, curve_->timeFromReference(bondSettlement));
+            std::vector<Real> amounts(1, 0.0);
+            bool fixed = true;
+            for (const auto& cf : bond->cashflows()) {
+                // same as in the discounting bond engine
+                if (cf->hasOccurred(bondSettlement, false) ||
+                    cf->tradingExCoupon(bondSettlement))
+                    continue;
+                if (ext::dynamic_pointer_cast<FixedRateCoupon>(cf) == nullptr &&
+                    ext::dynamic_pointer_cast<SimpleCashFlow>(cf) == nullptr) {
+                    fixed = false;
+                    break;
+                }
+                times.push_back(curve_->timeFromReference(cf->date()));
+                amounts.push_back(cf->amount());
+            }
+            if (!fixed)
+                continue;
+
+            cashflowTimes_[i] = std::move(times);
+            cashflowAmounts_[i] = std::move(amounts);
+            notionals_[i] = bond->notional(bondSettlement);
+            if (helper->priceType() == Bond::Price::Clean)
+                accruedAmounts_[i] = bond->accruedAmount(bondSettlement);
+        }
+    }
+
+    Real FittedBondDiscountCurve::FittingMethod::impliedQuote(const Array& x,
+                                                              Size i) const {
+        const std::vector<Time>& times = cashflowTimes_[i];
+        const std::vector<Real>& amounts = cashflowAmounts_[i];
+        if (notionals_[i] == 0.0)
+            return -accruedAmounts_[i];
+
+        std::vector<DiscountFactor> discounts;
+        discount(x, times, discounts);
+        Real npv = 0.0;
+        for (Size k=1; k<times.size(); ++k)
+            npv += amounts[k] * discounts[k];
+        Real dirtyPrice = (npv / discounts[0]) * 100.0 / notionals_[i];
+        return dirtyPrice - accruedAmounts_[i];
+    }
+
+    void FittedBondDiscountCurve::FittingMethod::discount(
+                                 const Array& x,
+                                 const std::vector<Time>& times,
+                                 std::vector<DiscountFactor>& discounts) const {
+        discounts.resize(times.size());
+        bool inside = true;
+        for (Time t : times) {
+            if (t < minCutoffTime_ || t > maxCutoffTime_) {
+                inside = false;
+                break;
+            }
+        }
+        if (inside) {
+            discountFunctions(x, times, discounts);
+        } else {
+            for (Size i=0; i<times.size(); ++i)
+                discounts[i] = discount(x, times[i]);
+        }
+    }
+
+    void FittedBondDiscountCurve::FittingMethod::discountFunctions(
+                                 const Array& x,
+                                 const std::vector<Time>& times,
+                                 std::vector<DiscountFactor>& discounts) const {
+        for (Size i=0; i<times.size(); ++i)
+            discounts[i] = discountFunction(x, times[i]);
     }
 
     void FittedBondDiscountCurve::FittingMethod::calculate() {
@@ -256,10 +341,34 @@ namespace QuantLib {
         // the final solution will be set in FittingMethod::calculate() later on
         fittingMethod_->solution_ = x;
 
+        // bonds with stored cash flows first, possibly in parallel...
+        std::vector<Real> impliedQuotes(n, Null<Real>());
+        std::vector<std::string> failures(n);
+        #if defined(_OPENMP)
+        #pragma omp parallel for schedule(dynamic) if(n > 1 && fittingMethod_->isThreadSafe())
+        #endif
+        for (long i=0; i<(long)n; ++i) {
+            if (!fittingMethod_->cashflowTimes_[i].empty()) {
+                try {
+                    impliedQuotes[i] = fittingMethod_->impliedQuote(x, i);
+                } catch (std::exception& e) {
+                    failures[i] = e.what();
+                }
+            }
+        }
+        for (Size i=0; i<n; ++i) {
+            QL_REQUIRE(failures[i].empty(),
+                       "failed to price " << io::ordinal(i+1) << " bond: "
+                       << failures[i]);
+        }
+
+        // ...then the others through their pricing engines
         Array values(n + N);
         for (Size i=0; i<n; ++i) {
             ext::shared_ptr<BondHelper> helper = fittingMethod_->curve_->bondHelpers_[i];
-            Real error = helper->impliedQuote() - helper->quote()->value();
+            Real impliedQuote = impliedQuotes[i] != Null<Real>() ?
+                impliedQuotes[i] : helper->impliedQuote();
+            Real error = impliedQuote - helper->quote()->value();
             Real weightedError = fittingMethod_->weights_[i] * error;
             values[i] = weightedError * weightedError;
         }
@@ -31,6 +31,7 @@
 #include <ql/patterns/lazyobject.hpp>
 #include <ql/math/array.hpp>
 #include <ql/utilities/clone.hpp>
+#include <vector>
 
 namespace QuantLib {
 
@@ -126,6 +127,8 @@ namespace QuantLib {
         void setup();
         void performCalculations() const override;
         DiscountFactor discountImpl(Time) const override;
+        void discountsImpl(const std::vector<Time>& times,
+                           std::vector<DiscountFactor>& discounts) const override;
         // target accuracy level to be used in the optimization routine
         Real accuracy_;
         // max number of evaluations to be used in the optimization routine
@@ -205,6 +208,11 @@ namespace QuantLib {
         ext::shared_ptr<OptimizationMethod> optimizationMethod() const;
         //! open discountFunction to public
         DiscountFactor discount(const Array& x, Time t) const;
+        //! bulk version of discount(const Array&, Time)
+        /*! The passed vector is resized if needed. */
+        void discount(const Array& x,
+                      const std::vector<Time>& times,
+                      std::vector<DiscountFactor>& discounts) const;
       protected:
         //! constructors
         FittingMethod(bool constrainAtZero = true,
@@ -219,6 +227,18 @@ namespace QuantLib {
         //! discount function called by FittedBondDiscountCurve
         virtual DiscountFactor discountFunction(const Array& x,
                                                 Time t) const = 0;
+        /*! bulk discount function; the default implementation calls
+            discountFunction(x, t) for each time.  The passed vector
+            is already sized.
+        */
+        virtual void discountFunctions(const Array& x,
+                                       const std::vector<Time>& times,
+                                       std::vector<DiscountFactor>& discounts) const;
+        /*! whether the discount function can be called concurrently,
+            in which case the bonds are priced in parallel during the
+            fit when OpenMP is enabled.
+        */
+        virtual bool isThreadSafe() const { return false; }
 
         //! constrains discount function to unity at \f$ T=0 \f$, if true
         bool constrainAtZero_;
@@ -236,6 +256,8 @@ namespace QuantLib {
       private:
         // curve optimization called here- adjust optimization parameters here
         void calculate();
+        // price of the i-th bond from its stored cash flows
+        Real impliedQuote(const Array& x, Size i) const;
         // array of normalized (duration) weights, one for each bond helper
         Array weights_;
         // array of l2 penalties one for each parameter
@@ -253,6 +275,12 @@ namespace QuantLib {
         ext::shared_ptr<OptimizationMethod> optimizationMethod_;
         // flat extrapolation of instantaneous forward before / after cutoff
         Real minCutoffTime_, maxCutoffTime_;
+        // times (settlement first) and amounts of the alive cash flows
+        // of each bond, stored in init() when the amounts are fixed;
+        // bonds with empty times are priced by their helpers
+        std::vector<std::vector<Time> > cashflowTimes_;
+        std::vector<std::vector<Real> > cashflowAmounts_;
+        std::vector<Real> notionals_, accruedAmounts_;
     };
 
     // inline
@@ -287,6 +315,13 @@ namespace QuantLib {
         return fittingMethod_->discount(fittingMethod_->solution_, t);
     }
 
+    inline void FittedBondDiscountCurve::discountsImpl(
+                                 const std::vector<Time>& times,
+                                 std::vector<DiscountFactor>& discounts) const {
+        calculate();
+        fittingMethod_->discount(fittingMethod_->solution_, times, discounts);
+    }
+
     inline Integer
     FittedBondDiscountCurve::FittingMethod::numberOfIterations() const {
         return numberOfIterations_;
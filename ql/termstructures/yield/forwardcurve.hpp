@@ -96,6 +96,11 @@ namespace QuantLib {
         Rate forwardImpl(Time t) const override;
         Rate zeroYieldImpl(Time t) const override;
         //@}
+        //! \name YieldTermStructure implementation
+        //@{
+        void discountsImpl(const std::vector<Time>& times,
+                           std::vector<DiscountFactor>& discounts) const override;
+        //@}
         mutable std::vector<Date> dates_;
       private:
         void initialize();
@@ -178,6 +183,28 @@ namespace QuantLib {
         return integral/t;
     }
 
+    template <class T>
+    void InterpolatedForwardCurve<T>::discountsImpl(
+                                const std::vector<Time>& times,
+                                std::vector<DiscountFactor>& discounts) const {
+        // integrated forwards first, then converted in place
+        this->interpolation_.primitive(times, discounts, true);
+
+        // flat fwd extrapolation
+        Time tMax = this->times_.back();
+        Real integralMax = this->interpolation_.primitive(tMax, true);
+        for (Size i=0; i<times.size(); ++i) {
+            Time t = times[i];
+            if (t == 0.0) {
+                discounts[i] = 1.0;
+            } else {
+                Real integral = (t <= tMax) ? discounts[i] :
+                    integralMax + this->data_.back()*(t - tMax);
+                discounts[i] = std::exp(-integral);
+            }
+        }
+    }
+
     template <class T>
     InterpolatedForwardCurve<T>::InterpolatedForwardCurve(
                                     const DayCounter& dayCounter,
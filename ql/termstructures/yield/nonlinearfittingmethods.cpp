@@ -101,6 +101,38 @@ namespace QuantLib {
         return d;
     }
 
+    void ExponentialSplinesFitting::discountFunctions(
+                                 const Array& x,
+                                 const std::vector<Time>& times,
+                                 std::vector<DiscountFactor>& discounts) const {
+        Size N = size();
+        Real kappa = (fixedKappa_ != Null<Real>()) ? fixedKappa_: x[N-1];
+
+        // a[i] multiplies exp(-kappa*(i+1)*t); the sum is evaluated
+        // with Horner's scheme, so that one exponential per time is
+        // needed instead of one per coefficient
+        std::vector<Real> a(N, 0.0);
+        if (!constrainAtZero_) {
+            for (Size i = 0; i < N - 1; ++i)
+                a[i] = x[i];
+        } else {
+            Real coeff = 0.0;
+            for (Size i = 0; i < N - 1; ++i) {
+                a[i + 1] = x[i];
+                coeff += x[i];
+            }
+            a[0] = 1.0 - coeff;
+        }
+
+        for (Size j = 0; j < times.size(); ++j) {
+            Real e = std::exp(-kappa * times[j]);
+            Real d = 0.0;
+            for (Size i = N; i > 0; --i)
+                d = d * e + a[i - 1];
+            discounts[j] = d * e;
+        }
+    }
+
 
     NelsonSiegelFitting::NelsonSiegelFitting(
         const Array& weights,
@@ -138,6 +170,21 @@ namespace QuantLib {
         return d;
     }
 
+    void NelsonSiegelFitting::discountFunctions(
+                                 const Array& x,
+                                 const std::vector<Time>& times,
+                                 std::vector<DiscountFactor>& discounts) const {
+        Real kappa = x[size()-1];
+        for (Size j = 0; j < times.size(); ++j) {
+            Time t = times[j];
+            Real e = std::exp(-kappa*t);
+            Real zeroRate = x[0] + (x[1] + x[2])*
+                            (1.0 - e)/((kappa+QL_EPSILON)*(t+QL_EPSILON)) -
+                            (x[2])*e;
+            discounts[j] = std::exp(-zeroRate * t);
+        }
+    }
+
 
     SvenssonFitting::SvenssonFitting(const Array& weights,
                                      const ext::shared_ptr<OptimizationMethod>& optimizationMethod,
@@ -176,6 +223,24 @@ namespace QuantLib {
         return d;
     }
 
+    void SvenssonFitting::discountFunctions(
+                                 const Array& x,
+                                 const std::vector<Time>& times,
+                                 std::vector<DiscountFactor>& discounts) const {
+        Real kappa = x[size()-2];
+        Real kappa_1 = x[size()-1];
+        for (Size j = 0; j < times.size(); ++j) {
+            Time t = times[j];
+            Real e = std::exp(-kappa*t);
+            Real e_1 = std::exp(-kappa_1*t);
+            Real zeroRate = x[0] + (x[1] + x[2])*
+                            (1.0 - e)/((kappa+QL_EPSILON)*(t+QL_EPSILON)) -
+                            (x[2])*e +
+                            x[3]* (((1.0 - e_1)/((kappa_1+QL_EPSILON)*(t+QL_EPSILON)))- e_1);
+            discounts[j] = std::exp(-zeroRate * t);
+        }
+    }
+
 
     CubicBSplinesFitting::CubicBSplinesFitting(
         const std::vector<Time>& knots,
@@ -187,7 +252,7 @@ namespace QuantLib {
         const Real maxCutoffTime)
     : FittedBondDiscountCurve::FittingMethod(
           constrainAtZero, weights, optimizationMethod, l2, minCutoffTime, maxCutoffTime),
-      splines_(3, knots.size() - 5, knots) {
+      splines_(3, knots.size() - 5, knots), knots_(knots) {
 
         QL_REQUIRE(knots.size() >= 8,
                    "At least 8 knots are required" );
@@ -215,7 +280,7 @@ namespace QuantLib {
         const Real minCutoffTime, const Real maxCutoffTime)
         : FittedBondDiscountCurve::FittingMethod(constrainAtZero, weights, ext::shared_ptr<OptimizationMethod>(), l2,
                                                  minCutoffTime, maxCutoffTime),
-        splines_(3, knots.size() - 5, knots) {
+        splines_(3, knots.size() - 5, knots), knots_(knots) {
 
         QL_REQUIRE(knots.size() >= 8,
             "At least 8 knots are required");
@@ -279,6 +344,38 @@ namespace QuantLib {
         return d;
     }
 
+    void CubicBSplinesFitting::discountFunctions(
+                                 const Array& x,
+                                 const std::vector<Time>& times,
+                                 std::vector<DiscountFactor>& discounts) const {
+        // the coefficient of the N_th basis function doesn't depend on t
+        Real coeff = 0.0;
+        if (constrainAtZero_) {
+            const Real T = 0.0;
+            Real sum = 0.0;
+            for (Size i=0; i<size_; ++i)
+                sum += x[i] * splines_(i < N_ ? i : i+1, T);
+            coeff = (1.0 - sum) / splines_(N_,T);
+        }
+
+        // only the basis functions whose support contains t are evaluated
+        auto inSupport = [this](Size i, Time t) {
+            return knots_[i] <= t && t < knots_[i+4];
+        };
+        for (Size j=0; j<times.size(); ++j) {
+            Time t = times[j];
+            DiscountFactor d = 0.0;
+            for (Size i=0; i<size_; ++i) {
+                Size k = (constrainAtZero_ && i >= N_) ? i+1 : i;
+                if (inSupport(k, t))
+                    d += x[i] * splines_(k,t);
+            }
+            if (constrainAtZero_ && inSupport(N_, t))
+                d += coeff * splines_(N_,t);
+            discounts[j] = d;
+        }
+    }
+
 
     SimplePolynomialFitting::SimplePolynomialFitting(
         Natural degree,
@@ -354,6 +451,17 @@ namespace QuantLib {
         return method_->discount(x, t)*discountingCurve_->discount(t, true)/rebase_;
     }
 
+    void SpreadFittingMethod::discountFunctions(
+                                 const Array& x,
+                                 const std::vector<Time>& times,
+                                 std::vector<DiscountFactor>& discounts) const {
+        std::vector<DiscountFactor> spreads, base;
+        method_->discount(x, times, spreads);
+        discountingCurve_->discount(times, base, true);
+        for (Size i=0; i<times.size(); ++i)
+            discounts[i] = spreads[i]*base[i]/rebase_;
+    }
+
     void SpreadFittingMethod::init(){
         //In case discount curve has a different reference date,
         //discount to this curve's reference date
@@ -77,6 +77,10 @@ namespace QuantLib {
         Real fixedKappa_;
         Size size() const override;
         DiscountFactor discountFunction(const Array& x, Time t) const override;
+        void discountFunctions(const Array& x,
+                               const std::vector<Time>& times,
+                               std::vector<DiscountFactor>& discounts) const override;
+        bool isThreadSafe() const override { return true; }
     };
 
 
@@ -107,6 +111,10 @@ namespace QuantLib {
       private:
         Size size() const override;
         DiscountFactor discountFunction(const Array& x, Time t) const override;
+        void discountFunctions(const Array& x,
+                               const std::vector<Time>& times,
+                               std::vector<DiscountFactor>& discounts) const override;
+        bool isThreadSafe() const override { return true; }
     };
 
 
@@ -139,6 +147,10 @@ namespace QuantLib {
       private:
         Size size() const override;
         DiscountFactor discountFunction(const Array& x, Time t) const override;
+        void discountFunctions(const Array& x,
+                               const std::vector<Time>& times,
+                               std::vector<DiscountFactor>& discounts) const override;
+        bool isThreadSafe() const override { return true; }
     };
 
 
@@ -184,7 +196,12 @@ namespace QuantLib {
       private:
         Size size() const override;
         DiscountFactor discountFunction(const Array& x, Time t) const override;
+        void discountFunctions(const Array& x,
+                               const std::vector<Time>& times,
+                               std::vector<DiscountFactor>& discounts) const override;
+        bool isThreadSafe() const override { return true; }
         BSpline splines_;
+        std::vector<Time> knots_;
         Size size_;
         //! N_th basis function coefficient to solve for when d(0)=1
         Natural N_;
@@ -222,6 +239,7 @@ namespace QuantLib {
       private:
         Size size() const override;
         DiscountFactor discountFunction(const Array& x, Time t) const override;
+        bool isThreadSafe() const override { return true; }
         Size size_;
     };
 
@@ -243,6 +261,9 @@ namespace QuantLib {
     private:
       Size size() const override;
       DiscountFactor discountFunction(const Array& x, Time t) const override;
+      void discountFunctions(const Array& x,
+                             const std::vector<Time>& times,
+                             std::vector<DiscountFactor>& discounts) const override;
       // underlying parametric method
       ext::shared_ptr<FittingMethod> method_;
       // adjustment in case underlying discount curve has different reference date
@@ -176,6 +176,8 @@ namespace QuantLib {
         //@}
         // methods
         DiscountFactor discountImpl(Time) const override;
+        void discountsImpl(const std::vector<Time>& times,
+                           std::vector<DiscountFactor>& discounts) const override;
         // data members
         std::vector<ext::shared_ptr<typename Traits::helper> > instruments_;
         Real accuracy_;
@@ -246,6 +248,14 @@ namespace QuantLib {
         return base_curve::discountImpl(t);
     }
 
+    template <class C, class I, template <class> class B>
+    inline void PiecewiseYieldCurve<C,I,B>::discountsImpl(
+                                const std::vector<Time>& times,
+                                std::vector<DiscountFactor>& discounts) const {
+        calculate();
+        base_curve::discountsImpl(times, discounts);
+    }
+
     template <class C, class I, template <class> class B>
     inline void PiecewiseYieldCurve<C,I,B>::performCalculations() const {
         // just delegate to the bootstrapper
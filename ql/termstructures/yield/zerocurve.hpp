@@ -103,6 +103,11 @@ namespace QuantLib {
         //@{
         Rate zeroYieldImpl(Time t) const override;
         //@}
+        //! \name YieldTermStructure implementation
+        //@{
+        void discountsImpl(const std::vector<Time>& times,
+                           std::vector<DiscountFactor>& discounts) const override;
+        //@}
         mutable std::vector<Date> dates_;
       private:
         void initialize(const Compounding& compounding, const Frequency& frequency);
@@ -169,6 +174,25 @@ namespace QuantLib {
         return (zMax * tMax + instFwdMax * (t-tMax)) / t;
     }
 
+    template <class T>
+    void InterpolatedZeroCurve<T>::discountsImpl(
+                                const std::vector<Time>& times,
+                                std::vector<DiscountFactor>& discounts) const {
+        // zero rates first, then converted in place
+        this->interpolation_(times, discounts, true);
+
+        Time tMax = this->times_.back();
+        for (Size i=0; i<times.size(); ++i) {
+            Time t = times[i];
+            if (t == 0.0) {
+                discounts[i] = 1.0;
+            } else {
+                Rate r = (t <= tMax) ? discounts[i] : zeroYieldImpl(t);
+                discounts[i] = std::exp(-r*t);
+            }
+        }
+    }
+
     template <class T>
     InterpolatedZeroCurve<T>::InterpolatedZeroCurve(
                                     const DayCounter& dayCounter,
@@ -21,6 +21,7 @@
 
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <ql/utilities/dataformatters.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace QuantLib {
@@ -80,6 +81,10 @@ namespace QuantLib {
         if (jumps_.empty())
             return discountImpl(t);
 
+        return jumpEffect(t) * discountImpl(t);
+    }
+
+    DiscountFactor YieldTermStructure::jumpEffect(Time t) const {
         DiscountFactor jumpEffect = 1.0;
         for (Size i=0; i<nJumps_; ++i) {
             if (jumpTimes_[i]>0 && jumpTimes_[i]<t) {
@@ -92,7 +97,36 @@ namespace QuantLib {
                 jumpEffect *= thisJump;
             }
         }
-        return jumpEffect * discountImpl(t);
+        return jumpEffect;
+    }
+
+    void YieldTermStructure::checkTimes(const std::vector<Time>& times,
+                                        bool extrapolate) const {
+        if (!times.empty()) {
+            auto bounds = std::minmax_element(times.begin(), times.end());
+            checkRange(*bounds.first, extrapolate);
+            checkRange(*bounds.second, extrapolate);
+        }
+    }
+
+    void YieldTermStructure::discountsImpl(
+                                const std::vector<Time>& times,
+                                std::vector<DiscountFactor>& discounts) const {
+        for (Size i=0; i<times.size(); ++i)
+            discounts[i] = discountImpl(times[i]);
+    }
+
+    void YieldTermStructure::discount(const std::vector<Time>& times,
+                                      std::vector<DiscountFactor>& discounts,
+                                      bool extrapolate) const {
+        checkTimes(times, extrapolate);
+        discounts.resize(times.size());
+        discountsImpl(times, discounts);
+
+        if (!jumps_.empty()) {
+            for (Size i=0; i<times.size(); ++i)
+                discounts[i] *= jumpEffect(times[i]);
+        }
     }
 
     InterestRate YieldTermStructure::zeroRate(const Date& d,
@@ -125,6 +159,53 @@ namespace QuantLib {
                                          t);
     }
 
+    void YieldTermStructure::zeroRate(const std::vector<Time>& times,
+                                      std::vector<Rate>& rates,
+                                      Compounding comp,
+                                      Frequency freq,
+                                      bool extrapolate) const {
+        std::vector<Time> t(times);
+        for (Time& ti : t)
+            if (ti == 0.0) ti = dt;
+        discount(t, rates, extrapolate);
+        for (Size i=0; i<t.size(); ++i)
+            rates[i] = InterestRate::impliedRate(1.0/rates[i],
+                                                 dayCounter(), comp, freq,
+                                                 t[i]).rate();
+    }
+
+    void YieldTermStructure::forwardRate(const std::vector<Time>& t1,
+                                         const std::vector<Time>& t2,
+                                         std::vector<Rate>& rates,
+                                         Compounding comp,
+                                         Frequency freq,
+                                         bool extrapolate) const {
+        QL_REQUIRE(t1.size() == t2.size(),
+                   "mismatch between start times (" << t1.size()
+                   << ") and end times (" << t2.size() << ")");
+        checkTimes(t1, extrapolate);
+        checkTimes(t2, extrapolate);
+
+        std::vector<Time> s1(t1), s2(t2);
+        for (Size i=0; i<s1.size(); ++i) {
+            if (s1[i] == s2[i]) {
+                s1[i] = std::max(s1[i] - dt/2.0, 0.0);
+                s2[i] = s1[i] + dt;
+            } else {
+                QL_REQUIRE(s2[i] > s1[i],
+                           "t2 (" << s2[i] << ") < t1 (" << s1[i] << ")");
+            }
+        }
+
+        std::vector<DiscountFactor> d1;
+        discount(s1, d1, true);
+        discount(s2, rates, true);
+        for (Size i=0; i<s1.size(); ++i)
+            rates[i] = InterestRate::impliedRate(d1[i]/rates[i],
+                                                 dayCounter(), comp, freq,
+                                                 s2[i]-s1[i]).rate();
+    }
+
     InterestRate YieldTermStructure::forwardRate(const Date& d1,
                                                  const Date& d2,
                                                  const DayCounter& dayCounter,
@@ -144,6 +144,46 @@ namespace QuantLib {
                                  bool extrapolate = false) const;
         //@}
 
+        /*! \name Bulk queries
+
+            These methods return discount factors, zero rates and
+            forward rates for a whole set of times at once, writing
+            them into the passed vector (which is resized if needed).
+            They are equivalent to the corresponding scalar methods
+            called for each time, but interpolated curves can serve
+            them with a single scan over their nodes when the times
+            are sorted in increasing order; sorting is not required
+            for correctness.
+
+            The same day-counting rule used by the term structure
+            should be used for calculating the passed times.
+        */
+        //@{
+        void discount(const std::vector<Time>& times,
+                      std::vector<DiscountFactor>& discounts,
+                      bool extrapolate = false) const;
+        /*! The returned rates are expressed with the given
+            compounding and frequency.
+        */
+        void zeroRate(const std::vector<Time>& times,
+                      std::vector<Rate>& rates,
+                      Compounding comp,
+                      Frequency freq = Annual,
+                      bool extrapolate = false) const;
+        /*! The i-th returned rate is the forward rate between
+            <tt>t1[i]</tt> and <tt>t2[i]</tt>, expressed with the
+            given compounding and frequency; as in the scalar
+            version, the instantaneous forward rate is returned when
+            the two times are equal.
+        */
+        void forwardRate(const std::vector<Time>& t1,
+                         const std::vector<Time>& t2,
+                         std::vector<Rate>& rates,
+                         Compounding comp,
+                         Frequency freq = Annual,
+                         bool extrapolate = false) const;
+        //@}
+
         //! \name Jump inspectors
         //@{
         const std::vector<Date>& jumpDates() const;
@@ -165,10 +205,18 @@ namespace QuantLib {
         //@{
         //! discount factor calculation
         virtual DiscountFactor discountImpl(Time) const = 0;
+        /*! bulk discount factor calculation; the default
+            implementation calls discountImpl(Time) for each time.
+            The passed vector is already sized.
+        */
+        virtual void discountsImpl(const std::vector<Time>& times,
+                                   std::vector<DiscountFactor>& discounts) const;
         //@}
       private:
         // methods
         void setJumps(const Date& referenceDate);
+        DiscountFactor jumpEffect(Time t) const;
+        void checkTimes(const std::vector<Time>& times, bool extrapolate) const;
         // data members
         std::vector<Handle<Quote> > jumps_;
         std::vector<Date> jumpDates_;
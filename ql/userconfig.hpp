@@ -47,6 +47,12 @@
 //#   define QL_ENABLE_TRACING
 #endif
 
+/* Define this if the recalculations of lazy objects can be profiled
+   (whether they actually are will depend on run-time settings.) */
+#ifndef QL_ENABLE_PROFILING
+//#   define QL_ENABLE_PROFILING
+#endif
+
 /* Define this if extra safety checks should be performed. This can degrade
    performance. */
 #ifndef QL_EXTRA_SAFETY_CHECKS
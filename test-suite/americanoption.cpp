@@ -28,6 +28,7 @@
 #include <ql/math/integrals/integral.hpp>
 #include <ql/math/integrals/gausslobattointegral.hpp>
 #include <ql/math/statistics/incrementalstatistics.hpp>
+#include <ql/pricingengines/chebyshevproxyengine.hpp>
 #include <ql/pricingengines/vanilla/analyticeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/baroneadesiwhaleyengine.hpp>
 #include <ql/pricingengines/vanilla/bjerksundstenslandengine.hpp>
@@ -1860,6 +1861,167 @@ void AmericanOptionTest::testQdNegativeDividendYield() {
     }
 }
 
+void AmericanOptionTest::testQdFpChainPricing() {
+    BOOST_TEST_MESSAGE("Testing QD+ fixed point chain pricing...");
+
+    SavedSettings backup;
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(5, December, 2022);
+    Settings::instance().evaluationDate() = today;
+    const Date maturityDate = today + Period(9, Months);
+
+    const auto spot = ext::make_shared<SimpleQuote>(100);
+    const auto qRate = ext::make_shared<SimpleQuote>(0.02);
+    const auto rRate = ext::make_shared<SimpleQuote>(0.05);
+    const auto vol = ext::make_shared<SimpleQuote>(0.25);
+
+    const auto process = ext::make_shared<BlackScholesMertonProcess>(
+        Handle<Quote>(spot),
+        Handle<YieldTermStructure>(flatRate(qRate, dc)),
+        Handle<YieldTermStructure>(flatRate(rRate, dc)),
+        Handle<BlackVolTermStructure>(flatVol(vol, dc))
+    );
+
+    std::vector<Real> strikes(1, 0.0);
+    for (Real K = 50.0; K <= 150.0; K += 5.0)
+        strikes.push_back(K);
+
+    const ext::shared_ptr<QdFpIterationScheme> schemes[] = {
+        QdFpAmericanEngine::fastScheme(),
+        QdFpAmericanEngine::accurateScheme(),
+        QdFpAmericanEngine::highPrecisionScheme()
+    };
+    const Option::Type types[] = { Option::Put, Option::Call };
+    const Rate rRates[] = { 0.05, -0.01 };
+
+    const Real tol = 1e-8;
+    for (const auto& scheme: schemes) {
+        const auto engine =
+            ext::make_shared<QdFpAmericanEngine>(process, scheme);
+
+        for (auto r: rRates) {
+            rRate->setValue(r);
+            for (auto type: types) {
+                const std::vector<Real> npvs =
+                    engine->calculateChain(type, maturityDate, strikes);
+
+                for (Size i=0; i < strikes.size(); ++i) {
+                    VanillaOption option(
+                        ext::make_shared<PlainVanillaPayoff>(type, strikes[i]),
+                        ext::make_shared<AmericanExercise>(today, maturityDate));
+                    option.setPricingEngine(engine);
+                    const Real expected = option.NPV();
+
+                    const Real diff = std::abs(npvs[i] - expected);
+                    if (diff > tol*std::max(1.0, expected)
+                        || std::isnan(npvs[i])) {
+                        BOOST_ERROR("failed to reproduce single-option price "
+                                    "in chain"
+                                    << "\n    type     : " << type
+                                    << "\n    r        : " << r
+                                    << "\n    strike   : " << strikes[i]
+                                    << "\n    chain    : " << npvs[i]
+                                    << "\n    single   : " << expected
+                                    << "\n    diff     : " << diff
+                                    << "\n    tol      : " << tol);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void AmericanOptionTest::testChebyshevProxyEngine() {
+    BOOST_TEST_MESSAGE("Testing Chebyshev proxy of an American engine...");
+
+    SavedSettings backup;
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(1, June, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const auto payoff = ext::make_shared<PlainVanillaPayoff>(Option::Put, 100.0);
+    const auto exercise =
+        ext::make_shared<AmericanExercise>(today, today + Period(1, Years));
+
+    // each pricer owns its quotes, process, engine and option
+    const auto pricerFactory = [=]() -> ext::function<Real(const Array&)> {
+        const auto spot = ext::make_shared<SimpleQuote>(100.0);
+        const auto vol = ext::make_shared<SimpleQuote>(0.2);
+        const auto process = ext::make_shared<BlackScholesMertonProcess>(
+            Handle<Quote>(spot),
+            Handle<YieldTermStructure>(flatRate(today, 0.01, dc)),
+            Handle<YieldTermStructure>(flatRate(today, 0.04, dc)),
+            Handle<BlackVolTermStructure>(flatVol(today, vol, dc)));
+        const auto option = ext::make_shared<VanillaOption>(payoff, exercise);
+        option->setPricingEngine(
+            ext::make_shared<FdBlackScholesVanillaEngine>(process, 100, 200));
+
+        return [=](const Array& x) {
+            spot->setValue(x[0]);
+            vol->setValue(x[1]);
+            return option->NPV();
+        };
+    };
+
+    const std::vector<Real> lower = { 70.0, 0.1 }, upper = { 140.0, 0.5 };
+    const std::vector<Size> nodes = { 24, 10 };
+
+    const ext::shared_ptr<MultiChebyshevInterpolation> proxy =
+        makeChebyshevProxy(lower, upper, nodes, pricerFactory);
+    const ext::shared_ptr<MultiChebyshevInterpolation> parallelProxy =
+        makeChebyshevProxy(lower, upper, nodes, pricerFactory, true);
+
+    if (proxy->coefficients() != parallelProxy->coefficients())
+        BOOST_FAIL("parallel sampling changes the Chebyshev proxy");
+
+    const auto spot = ext::make_shared<SimpleQuote>(100.0);
+    const auto vol = ext::make_shared<SimpleQuote>(0.2);
+    VanillaOption option(payoff, exercise);
+    option.setPricingEngine(ext::make_shared<
+        ChebyshevProxyEngine<VanillaOption::arguments, VanillaOption::results> >(
+            proxy, std::vector<Handle<Quote> >{
+                Handle<Quote>(spot), Handle<Quote>(vol) }));
+
+    const ext::function<Real(const Array&)> pricer = pricerFactory();
+    for (Real s : { 75.0, 88.8, 100.0, 117.3, 135.0 }) {
+        for (Volatility v : { 0.12, 0.25, 0.43 }) {
+            spot->setValue(s);
+            vol->setValue(v);
+
+            Array x(2);
+            x[0] = s; x[1] = v;
+            const Real expected = pricer(x);
+            const Real calculated = option.NPV();
+
+            // delta from a central difference of the original engine
+            const Real h = 0.01*s;
+            x[0] = s + h;
+            const Real up = pricer(x);
+            x[0] = s - h;
+            const Real down = pricer(x);
+            const Real expectedDelta = (up - down)/(2*h);
+            const Real calculatedDelta = option.result<std::vector<Real> >(
+                "factorSensitivities")[0];
+
+            // the finite-difference mesh moves with the spot, which
+            // limits the smoothness of the sampled prices near the
+            // exercise boundary
+            const Real tol = 3e-2;
+            if (std::fabs(calculated - expected) > tol
+                || std::fabs(calculatedDelta - expectedDelta) > tol)
+                BOOST_FAIL("failed to reproduce American option with proxy"
+                           << "\n    spot:                " << s
+                           << "\n    volatility:          " << v
+                           << "\n    calculated NPV:      " << calculated
+                           << "\n    expected NPV:        " << expected
+                           << "\n    calculated delta:    " << calculatedDelta
+                           << "\n    expected delta:      " << expectedDelta);
+        }
+    }
+}
+
 test_suite* AmericanOptionTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("American option tests");
 
@@ -1883,6 +2045,8 @@ test_suite* AmericanOptionTest::suite(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&AmericanOptionTest::testBulkQdFpAmericanEngine));
     suite->add(QUANTLIB_TEST_CASE(&AmericanOptionTest::testQdEngineWithLobattoIntegral));
     suite->add(QUANTLIB_TEST_CASE(&AmericanOptionTest::testQdNegativeDividendYield));
+    suite->add(QUANTLIB_TEST_CASE(&AmericanOptionTest::testQdFpChainPricing));
+    suite->add(QUANTLIB_TEST_CASE(&AmericanOptionTest::testChebyshevProxyEngine));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&AmericanOptionTest::testFdShoutGreeks));
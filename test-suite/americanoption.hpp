@@ -51,6 +51,8 @@ class AmericanOptionTest {
     static void testBulkQdFpAmericanEngine();
     static void testQdEngineWithLobattoIntegral();
     static void testQdNegativeDividendYield();
+    static void testQdFpChainPricing();
+    static void testChebyshevProxyEngine();
 
 
     static boost::unit_test_framework::test_suite* suite(SpeedLevel);
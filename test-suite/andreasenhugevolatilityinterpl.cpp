@@ -27,6 +27,7 @@
 #include <ql/quotes/simplequote.hpp>
 #include <ql/instruments/vanillaoption.hpp>
 #include <ql/instruments/barrieroption.hpp>
+#include <ql/time/daycounters/actual360.hpp>
 #include <ql/time/daycounters/actual365fixed.hpp>
 #include <ql/models/equity/hestonmodel.hpp>
 #include <ql/pricingengines/blackformula.hpp>
@@ -39,7 +40,10 @@
 #include <ql/termstructures/volatility/equityfx/andreasenhugelocalvoladapter.hpp>
 #include <ql/termstructures/volatility/equityfx/andreasenhugevolatilityinterpl.hpp>
 #include <ql/termstructures/volatility/equityfx/andreasenhugevolatilityadapter.hpp>
+#include <ql/termstructures/volatility/equityfx/impliedvolatilitysurfacebuilder.hpp>
 #include <cmath>
+#include <iomanip>
+#include <sstream>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -1053,6 +1057,246 @@ void AndreasenHugeVolatilityInterplTest::testFlatVolCalibration() {
 }
 
 
+void AndreasenHugeVolatilityInterplTest::testCalibrationReuse() {
+    BOOST_TEST_MESSAGE(
+        "Testing parallel, warm-started and restored Andreasen-Huge "
+        "calibrations...");
+
+    using namespace andreasen_huge_volatility_interpl_test;
+
+    SavedSettings backup;
+
+    const CalibrationData data = BorovkovaExampleData();
+    const Date today = data.rTS->referenceDate();
+    Settings::instance().evaluationDate() = today;
+
+    const auto makeInterpolation = [&](
+        const AndreasenHugeVolatilityInterpl::CalibrationSet& calibrationSet) {
+        return ext::make_shared<AndreasenHugeVolatilityInterpl>(
+            calibrationSet, data.spot, data.rTS, data.qTS,
+            AndreasenHugeVolatilityInterpl::CubicSpline,
+            AndreasenHugeVolatilityInterpl::CallPut, 400);
+    };
+
+    const Time times[] = { 0.1, 0.4, 0.9, 1.7 };
+    const Real strikes[] = { 60.0, 85.0, 100.0, 120.0, 180.0 };
+
+    const auto compare = [&](
+        const ext::shared_ptr<AndreasenHugeVolatilityInterpl>& calculated,
+        const ext::shared_ptr<AndreasenHugeVolatilityInterpl>& expected,
+        Real tol, const std::string& what) {
+        for (Time t : times)
+            for (Real strike : strikes) {
+                const Volatility v1 = calculated->localVol(t, strike);
+                const Volatility v2 = expected->localVol(t, strike);
+                if (std::fabs(v1 - v2) > tol)
+                    BOOST_ERROR("failed to reproduce local volatility of "
+                                << what
+                                << "\n    time:       " << t
+                                << "\n    strike:     " << strike
+                                << std::setprecision(12)
+                                << "\n    calculated: " << v1
+                                << "\n    expected:   " << v2
+                                << "\n    tolerance:  " << tol);
+            }
+    };
+
+    const ext::shared_ptr<AndreasenHugeVolatilityInterpl> reference
+        = makeInterpolation(data.calibrationSet);
+
+    const ext::shared_ptr<AndreasenHugeVolatilityInterpl> parallel
+        = makeInterpolation(data.calibrationSet);
+    parallel->enableParallelCalibration();
+    compare(parallel, reference, 1e-12, "parallel calibration");
+
+    std::stringstream stream;
+    reference->save(stream);
+
+    const ext::shared_ptr<AndreasenHugeVolatilityInterpl> restored
+        = makeInterpolation(data.calibrationSet);
+    restored->load(stream);
+    compare(restored, reference, 1e-12, "restored calibration");
+
+    if (std::fabs(ext::get<1>(restored->calibrationError())
+                  - ext::get<1>(reference->calibrationError())) > 1e-12)
+        BOOST_ERROR("failed to reproduce calibration error "
+                    "of restored calibration");
+
+    // a restored calibration must match the calibration set
+    const AndreasenHugeVolatilityInterpl::CalibrationSet partialSet(
+        data.calibrationSet.begin(), data.calibrationSet.end()-1);
+    std::stringstream partialStream(stream.str());
+    BOOST_CHECK_THROW(
+        makeInterpolation(partialSet)->load(partialStream), Error);
+
+    // warm start after a quote change
+    const ext::shared_ptr<AndreasenHugeVolatilityInterpl> warmStarted
+        = makeInterpolation(data.calibrationSet);
+    warmStarted->enableWarmStart();
+    warmStarted->localVol(1.0, 100.0);
+
+    const ext::shared_ptr<SimpleQuote> quote =
+        ext::dynamic_pointer_cast<SimpleQuote>(data.calibrationSet[5].second);
+    quote->setValue(quote->value() + 0.01);
+
+    const ext::shared_ptr<AndreasenHugeVolatilityInterpl> recalibrated
+        = makeInterpolation(data.calibrationSet);
+
+    const Real maxError = ext::get<1>(warmStarted->calibrationError());
+    const Real expectedMaxError = ext::get<1>(recalibrated->calibrationError());
+    if (maxError > std::max(1e-5, 2*expectedMaxError))
+        BOOST_ERROR("failed to recalibrate with warm start"
+                    << "\n    max error:          " << maxError
+                    << "\n    cold start error:   " << expectedMaxError);
+
+    compare(warmStarted, recalibrated, 1e-4, "warm-started calibration");
+}
+
+void AndreasenHugeVolatilityInterplTest::testImpliedVolatilitySurfaceBuilder() {
+    BOOST_TEST_MESSAGE(
+        "Testing Andreasen-Huge calibration to raw option quotes...");
+
+    SavedSettings backup;
+
+    const DayCounter dc = Actual365Fixed();
+    const Date today = Date(4, January, 2018);
+    Settings::instance().evaluationDate() = today;
+
+    const Real s0 = 100.0;
+    const Handle<Quote> spot(ext::make_shared<SimpleQuote>(s0));
+    const Handle<YieldTermStructure> rTS(flatRate(today, 0.03, dc));
+    const Handle<YieldTermStructure> qTS(flatRate(today, 0.01, dc));
+
+    const Period maturities[] = { Period(3, Months), Period(6, Months),
+                                  Period(1, Years) };
+    const Real strikes[] = { 80.0, 90.0, 100.0, 110.0, 120.0 };
+    const Option::Type types[] = { Option::Call, Option::Put };
+
+    const auto smile = [](Real strike, Real fwd) {
+        const Real m = std::log(strike/fwd);
+        return 0.2 - 0.1*m + 0.5*m*m;
+    };
+
+    // both calls and puts are quoted, the in-the-money ones off the smile
+    std::vector<Date> expiries;
+    std::vector<Real> quoteStrikes, prices, forwards, discounts, expected;
+    std::vector<Option::Type> quoteTypes;
+    for (const auto& maturity : maturities) {
+        const Date expiry = today + maturity;
+        const DiscountFactor df = rTS->discount(expiry);
+        const Real fwd = s0*qTS->discount(expiry)/df;
+        const Time t = dc.yearFraction(today, expiry);
+
+        for (Real strike : strikes) {
+            for (auto type : types) {
+                const bool otm = (type == Option::Call) == (strike >= fwd);
+                const Volatility vol = smile(strike, fwd) + (otm ? 0.0 : 0.05);
+
+                expiries.push_back(expiry);
+                quoteStrikes.push_back(strike);
+                quoteTypes.push_back(type);
+                forwards.push_back(fwd);
+                discounts.push_back(df);
+                prices.push_back(blackFormula(
+                    type, strike, fwd, vol*std::sqrt(t), df));
+                expected.push_back(vol);
+            }
+        }
+    }
+
+    // prices above the upper bound can't be inverted
+    const Size invalidItm = 0, invalidOtm = 16;
+    const Real validOtmPrice = prices[invalidOtm];
+    prices[invalidItm] = prices[invalidOtm] = s0;
+
+    ImpliedVolatilitySurfaceBuilder builder(
+        today, dc, expiries, quoteStrikes, quoteTypes);
+    builder.setPrices(prices, forwards, discounts);
+
+    std::vector<Volatility> vols = builder.impliedVolatilities();
+    builder.enableParallelInversion();
+    builder.setPrices(prices, forwards, discounts);
+
+    for (Size i=0; i < vols.size(); ++i) {
+        if (i == invalidItm || i == invalidOtm) {
+            if (vols[i] != Null<Real>())
+                BOOST_ERROR("implied volatility returned for invalid price"
+                            << "\n    quote: " << i
+                            << "\n    vol:   " << vols[i]);
+        }
+        else if (std::fabs(vols[i] - expected[i]) > 1e-12)
+            BOOST_ERROR("failed to reproduce implied volatility"
+                        << "\n    quote:      " << i
+                        << std::setprecision(12)
+                        << "\n    calculated: " << vols[i]
+                        << "\n    expected:   " << expected[i]);
+
+        if (vols[i] != builder.impliedVolatilities()[i])
+            BOOST_ERROR("parallel inversion differs from serial one"
+                        << "\n    quote: " << i);
+    }
+
+    // out-of-the-money quotes are preferred, invalid ones skipped
+    const ext::shared_ptr<BlackVarianceSurface> surface =
+        builder.blackVarianceSurface();
+    for (Size i=0; i < vols.size(); ++i) {
+        const Size pair = i - i%2;
+        const Size otm =
+            (quoteTypes[pair] == Option::Call)
+                == (quoteStrikes[pair] >= forwards[pair]) ? pair : pair+1;
+        const Size used = (otm == invalidOtm) ? (2*pair+1) - otm : otm;
+
+        const Volatility vol = surface->blackVol(expiries[i], quoteStrikes[i]);
+        if (std::fabs(vol - expected[used]) > 1e-12)
+            BOOST_ERROR("failed to reproduce surface volatility"
+                        << "\n    expiry:     " << expiries[i]
+                        << "\n    strike:     " << quoteStrikes[i]
+                        << std::setprecision(12)
+                        << "\n    calculated: " << vol
+                        << "\n    expected:   " << expected[used]);
+    }
+
+    // the market moves back to a smooth smile
+    prices[invalidOtm] = validOtmPrice;
+    builder.setPrices(prices, forwards, discounts);
+
+    const AndreasenHugeVolatilityInterpl::CalibrationSet calibrationSet =
+        builder.calibrationSet();
+    if (calibrationSet.size() != vols.size()/2)
+        BOOST_ERROR("unexpected size of calibration set"
+                    << "\n    calculated: " << calibrationSet.size()
+                    << "\n    expected:   " << vols.size()/2);
+
+    // quotes inverted with another day counter are rescaled
+    ImpliedVolatilitySurfaceBuilder act360Builder(
+        today, Actual360(), expiries, quoteStrikes, quoteTypes);
+    act360Builder.setPrices(prices, forwards, discounts);
+    const AndreasenHugeVolatilityInterpl::CalibrationSet rescaledSet =
+        act360Builder.calibrationSet(dc);
+    for (Size i=0; i < calibrationSet.size(); ++i) {
+        const Volatility vol = calibrationSet[i].second->value();
+        const Volatility rescaled = rescaledSet[i].second->value();
+        if (std::fabs(rescaled - vol) > 1e-12)
+            BOOST_ERROR("failed to rescale volatility to target day counter"
+                        << "\n    quote:      " << i
+                        << std::setprecision(12)
+                        << "\n    calculated: " << rescaled
+                        << "\n    expected:   " << vol);
+    }
+
+    const AndreasenHugeVolatilityInterpl andreasenHuge(
+        calibrationSet, spot, rTS, qTS,
+        AndreasenHugeVolatilityInterpl::CubicSpline,
+        AndreasenHugeVolatilityInterpl::CallPut, 400);
+
+    const Real maxError = ext::get<1>(andreasenHuge.calibrationError());
+    const Real tol = 1e-4;
+    if (maxError > tol)
+        BOOST_ERROR("failed to calibrate to raw option quotes"
+                    << "\n    max error: " << maxError
+                    << "\n    tolerance: " << tol);
+}
+
 test_suite* AndreasenHugeVolatilityInterplTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Andreasen-Huge volatility interpolation tests");
 
@@ -1068,6 +1312,10 @@ test_suite* AndreasenHugeVolatilityInterplTest::suite(SpeedLevel speed) {
         &AndreasenHugeVolatilityInterplTest::testMovingReferenceDate));
     suite->add(QUANTLIB_TEST_CASE(
         &AndreasenHugeVolatilityInterplTest::testFlatVolCalibration));
+    suite->add(QUANTLIB_TEST_CASE(
+        &AndreasenHugeVolatilityInterplTest::testCalibrationReuse));
+    suite->add(QUANTLIB_TEST_CASE(
+        &AndreasenHugeVolatilityInterplTest::testImpliedVolatilitySurfaceBuilder));
 
     if (speed == Slow) {
         suite->add(QUANTLIB_TEST_CASE(
@@ -41,6 +41,8 @@ class AndreasenHugeVolatilityInterplTest {
     static void testDifferentOptimizers();
     static void testMovingReferenceDate();
     static void testFlatVolCalibration();
+    static void testCalibrationReuse();
+    static void testImpliedVolatilitySurfaceBuilder();
 
     static boost::unit_test_framework::test_suite* suite(SpeedLevel speed);
 };
@@ -25,6 +25,7 @@
 #include "utilities.hpp"
 #include <ql/pricingengines/blackformula.hpp>
 #include <cmath>
+#include <iomanip>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -434,6 +435,201 @@ void BlackFormulaTest::testBachelierBlackFormulaForwardDerivativeWithZeroVolatil
     assertBachelierBlackFormulaForwardDerivative(Option::Put, strikes, vol);
 }
 
+void BlackFormulaTest::testJaeckelImpliedStdDev() {
+    BOOST_TEST_MESSAGE("Testing implied volatility calculation via "
+                       "Jaeckel's rational iterations...");
+
+    const Real forward = 100.0;
+    const DiscountFactor discount = 0.95;
+
+    const Option::Type types[] = { Option::Call, Option::Put };
+    const Real strikes[] = { 25, 50, 70, 90, 99, 100, 101, 110, 130, 175, 250, 400 };
+    const Real stdDevs[] = { 0.01, 0.05, 0.1, 0.25, 0.5, 1.0, 2.0, 4.0 };
+    const Real displacements[] = { 0, 25 };
+
+    const Real tol = 1e-10;
+
+    for (auto type : types) {
+        for (Real strike : strikes) {
+            for (Real stdDev : stdDevs) {
+                for (Real displacement : displacements) {
+                    const Real price = blackFormula(
+                        type, strike, forward, stdDev, discount, displacement);
+                    const Real intrinsic =
+                        std::max(0.0, (forward - strike)*Integer(type))*discount;
+
+                    // the time value is lost in rounding errors
+                    if (price - intrinsic < 1e-4)
+                        continue;
+
+                    const Real impliedStdDev = blackFormulaImpliedStdDevJaeckel(
+                        type, strike, forward, price, discount, displacement);
+
+                    const Real error = std::fabs(impliedStdDev - stdDev)/stdDev;
+                    if (error > tol) {
+                        BOOST_ERROR("Failed to calculate implied volatility"
+                                    " with Jaeckel's rational iterations"
+                                    << std::setprecision(16)
+                                    << "\n type        :" << type
+                                    << "\n forward     :" << forward
+                                    << "\n strike      :" << strike
+                                    << "\n stdDev      :" << stdDev
+                                    << "\n displacement:" << displacement
+                                    << "\n result      :" << impliedStdDev
+                                    << "\n rel. error  :" << error
+                                    << "\n tolerance   :" << tol);
+                    }
+                }
+            }
+        }
+    }
+
+    // zero time value and prices outside the arbitrage bounds
+    if (blackFormulaImpliedStdDevJaeckel(
+            Option::Put, 80.0, forward, 0.0, discount) != 0.0)
+        BOOST_ERROR("non-zero implied stdDev for zero option price");
+    BOOST_CHECK_THROW(blackFormulaImpliedStdDevJaeckel(
+        Option::Call, 80.0, forward, 15.0, discount), Error);
+    BOOST_CHECK_THROW(blackFormulaImpliedStdDevJaeckel(
+        Option::Call, 80.0, forward, forward*discount, discount), Error);
+
+    // far wings, where the prices themselves lose relative accuracy
+    const Real wingStrikes[] = { 1e-4, 0.01, 1.0, 1e4, 1e6 };
+    const Real wingStdDevs[] = { 0.05, 0.5, 3.0, 10.0, 25.0 };
+    const Real wingTol = 1e-8;
+
+    for (auto type : types) {
+        for (Real strike : wingStrikes) {
+            for (Real stdDev : wingStdDevs) {
+                const Real price = blackFormula(
+                    type, strike, forward, stdDev, discount);
+                const Real intrinsic =
+                    std::max(0.0, (forward - strike)*Integer(type))*discount;
+                const Real upperBound =
+                    ((type == Option::Call) ? forward : strike)*discount;
+
+                // the time value is lost in rounding errors or underflows
+                if (price - intrinsic < 1e-6*price
+                    || price < 1e-250*upperBound
+                    || upperBound - price < 1e-12*upperBound)
+                    continue;
+
+                const Real impliedStdDev = blackFormulaImpliedStdDevJaeckel(
+                    type, strike, forward, price, discount);
+                const Real error = std::fabs(impliedStdDev - stdDev)/stdDev;
+                if (error > wingTol) {
+                    BOOST_ERROR("Failed to calculate far-wing implied volatility"
+                                " with Jaeckel's rational iterations"
+                                << std::setprecision(16)
+                                << "\n type        :" << type
+                                << "\n forward     :" << forward
+                                << "\n strike      :" << strike
+                                << "\n stdDev      :" << stdDev
+                                << "\n result      :" << impliedStdDev
+                                << "\n rel. error  :" << error
+                                << "\n tolerance   :" << wingTol);
+                }
+            }
+        }
+    }
+}
+
+void BlackFormulaTest::testBatchFormulas() {
+    BOOST_TEST_MESSAGE("Testing batch Black and Bachelier formulas...");
+
+    const Real forward = 100.0, displacement = 10.0, tte = 2.0;
+    const DiscountFactor discount = 0.9;
+
+    const Size n = 200;
+    std::vector<Option::Type> types(n);
+    Array strikes(n), stdDevs(n), normalStdDevs(n);
+    for (Size i=0; i < n; ++i) {
+        types[i] = (i % 3 == 0) ? Option::Put : Option::Call;
+        strikes[i] = 40.0 + 0.75*i;
+        stdDevs[i] = 0.05 + 0.4*(i % 11)/10.0;
+        normalStdDevs[i] = 100.0*stdDevs[i];
+    }
+    stdDevs[7] = normalStdDevs[7] = 0.0;
+
+    const Array prices = blackFormula(
+        types, strikes, forward, stdDevs, discount, displacement);
+    const Array deltas = blackFormulaForwardDerivative(
+        types, strikes, forward, stdDevs, discount, displacement);
+    const Array vegas = blackFormulaStdDevDerivative(
+        strikes, forward, stdDevs, discount, displacement);
+    const Array impliedStdDevs = blackFormulaImpliedStdDevJaeckel(
+        types, strikes, forward, prices, discount, displacement);
+
+    const Array normalPrices = bachelierBlackFormula(
+        types, strikes, forward, normalStdDevs, discount);
+    const Array normalDeltas = bachelierBlackFormulaForwardDerivative(
+        types, strikes, forward, normalStdDevs, discount);
+    const Array normalVegas = bachelierBlackFormulaStdDevDerivative(
+        strikes, forward, normalStdDevs, discount);
+    const Array normalVols = bachelierBlackFormulaImpliedVol(
+        types, strikes, forward, tte, normalPrices, discount);
+
+    const Real tol = 1e-14;
+    for (Size i=0; i < n; ++i) {
+        const Real expected[] = {
+            blackFormula(types[i], strikes[i], forward, stdDevs[i],
+                         discount, displacement),
+            blackFormulaForwardDerivative(types[i], strikes[i], forward,
+                                          stdDevs[i], discount, displacement),
+            blackFormulaStdDevDerivative(strikes[i], forward, stdDevs[i],
+                                         discount, displacement),
+            blackFormulaImpliedStdDevJaeckel(types[i], strikes[i], forward,
+                                             prices[i], discount, displacement),
+            bachelierBlackFormula(types[i], strikes[i], forward,
+                                  normalStdDevs[i], discount),
+            bachelierBlackFormulaForwardDerivative(types[i], strikes[i], forward,
+                                                   normalStdDevs[i], discount),
+            bachelierBlackFormulaStdDevDerivative(strikes[i], forward,
+                                                  normalStdDevs[i], discount)
+        };
+        const Real calculated[] = {
+            prices[i], deltas[i], vegas[i], impliedStdDevs[i],
+            normalPrices[i], normalDeltas[i], normalVegas[i]
+        };
+        const std::string names[] = {
+            "Black price", "Black delta", "Black vega", "Black implied stdDev",
+            "Bachelier price", "Bachelier delta", "Bachelier vega"
+        };
+
+        for (Size j=0; j < LENGTH(expected); ++j) {
+            if (std::fabs(calculated[j] - expected[j])
+                    > tol*std::max(1.0, std::fabs(expected[j])))
+                BOOST_ERROR("batch " << names[j] << " differs from scalar one"
+                            << std::setprecision(16)
+                            << "\n type       :" << types[i]
+                            << "\n strike     :" << strikes[i]
+                            << "\n calculated :" << calculated[j]
+                            << "\n expected   :" << expected[j]);
+        }
+
+        // compare the implied volatilities where the time value is
+        // large enough to determine them
+        const Real intrinsic =
+            std::max(0.0, (forward - strikes[i])*Integer(types[i]))*discount;
+        if (stdDevs[i] > 0.0 && prices[i] - intrinsic > 1e-4
+            && std::fabs(impliedStdDevs[i] - stdDevs[i]) > 1e-10*stdDevs[i])
+            BOOST_ERROR("failed to reproduce Black stdDev"
+                        << std::setprecision(16)
+                        << "\n strike     :" << strikes[i]
+                        << "\n calculated :" << impliedStdDevs[i]
+                        << "\n expected   :" << stdDevs[i]);
+
+        const Real normalVol = normalStdDevs[i]/std::sqrt(tte);
+        if (normalStdDevs[i] > 0.0 && normalPrices[i] - intrinsic > 1e-4
+            && std::fabs(normalVols[i] - normalVol) > 1e-10*normalVol)
+            BOOST_ERROR("failed to reproduce Bachelier volatility"
+                        << std::setprecision(16)
+                        << "\n strike     :" << strikes[i]
+                        << "\n calculated :" << normalVols[i]
+                        << "\n expected   :" << normalVol);
+    }
+}
+
 test_suite* BlackFormulaTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Black formula tests");
 
@@ -457,6 +653,10 @@ test_suite* BlackFormulaTest::suite() {
         &BlackFormulaTest::testBachelierBlackFormulaForwardDerivative));
     suite->add(QUANTLIB_TEST_CASE(
         &BlackFormulaTest::testBachelierBlackFormulaForwardDerivativeWithZeroVolatility));
+    suite->add(QUANTLIB_TEST_CASE(
+        &BlackFormulaTest::testJaeckelImpliedStdDev));
+    suite->add(QUANTLIB_TEST_CASE(
+        &BlackFormulaTest::testBatchFormulas));
 
     return suite;
 }
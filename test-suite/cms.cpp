@@ -30,6 +30,7 @@
 #include <ql/cashflows/conundrumpricer.hpp>
 #include <ql/cashflows/cashflowvectors.hpp>
 #include <ql/cashflows/lineartsrpricer.hpp>
+#include <ql/cashflows/couponpricer.hpp>
 #include <ql/quotes/simplequote.hpp>
 #include <ql/termstructures/volatility/swaption/swaptionvolmatrix.hpp>
 #include <ql/termstructures/volatility/swaption/swaptionvolcube2.hpp>
@@ -39,6 +40,7 @@
 #include <ql/time/schedule.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/instruments/makecms.hpp>
+#include <iomanip>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -469,10 +471,190 @@ void CmsTest::testParity() {
     }
 }
 
+void CmsTest::testLinearTsrBatchPricing() {
+
+    BOOST_TEST_MESSAGE("Testing batch pricing with the linear TSR pricer...");
+
+    using namespace cms_test;
+
+    CommonVars vars;
+
+    ext::shared_ptr<SwapIndex> swapIndex(new
+        EuriborSwapIsdaFixA(10*Years,
+                            vars.iborIndex->forwardingTermStructure()));
+    Date startDate = vars.termStructure->referenceDate() + 1*Years;
+    Schedule schedule = MakeSchedule().from(startDate)
+                                      .to(startDate + 10*Years)
+                                      .withFrequency(Semiannual)
+                                      .withCalendar(TARGET());
+
+    // the legs share their fixings, so that the pricer reuses the
+    // underlying swaps, smile sections and replication integrals
+    Leg plain = CmsLeg(schedule, swapIndex).withNotionals(1.0);
+    Leg geared = CmsLeg(schedule, swapIndex)
+        .withNotionals(1.0).withGearings(2.0).withSpreads(0.001);
+    Leg capped = CmsLeg(schedule, swapIndex).withNotionals(1.0).withCaps(0.06);
+    Leg floored = CmsLeg(schedule, swapIndex).withNotionals(1.0).withFloors(0.03);
+    Leg collared = CmsLeg(schedule, swapIndex)
+        .withNotionals(1.0).withCaps(0.06).withFloors(0.03);
+
+    Leg leg;
+    for (const auto& l : {plain, geared, capped, floored, collared})
+        leg.insert(leg.end(), l.begin(), l.end());
+
+    auto meanReversionQuote = ext::make_shared<SimpleQuote>(0.01);
+    Handle<Quote> meanReversion(meanReversionQuote);
+
+    // reference: a separate pricer for each coupon
+    std::vector<Real> expected(leg.size());
+    for (Size i=0; i<leg.size(); ++i) {
+        auto pricer = ext::make_shared<LinearTsrPricer>(vars.SabrVolCube1,
+                                                        meanReversion);
+        auto coupon = ext::dynamic_pointer_cast<FloatingRateCoupon>(leg[i]);
+        coupon->setPricer(pricer);
+        expected[i] = coupon->amount();
+    }
+
+    auto pricer = ext::make_shared<LinearTsrPricer>(vars.SabrVolCube1,
+                                                    meanReversion);
+    pricer->enableParallelIntegration();
+    setCouponPricer(leg, pricer);
+    pricer->precompute(leg);
+
+    for (Size i=0; i<leg.size(); ++i) {
+        Real calculated = leg[i]->amount();
+        if (std::fabs(calculated - expected[i]) > 1.0e-12)
+            BOOST_ERROR("failed to reproduce coupon amount with batch pricing"
+                        << "\n    coupon:     " << i
+                        << "\n    date:       " << leg[i]->date()
+                        << std::setprecision(12)
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << expected[i]);
+    }
+
+    // the shared data are dropped when the volatility changes
+    pricer->setSwaptionVolatility(vars.SabrVolCube2);
+    for (Size i=0; i<leg.size(); ++i) {
+        auto reference = ext::make_shared<LinearTsrPricer>(vars.SabrVolCube2,
+                                                           meanReversion);
+        auto coupon = ext::dynamic_pointer_cast<FloatingRateCoupon>(leg[i]);
+        Real calculated = coupon->amount();
+        coupon->setPricer(reference);
+        Real expectedAmount = coupon->amount();
+        coupon->setPricer(pricer);
+        if (std::fabs(calculated - expectedAmount) > 1.0e-12)
+            BOOST_ERROR("failed to update coupon amount after volatility change"
+                        << "\n    coupon:     " << i
+                        << "\n    date:       " << leg[i]->date()
+                        << std::setprecision(12)
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << expectedAmount);
+    }
+
+    // ...and when the mean reversion changes
+    meanReversionQuote->setValue(0.03);
+    for (Size i=0; i<leg.size(); ++i) {
+        auto reference = ext::make_shared<LinearTsrPricer>(vars.SabrVolCube2,
+                                                           meanReversion);
+        auto coupon = ext::dynamic_pointer_cast<FloatingRateCoupon>(leg[i]);
+        Real calculated = coupon->amount();
+        coupon->setPricer(reference);
+        Real expectedAmount = coupon->amount();
+        coupon->setPricer(pricer);
+        if (std::fabs(calculated - expectedAmount) > 1.0e-12)
+            BOOST_ERROR("failed to update coupon amount after mean reversion change"
+                        << "\n    coupon:     " << i
+                        << "\n    date:       " << leg[i]->date()
+                        << std::setprecision(12)
+                        << "\n    calculated: " << calculated
+                        << "\n    expected:   " << expectedAmount);
+    }
+}
+
+void CmsTest::testNumericHaganSharedData() {
+
+    BOOST_TEST_MESSAGE("Testing shared data in the numeric Hagan pricer...");
+
+    using namespace cms_test;
+
+    CommonVars vars;
+
+    ext::shared_ptr<SwapIndex> swapIndex(new
+        EuriborSwapIsdaFixA(10*Years,
+                            vars.iborIndex->forwardingTermStructure()));
+    Date startDate = vars.termStructure->referenceDate() + 1*Years;
+    Schedule schedule = MakeSchedule().from(startDate)
+                                      .to(startDate + 5*Years)
+                                      .withFrequency(Semiannual)
+                                      .withCalendar(TARGET());
+
+    // the legs share their fixings and payment dates, so that the
+    // pricer reuses the G-functions and replication integrals
+    Leg plain = CmsLeg(schedule, swapIndex).withNotionals(1.0);
+    Leg geared = CmsLeg(schedule, swapIndex)
+        .withNotionals(1.0).withGearings(2.0).withSpreads(0.001);
+    Leg capped = CmsLeg(schedule, swapIndex).withNotionals(1.0).withCaps(0.06);
+    Leg floored = CmsLeg(schedule, swapIndex).withNotionals(1.0).withFloors(0.03);
+    Leg collared = CmsLeg(schedule, swapIndex)
+        .withNotionals(1.0).withCaps(0.06).withFloors(0.03);
+
+    Leg leg;
+    for (const auto& l : {plain, geared, capped, floored, collared})
+        leg.insert(leg.end(), l.begin(), l.end());
+
+    Handle<Quote> meanReversion(ext::make_shared<SimpleQuote>(0.01));
+
+    for (auto model : {GFunctionFactory::Standard,
+                       GFunctionFactory::ExactYield,
+                       GFunctionFactory::ParallelShifts,
+                       GFunctionFactory::NonParallelShifts}) {
+
+        auto pricer = ext::make_shared<NumericHaganPricer>(
+            vars.atmVol, model, meanReversion);
+
+        // reference: a separate pricer for each coupon
+        const auto check = [&](const std::string& context) {
+            for (Size i=0; i<leg.size(); ++i) {
+                auto coupon = ext::dynamic_pointer_cast<FloatingRateCoupon>(leg[i]);
+                coupon->setPricer(ext::make_shared<NumericHaganPricer>(
+                    vars.atmVol, model, meanReversion));
+                Real expected = coupon->amount();
+                coupon->setPricer(pricer);
+                Real calculated = coupon->amount();
+                if (std::fabs(calculated - expected) > 1.0e-12)
+                    BOOST_ERROR("failed to reproduce coupon amount " << context
+                                << "\n    model:      " << model
+                                << "\n    coupon:     " << i
+                                << "\n    date:       " << leg[i]->date()
+                                << std::setprecision(12)
+                                << "\n    calculated: " << calculated
+                                << "\n    expected:   " << expected);
+            }
+        };
+
+        setCouponPricer(leg, pricer);
+        for (const auto& cf : leg)
+            cf->amount();
+        check("with shared data");
+
+        // the shared data are dropped when the curve changes
+        RelinkableHandle<YieldTermStructure> termStructure = vars.termStructure;
+        ext::shared_ptr<YieldTermStructure> curve = termStructure.currentLink();
+        termStructure.linkTo(flatRate(curve->referenceDate(), 0.04,
+                                      Actual365Fixed()));
+        for (const auto& cf : leg)
+            cf->amount();
+        check("after curve change");
+        termStructure.linkTo(curve);
+    }
+}
+
 test_suite* CmsTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Cms tests");
     suite->add(QUANTLIB_TEST_CASE(&CmsTest::testFairRate));
     suite->add(QUANTLIB_TEST_CASE(&CmsTest::testCmsSwap));
     suite->add(QUANTLIB_TEST_CASE(&CmsTest::testParity));
+    suite->add(QUANTLIB_TEST_CASE(&CmsTest::testLinearTsrBatchPricing));
+    suite->add(QUANTLIB_TEST_CASE(&CmsTest::testNumericHaganSharedData));
     return suite;
 }
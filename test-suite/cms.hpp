@@ -30,6 +30,8 @@ class CmsTest {
     static void testFairRate();
     static void testParity();
     static void testCmsSwap();
+    static void testLinearTsrBatchPricing();
+    static void testNumericHaganSharedData();
     static boost::unit_test_framework::test_suite* suite();
 };
 
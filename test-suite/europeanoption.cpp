@@ -38,7 +38,11 @@
 #include <ql/termstructures/yield/forwardcurve.hpp>
 #include <ql/termstructures/volatility/equityfx/blackconstantvol.hpp>
 #include <ql/termstructures/volatility/equityfx/blackvariancesurface.hpp>
+#include <ql/termstructures/volatility/equityfx/compactblackvariancesurface.hpp>
+#include <ql/termstructures/volatility/equityfx/interpolatedlocalvolsurface.hpp>
+#include <ql/termstructures/volatility/equityfx/localvolsurface.hpp>
 #include <ql/utilities/dataformatters.hpp>
+#include <iomanip>
 #include <map>
 
 using namespace QuantLib;
@@ -1413,6 +1417,237 @@ void EuropeanOptionTest::testLocalVolatility() {
     }
 }
 
+void EuropeanOptionTest::testInterpolatedLocalVolatility() {
+    BOOST_TEST_MESSAGE("Testing pre-sampled local volatility surface...");
+
+    using namespace european_option_test;
+
+    SavedSettings backup;
+
+    const Date today(5, July, 2002);
+    Settings::instance().evaluationDate() = today;
+
+    const DayCounter dc = Actual365Fixed();
+    const ext::shared_ptr<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+    const ext::shared_ptr<YieldTermStructure> rTS = flatRate(today, 0.04, dc);
+    const ext::shared_ptr<YieldTermStructure> qTS = flatRate(today, 0.01, dc);
+
+    const std::vector<Date> dates = {
+        today + Period(3, Months), today + Period(6, Months),
+        today + Period(1, Years), today + Period(2, Years),
+        today + Period(3, Years) };
+    const std::vector<Real> strikes = {
+        40, 60, 70, 80, 90, 100, 110, 120, 130, 150, 200 };
+
+    // simple smile flattening with maturity
+    Matrix blackVols(strikes.size(), dates.size());
+    for (Size i=0; i < strikes.size(); ++i)
+        for (Size j=0; j < dates.size(); ++j) {
+            const Real m = std::log(strikes[i]/s0->value());
+            const Time t = dc.yearFraction(today, dates[j]);
+            blackVols[i][j] = 0.2 + (0.05*m*m - 0.04*m)/std::sqrt(1.0 + t);
+        }
+
+    const ext::shared_ptr<BlackVarianceSurface> volTS =
+        ext::make_shared<BlackVarianceSurface>(
+            today, TARGET(), dates, strikes, blackVols, dc);
+    volTS->setInterpolation<Bicubic>();
+
+    const ext::shared_ptr<LocalVolTermStructure> localVol =
+        ext::make_shared<LocalVolSurface>(
+            Handle<BlackVolTermStructure>(volTS),
+            Handle<YieldTermStructure>(rTS), Handle<YieldTermStructure>(qTS),
+            Handle<Quote>(s0));
+
+    const ext::shared_ptr<InterpolatedLocalVolSurface> gridLocalVol =
+        ext::make_shared<InterpolatedLocalVolSurface>(
+            Handle<LocalVolTermStructure>(localVol), 3.0, 120, 30.0, 300.0, 200);
+
+    // the grid look-up must stay close to the Dupire local volatility
+    for (Time t = 0.05; t < 3.0; t += 0.17) {
+        for (Real strike = 60.0; strike < 160.0; strike += 3.7) {
+            const Volatility expected = localVol->localVol(t, strike, true);
+            const Volatility calculated = gridLocalVol->localVol(t, strike, true);
+
+            const Real tol = 1e-3;
+            if (std::fabs(expected - calculated) > tol)
+                BOOST_FAIL("Failed to reproduce local volatility"
+                           << "\n    time:       " << t
+                           << "\n    strike:     " << strike
+                           << "\n    calculated: " << calculated
+                           << "\n    expected:   " << expected);
+        }
+    }
+
+    // the batch look-up reproduces the single look-ups
+    Array logStrikes(301);
+    for (Size i=0; i < logStrikes.size(); ++i)
+        logStrikes[i] = std::log(20.0) + 3.0*i/(logStrikes.size()-1);
+
+    for (Time t : { 0.0, 0.2, 1.0, 2.999, 3.5 }) {
+        const Array vols = gridLocalVol->localVolatilities(t, logStrikes);
+        for (Size i=0; i < logStrikes.size(); ++i) {
+            const Volatility expected
+                = gridLocalVol->localVol(t, std::exp(logStrikes[i]), true);
+            if (std::fabs(vols[i] - expected) > 1e-12)
+                BOOST_FAIL("Failed to reproduce batch local volatility"
+                           << "\n    time:       " << t
+                           << "\n    log-strike: " << logStrikes[i]
+                           << "\n    calculated: " << vols[i]
+                           << "\n    expected:   " << expected);
+        }
+    }
+
+    // parallel sampling does not change the surface
+    const ext::shared_ptr<InterpolatedLocalVolSurface> parallelGridLocalVol =
+        ext::make_shared<InterpolatedLocalVolSurface>(
+            Handle<LocalVolTermStructure>(localVol), 3.0, 120, 30.0, 300.0, 200);
+    parallelGridLocalVol->enableParallelSampling();
+
+    const Matrix& serialMatrix = gridLocalVol->localVolMatrix();
+    const Matrix& parallelMatrix = parallelGridLocalVol->localVolMatrix();
+    for (Size i=0; i < serialMatrix.rows(); ++i)
+        for (Size j=0; j < serialMatrix.columns(); ++j)
+            if (serialMatrix[i][j] != parallelMatrix[i][j])
+                BOOST_FAIL("Parallel sampling changes the local volatility"
+                           << "\n    time:       " << gridLocalVol->times()[i]
+                           << "\n    log-strike: " << gridLocalVol->logStrikes()[j]
+                           << "\n    serial:     " << serialMatrix[i][j]
+                           << "\n    parallel:   " << parallelMatrix[i][j]);
+
+    // finite-difference pricing with either local volatility
+    const ext::shared_ptr<GeneralizedBlackScholesProcess> process =
+        makeProcess(s0, qTS, rTS, volTS);
+    const ext::shared_ptr<GeneralizedBlackScholesProcess> gridProcess =
+        ext::make_shared<GeneralizedBlackScholesProcess>(
+            Handle<Quote>(s0), Handle<YieldTermStructure>(qTS),
+            Handle<YieldTermStructure>(rTS), Handle<BlackVolTermStructure>(volTS),
+            Handle<LocalVolTermStructure>(gridLocalVol));
+
+    for (const auto& maturity : { Period(6, Months), Period(2, Years) }) {
+        for (Real strike : { 80.0, 100.0, 120.0 }) {
+            EuropeanOption option(
+                ext::make_shared<PlainVanillaPayoff>(Option::Call, strike),
+                ext::make_shared<EuropeanExercise>(today + maturity));
+
+            // far outside of the quoted strikes the extrapolated
+            // Black surface is not arbitrage free
+            option.setPricingEngine(ext::make_shared<FdBlackScholesVanillaEngine>(
+                process, 100, 200, 0, FdmSchemeDesc::Douglas(), true, 0.2));
+            const Real expected = option.NPV();
+
+            option.setPricingEngine(ext::make_shared<FdBlackScholesVanillaEngine>(
+                gridProcess, 100, 200, 0, FdmSchemeDesc::Douglas(), true));
+            const Real calculated = option.NPV();
+
+            const Real tol = 1e-3;
+            if (std::fabs(expected - calculated) > tol*expected)
+                BOOST_FAIL("Failed to reproduce local volatility price"
+                           << "\n    strike:     " << strike
+                           << "\n    maturity:   " << maturity
+                           << "\n    calculated: " << calculated
+                           << "\n    expected:   " << expected);
+        }
+    }
+
+    // the surface overwrites illegal values itself, so the operator
+    // must not be given a different overwrite
+    EuropeanOption option(
+        ext::make_shared<PlainVanillaPayoff>(Option::Call, 100.0),
+        ext::make_shared<EuropeanExercise>(today + Period(6, Months)));
+    option.setPricingEngine(ext::make_shared<FdBlackScholesVanillaEngine>(
+        gridProcess, 100, 200, 0, FdmSchemeDesc::Douglas(), true, 0.2));
+    BOOST_CHECK_THROW(option.NPV(), Error);
+}
+
+void EuropeanOptionTest::testCompactBlackVarianceSurface() {
+    BOOST_TEST_MESSAGE("Testing compact Black variance surface...");
+
+    SavedSettings backup;
+
+    const Date today(5, July, 2002);
+    Settings::instance().evaluationDate() = today;
+
+    const DayCounter dc = Actual365Fixed();
+    const std::vector<Date> dates = {
+        today + Period(1, Months), today + Period(3, Months),
+        today + Period(1, Years), today + Period(2, Years),
+        today + Period(5, Years) };
+    const std::vector<Real> strikes = { 50, 70, 85, 100, 110, 130, 160 };
+
+    Matrix blackVols(strikes.size(), dates.size());
+    for (Size i=0; i < strikes.size(); ++i)
+        for (Size j=0; j < dates.size(); ++j) {
+            const Real m = std::log(strikes[i]/100.0);
+            const Time t = dc.yearFraction(today, dates[j]);
+            blackVols[i][j] = 0.25 + (0.08*m*m - 0.05*m)/std::sqrt(1.0 + t);
+        }
+
+    const BlackVarianceSurface::Extrapolation extrapolations[] = {
+        BlackVarianceSurface::ConstantExtrapolation,
+        BlackVarianceSurface::InterpolatorDefaultExtrapolation };
+
+    Array bulkStrikes(120);
+    for (Size k=0; k < bulkStrikes.size(); ++k)
+        bulkStrikes[k] = 40.0 + 1.2*k;
+
+    for (auto extrapolation : extrapolations) {
+        for (bool bicubic : { false, true }) {
+            const ext::shared_ptr<BlackVarianceSurface> surface =
+                ext::make_shared<BlackVarianceSurface>(
+                    today, TARGET(), dates, strikes, blackVols, dc,
+                    extrapolation, extrapolation);
+            if (bicubic)
+                surface->setInterpolation<Bicubic>();
+            surface->enableExtrapolation();
+
+            const auto compactExtrapolation =
+                CompactBlackVarianceSurface::Extrapolation(extrapolation);
+            const CompactBlackVarianceSurface compact(
+                today, TARGET(), dates, strikes, blackVols, dc,
+                bicubic ? CompactBlackVarianceSurface::Bicubic
+                        : CompactBlackVarianceSurface::Bilinear,
+                compactExtrapolation, compactExtrapolation);
+
+            for (Time t : { 0.0, 0.01, 0.2, 0.9, 1.5, 4.0, 5.0, 6.5 }) {
+                const Array variances =
+                    compact.blackVariances(t, bulkStrikes, true);
+                const Array vols = compact.blackVols(t, bulkStrikes, true);
+
+                for (Size k=0; k < bulkStrikes.size(); ++k) {
+                    const Real strike = bulkStrikes[k];
+                    const Real expected = surface->blackVariance(t, strike);
+                    const Real calculated = compact.blackVariance(t, strike, true);
+                    const Real tol = 1e-12;
+                    if (std::fabs(calculated - expected) > tol
+                        || std::fabs(variances[k] - expected) > tol)
+                        BOOST_FAIL("Failed to reproduce Black variance"
+                                   << "\n    interpolation: "
+                                   << (bicubic ? "bicubic" : "bilinear")
+                                   << "\n    time:          " << t
+                                   << "\n    strike:        " << strike
+                                   << std::setprecision(12)
+                                   << "\n    calculated:    " << calculated
+                                   << "\n    bulk:          " << variances[k]
+                                   << "\n    expected:      " << expected);
+
+                    const Volatility expectedVol =
+                        surface->blackVol(t, strike);
+                    if (std::fabs(vols[k] - expectedVol) > 1e-10)
+                        BOOST_FAIL("Failed to reproduce Black volatility"
+                                   << "\n    interpolation: "
+                                   << (bicubic ? "bicubic" : "bilinear")
+                                   << "\n    time:          " << t
+                                   << "\n    strike:        " << strike
+                                   << std::setprecision(12)
+                                   << "\n    calculated:    " << vols[k]
+                                   << "\n    expected:      " << expectedVol);
+                }
+            }
+        }
+    }
+}
+
 void EuropeanOptionTest::testAnalyticEngineDiscountCurve() {
     BOOST_TEST_MESSAGE(
         "Testing separate discount curve for analytic European engine...");
@@ -1804,6 +2039,8 @@ test_suite* EuropeanOptionTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testMcEngines));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testQmcEngines));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testLocalVolatility));
+    suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testInterpolatedLocalVolatility));
+    suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testCompactBlackVarianceSurface));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testAnalyticEngineDiscountCurve));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testPDESchemes));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testFdEngineWithNonConstantParameters));
@@ -46,6 +46,8 @@ class EuropeanOptionTest {
     static void testMcEngines();
     static void testFFTEngines();
     static void testLocalVolatility();
+    static void testInterpolatedLocalVolatility();
+    static void testCompactBlackVarianceSurface();
     static void testAnalyticEngineDiscountCurve();
     static void testPDESchemes();
     static void testDouglasVsCrankNicolson();
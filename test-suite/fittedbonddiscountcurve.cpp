@@ -29,6 +29,8 @@
 #include <ql/time/calendars/canada.hpp>
 #include <ql/time/daycounters/actualactual.hpp>
 #include <ql/pricingengines/bond/discountingbondengine.hpp>
+#include <ql/cashflows/cashflows.hpp>
+#include <ql/cashflows/couponpricer.hpp>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -195,10 +197,97 @@ void FittedBondDiscountCurveTest::testFlatExtrapolation() {
     
 }
 
+void FittedBondDiscountCurveTest::testStoredCashFlows() {
+
+    BOOST_TEST_MESSAGE("Testing fitted bond curves with stored bond cash flows...");
+
+    SavedSettings savedSettings;
+    IndexHistoryCleaner cleaner;
+
+    Date asof(15, Jul, 2019);
+    Settings::instance().evaluationDate() = asof;
+
+    std::vector<ext::shared_ptr<BondHelper> > helpers;
+    Real coupons[] = {0.02, 0.025, 0.0275, 0.03, 0.0325, 0.035, 0.04};
+    for (Size i = 0; i < LENGTH(coupons); ++i) {
+        Schedule schedule(Date(15, Mar, 2019), Date(15, Mar, 2021 + 2 * i), 6 * Months,
+                          TARGET(), Unadjusted, Unadjusted, DateGeneration::Backward, false);
+        ext::shared_ptr<Bond> bond = ext::make_shared<FixedRateBond>(
+            2, 100.0, schedule, std::vector<Real>(1, coupons[i]),
+            ActualActual(ActualActual::Bond, schedule), Following, 100.0);
+        helpers.push_back(ext::make_shared<BondHelper>(
+            Handle<Quote>(ext::make_shared<SimpleQuote>(100.0 + i)), bond));
+    }
+
+    // a floating-rate bond is priced by its helper instead
+    Handle<YieldTermStructure> forecastCurve(flatRate(asof, 0.02, Actual365Fixed()));
+    ext::shared_ptr<IborIndex> index = ext::make_shared<Cdor>(6 * Months, forecastCurve);
+    index->addFixing(Date(15, Mar, 2019), 0.02);
+    ext::shared_ptr<Bond> floater = ext::make_shared<FloatingRateBond>(
+        2, 100.0,
+        Schedule(Date(15, Mar, 2019), Date(15, Mar, 2024), 6 * Months, Canada(),
+                 Unadjusted, Unadjusted, DateGeneration::Backward, false),
+        index, Actual365Fixed());
+    setCouponPricer(floater->cashflows(), ext::make_shared<BlackIborCouponPricer>());
+    helpers.push_back(ext::make_shared<BondHelper>(
+        Handle<Quote>(ext::make_shared<SimpleQuote>(100.0)), floater));
+
+    std::vector<Time> knots = {-30.0, -20.0, 0.0, 5.0, 10.0, 15.0, 20.0, 30.0, 40.0, 50.0};
+
+    std::vector<ext::shared_ptr<FittedBondDiscountCurve::FittingMethod> > methods = {
+        ext::make_shared<NelsonSiegelFitting>(),
+        ext::make_shared<SvenssonFitting>(),
+        ext::make_shared<ExponentialSplinesFitting>(true),
+        ext::make_shared<CubicBSplinesFitting>(knots, true),
+        ext::make_shared<SimplePolynomialFitting>(3, true)
+    };
+
+    std::vector<Time> times;
+    for (Size i = 0; i <= 60; ++i)
+        times.push_back(0.2 * i);
+
+    for (Size k = 0; k < methods.size(); ++k) {
+        auto curve = ext::make_shared<FittedBondDiscountCurve>(
+            asof, helpers, Actual365Fixed(), *methods[k], 1e-10, 2000);
+
+        // bulk and scalar discounts
+        std::vector<DiscountFactor> discounts;
+        curve->discount(times, discounts);
+        for (Size i = 0; i < times.size(); ++i) {
+            DiscountFactor expected = curve->discount(times[i]);
+            if (std::fabs(discounts[i] - expected) > 1e-12 * std::fabs(expected))
+                BOOST_ERROR("bulk discount differs from scalar one for method #" << k
+                            << "\n    time:     " << times[i]
+                            << "\n    bulk:     " << discounts[i]
+                            << "\n    expected: " << expected);
+        }
+
+        // the cost of the fit, recomputed from the cash flows of the bonds
+        const FittedBondDiscountCurve::FittingMethod& results = curve->fitResults();
+        Array weights = results.weights();
+        Real cost = 0.0;
+        for (Size i = 0; i < helpers.size(); ++i) {
+            ext::shared_ptr<Bond> bond = helpers[i]->bond();
+            Date settlement = bond->settlementDate();
+            Real cleanPrice =
+                CashFlows::npv(bond->cashflows(), *curve, false, settlement, settlement) *
+                    100.0 / bond->notional(settlement) -
+                bond->accruedAmount(settlement);
+            Real error = weights[i] * (cleanPrice - helpers[i]->quote()->value());
+            cost += error * error;
+        }
+        if (std::fabs(cost - results.minimumCostValue()) > 1e-10 * cost)
+            BOOST_ERROR("fit cost not reproduced by the bond engines for method #" << k
+                        << "\n    fit cost:    " << results.minimumCostValue()
+                        << "\n    engine cost: " << cost);
+    }
+}
+
 
 test_suite* FittedBondDiscountCurveTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Fitted bond discount curve tests");
     suite->add(QUANTLIB_TEST_CASE(&FittedBondDiscountCurveTest::testEvaluation));
     suite->add(QUANTLIB_TEST_CASE(&FittedBondDiscountCurveTest::testFlatExtrapolation));
+    suite->add(QUANTLIB_TEST_CASE(&FittedBondDiscountCurveTest::testStoredCashFlows));
     return suite;
 }
@@ -285,9 +285,166 @@ void GsrTest::testGsrModel() {
                     << GsrJamNpv << ")");
 }
 
+void GsrTest::testGridCache() {
+
+    BOOST_TEST_MESSAGE("Testing cached GSR state grid values...");
+
+    Date refDate = Settings::instance().evaluationDate();
+
+    std::vector<Date> stepDates;
+    for (Size i = 1; i < 10; i++)
+        stepDates.push_back(refDate + (i * Years));
+    ext::shared_ptr<SimpleQuote> vol(new SimpleQuote(0.01));
+    std::vector<Handle<Quote> > vols(stepDates.size() + 1, Handle<Quote>(vol));
+    Handle<Quote> reversion(ext::shared_ptr<Quote>(new SimpleQuote(0.02)));
+
+    Handle<YieldTermStructure> yts(ext::shared_ptr<YieldTermStructure>(
+        new FlatForward(0, TARGET(), 0.03, Actual365Fixed())));
+    ext::shared_ptr<Gsr> model(
+        new Gsr(yts, stepDates, vols, reversion, 50.0));
+    ext::shared_ptr<IborIndex> iborIndex(new Euribor6M(yts));
+
+    Array y = model->yGrid(7.0, 16);
+    Date expiry = TARGET().advance(refDate, 5 * Years);
+    Date maturity = TARGET().advance(refDate, 12 * Years);
+    Time t = yts->timeFromReference(expiry);
+    Time T = yts->timeFromReference(maturity);
+
+    // grid values must equal the pointwise ones, both when they are
+    // computed and when they are taken from the cache, and they must
+    // follow changes in the model parameters
+
+    for (Size run = 0; run < 3; ++run) {
+        if (run == 2)
+            vol->setValue(0.015);
+        for (Size pass = 0; pass < 2; ++pass) {
+            Array numeraire = model->numeraire(t, y);
+            Array zerobond = model->zerobond(T, t, y);
+            Array zerobondDates = model->zerobond(maturity, expiry, y);
+            Array forward = model->forwardRate(maturity, expiry, y, iborIndex);
+            for (Size i = 0; i < y.size(); ++i) {
+                if (numeraire[i] != model->numeraire(t, y[i]))
+                    BOOST_ERROR("grid numeraire (" << numeraire[i]
+                                << ") differs from pointwise one ("
+                                << model->numeraire(t, y[i]) << ") at y="
+                                << y[i] << " after vol change: " << (run == 2));
+                if (zerobond[i] != model->zerobond(T, t, y[i]))
+                    BOOST_ERROR("grid zerobond (" << zerobond[i]
+                                << ") differs from pointwise one ("
+                                << model->zerobond(T, t, y[i]) << ") at y="
+                                << y[i] << " after vol change: " << (run == 2));
+                if (zerobondDates[i] != model->zerobond(maturity, expiry, y[i]))
+                    BOOST_ERROR("grid zerobond (" << zerobondDates[i]
+                                << ") differs from pointwise one ("
+                                << model->zerobond(maturity, expiry, y[i])
+                                << ") at y=" << y[i]
+                                << " after vol change: " << (run == 2));
+                if (forward[i] !=
+                    model->forwardRate(maturity, expiry, y[i], iborIndex))
+                    BOOST_ERROR("grid forward rate ("
+                                << forward[i] << ") differs from pointwise one ("
+                                << model->forwardRate(maturity, expiry, y[i],
+                                                      iborIndex)
+                                << ") at y=" << y[i]
+                                << " after vol change: " << (run == 2));
+            }
+        }
+    }
+
+    // the cache is bounded; values must stay right when it is flushed
+
+    for (Size k = 0; k < 1100; ++k) {
+        Time tk = t * (1.0 + k / 2000.0);
+        Array numeraire = model->numeraire(tk, y);
+        if (k % 100 == 0 && numeraire[0] != model->numeraire(tk, y[0]))
+            BOOST_ERROR("grid numeraire (" << numeraire[0]
+                        << ") differs from pointwise one ("
+                        << model->numeraire(tk, y[0]) << ") at t=" << tk);
+    }
+
+    // prices of bermudan swaptions sharing the cache must not depend
+    // on the order in which they are priced
+
+    std::vector<Date> exerciseDates;
+    for (Size i = 1; i < 10; i++)
+        exerciseDates.push_back(TARGET().advance(refDate, i * Years));
+    ext::shared_ptr<Exercise> exercise(new BermudanExercise(exerciseDates));
+
+    std::vector<ext::shared_ptr<Swaption> > swaptions;
+    for (Size i = 0; i < 3; ++i) {
+        ext::shared_ptr<VanillaSwap> underlying =
+            MakeVanillaSwap(10 * Years, iborIndex, 0.025 + 0.005 * i)
+                .withEffectiveDate(TARGET().advance(refDate, 1 * Years));
+        swaptions.push_back(ext::make_shared<Swaption>(underlying, exercise));
+    }
+
+    ext::shared_ptr<PricingEngine> engine(
+        new Gaussian1dSwaptionEngine(model, 64, 7.0, true, false));
+    std::vector<Real> npvs(swaptions.size());
+    for (Size i = swaptions.size(); i-- > 0;) {
+        swaptions[i]->setPricingEngine(engine);
+        npvs[i] = swaptions[i]->NPV();
+    }
+
+    for (Size i = 0; i < swaptions.size(); ++i) {
+        ext::shared_ptr<Gsr> freshModel(
+            new Gsr(yts, stepDates, vols, reversion, 50.0));
+        swaptions[i]->setPricingEngine(ext::shared_ptr<PricingEngine>(
+            new Gaussian1dSwaptionEngine(freshModel, 64, 7.0, true, false)));
+        Real freshNpv = swaptions[i]->NPV();
+        if (std::fabs(npvs[i] - freshNpv) > 1E-14)
+            BOOST_ERROR("swaption #" << i << " priced with shared cache ("
+                        << npvs[i] << ") differs from price with fresh model ("
+                        << freshNpv << ")");
+    }
+
+    // the cache is not thread-safe, so that enabling parallel
+    // calibration must fall back to a serial one
+
+    std::vector<ext::shared_ptr<CalibrationHelper> > basket;
+    for (Size i = 1; i < 4; ++i)
+        basket.push_back(ext::make_shared<SwaptionHelper>(
+            i * Years, (10 - i) * Years,
+            Handle<Quote>(ext::make_shared<SimpleQuote>(0.004 + 0.0005 * i)),
+            iborIndex, 1 * Years, Thirty360(Thirty360::BondBasis),
+            Actual360(), yts, BlackCalibrationHelper::RelativePriceError,
+            Null<Real>(), 1.0, Normal));
+
+    Array calibrated[2];
+    for (Size parallel = 0; parallel < 2; ++parallel) {
+        std::vector<Date> calibrationDates = { TARGET().advance(refDate, 1 * Years),
+                                               TARGET().advance(refDate, 2 * Years) };
+        std::vector<Handle<Quote> > calibrationVols;
+        for (Size i = 0; i < 3; ++i)
+            calibrationVols.emplace_back(ext::make_shared<SimpleQuote>(0.01));
+        ext::shared_ptr<Gsr> calibratedModel(
+            new Gsr(yts, calibrationDates, calibrationVols, reversion, 50.0));
+        ext::shared_ptr<PricingEngine> basketEngine(
+            new Gaussian1dSwaptionEngine(calibratedModel, 64, 7.0, true, false));
+        for (const auto& helper : basket)
+            ext::dynamic_pointer_cast<BlackCalibrationHelper>(helper)
+                ->setPricingEngine(basketEngine);
+
+        if (parallel != 0)
+            calibratedModel->enableParallelCalibration();
+        LevenbergMarquardt lm;
+        calibratedModel->calibrate(basket, lm, EndCriteria(200, 20, 1E-8, 1E-8, 1E-8),
+                                   Constraint(), std::vector<Real>(),
+                                   calibratedModel->FixedReversions());
+        calibrated[parallel] = calibratedModel->params();
+    }
+    for (Size i = 0; i < calibrated[0].size(); ++i) {
+        if (calibrated[0][i] != calibrated[1][i])
+            BOOST_ERROR("calibration with parallel evaluation enabled ("
+                        << calibrated[1] << ") differs from serial one ("
+                        << calibrated[0] << ")");
+    }
+}
+
 test_suite *GsrTest::suite() {
     auto* suite = BOOST_TEST_SUITE("GSR model tests");
     suite->add(QUANTLIB_TEST_CASE(&GsrTest::testGsrProcess));
     suite->add(QUANTLIB_TEST_CASE(&GsrTest::testGsrModel));
+    suite->add(QUANTLIB_TEST_CASE(&GsrTest::testGridCache));
     return suite;
 }
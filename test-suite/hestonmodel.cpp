@@ -38,6 +38,7 @@
 #include <ql/pricingengines/blackformula.hpp>
 #include <ql/pricingengines/vanilla/analyticdividendeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/analytichestonengine.hpp>
+#include <ql/pricingengines/vanilla/analytichestonhullwhiteengine.hpp>
 #include <ql/pricingengines/vanilla/analyticptdhestonengine.hpp>
 #include <ql/pricingengines/vanilla/coshestonengine.hpp>
 #include <ql/pricingengines/vanilla/exponentialfittinghestonengine.hpp>
@@ -3364,6 +3365,312 @@ void HestonModelTest::testLocalVolFromHestonModel() {
 }
 
 
+void HestonModelTest::testParallelCalibration() {
+    BOOST_TEST_MESSAGE(
+       "Testing Heston model calibration with parallel helper evaluation...");
+
+    SavedSettings backup;
+
+    const Date today = Date(27, December, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const DayCounter dayCounter = Actual365Fixed();
+    const Calendar calendar = NullCalendar();
+
+    const Handle<YieldTermStructure> riskFreeTS(flatRate(0.03, dayCounter));
+    const Handle<YieldTermStructure> dividendTS(flatRate(0.01, dayCounter));
+    const Handle<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+
+    const std::vector<Period> maturities = {3 * Months, 6 * Months, 1 * Years, 2 * Years};
+    const std::vector<Real> strikes = {80.0, 90.0, 100.0, 110.0, 120.0};
+
+    const auto calibrate = [&](bool parallel, bool shareEngine) {
+        const auto model = ext::make_shared<HestonModel>(
+            ext::make_shared<HestonProcess>(
+                riskFreeTS, dividendTS, s0, 0.04, 1.0, 0.04, 0.5, -0.5));
+        const auto sharedEngine = ext::make_shared<AnalyticHestonEngine>(model, 96);
+
+        std::vector<ext::shared_ptr<CalibrationHelper> > helpers;
+        for (const auto& maturity : maturities) {
+            for (Real strike : strikes) {
+                const Volatility vol = 0.2 + 0.1*std::fabs(std::log(strike/100.0));
+                const auto helper = ext::make_shared<HestonModelHelper>(
+                    maturity, calendar, s0, strike,
+                    Handle<Quote>(ext::make_shared<SimpleQuote>(vol)),
+                    riskFreeTS, dividendTS);
+                helper->setPricingEngine(
+                    shareEngine ? sharedEngine
+                                : ext::make_shared<AnalyticHestonEngine>(model, 96));
+                helpers.push_back(helper);
+            }
+        }
+
+        model->enableParallelCalibration(parallel);
+        LevenbergMarquardt om(1e-8, 1e-8, 1e-8);
+        model->calibrate(helpers, om, EndCriteria(200, 40, 1.0e-8, 1.0e-8, 1.0e-8));
+
+        return model->params();
+    };
+
+    const Array serial = calibrate(false, true);
+    const Array parallel = calibrate(true, false);
+
+    for (Size i=0; i<serial.size(); ++i) {
+        if (std::fabs(serial[i] - parallel[i]) > 1e-12) {
+            BOOST_ERROR("parallel calibration differs from serial one"
+                        << "\n    parameter: " << i
+                        << "\n    serial:    " << serial[i]
+                        << "\n    parallel:  " << parallel[i]);
+        }
+    }
+
+    BOOST_CHECK_THROW(calibrate(true, true), Error);
+}
+
+
+void HestonModelTest::testBatchPricing() {
+    BOOST_TEST_MESSAGE(
+       "Testing Heston batch pricing across strikes...");
+
+    SavedSettings backup;
+
+    const Date today = Date(27, December, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const DayCounter dayCounter = Actual365Fixed();
+    const Handle<YieldTermStructure> riskFreeTS(flatRate(0.05, dayCounter));
+    const Handle<YieldTermStructure> dividendTS(flatRate(0.02, dayCounter));
+    const Handle<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+
+    const auto model = ext::make_shared<HestonModel>(
+        ext::make_shared<HestonProcess>(
+            riskFreeTS, dividendTS, s0, 0.04, 1.5, 0.05, 0.6, -0.7));
+
+    typedef AnalyticHestonEngine::Integration Integration;
+    const ext::shared_ptr<AnalyticHestonEngine> engines[] = {
+        ext::make_shared<AnalyticHestonEngine>(model, 144),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::Gatheral, Integration::gaussLegendre(96)),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::AndersenPiterbarg,
+            Integration::gaussLaguerre(128)),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::AsymptoticChF,
+            Integration::gaussChebyshev(128)),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::OptimalCV,
+            Integration::gaussChebyshev2nd(128)),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::BranchCorrection,
+            Integration::gaussLaguerre(144)),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::OptimalCV,
+            Integration::gaussLobatto(1e-10, 1e-10, 10000))
+    };
+
+    const std::vector<Period> maturities = {1 * Months, 1 * Years, 5 * Years};
+    const std::vector<Real> strikes = {50.0, 80.0, 100.0, 120.0, 200.0};
+
+    const auto priceOneByOne = [&](const ext::shared_ptr<PricingEngine>& engine,
+                                   const Date& maturity,
+                                   const ext::shared_ptr<PlainVanillaPayoff>& payoff) {
+        VanillaOption option(payoff, ext::make_shared<EuropeanExercise>(maturity));
+        option.setPricingEngine(engine);
+        return option.NPV();
+    };
+
+    const Real tol = 1e-10;
+    for (Size e=0; e < LENGTH(engines); ++e) {
+        for (const auto& maturity : maturities) {
+            const Date maturityDate = today + maturity;
+
+            std::vector<ext::shared_ptr<PlainVanillaPayoff> > payoffs;
+            for (Real strike : strikes) {
+                payoffs.push_back(ext::make_shared<PlainVanillaPayoff>(Option::Call, strike));
+                payoffs.push_back(ext::make_shared<PlainVanillaPayoff>(Option::Put, strike));
+            }
+
+            const std::vector<Real> calculated = engines[e]->prices(maturityDate, payoffs);
+
+            for (Size i=0; i < payoffs.size(); ++i) {
+                const Real expected = priceOneByOne(engines[e], maturityDate, payoffs[i]);
+                if (std::fabs(calculated[i] - expected) > tol) {
+                    BOOST_ERROR("failed to reproduce single-option price "
+                                "with batch pricing"
+                                << "\n    engine:     " << e
+                                << "\n    maturity:   " << maturityDate
+                                << "\n    strike:     " << payoffs[i]->strike()
+                                << "\n    type:       " << payoffs[i]->optionType()
+                                << std::setprecision(12)
+                                << "\n    calculated: " << calculated[i]
+                                << "\n    expected:   " << expected);
+                }
+            }
+        }
+    }
+
+    // cached node values are reused for further strikes and
+    // discarded when the model parameters change
+    const Size order = 144;
+    const auto reference = ext::make_shared<AnalyticHestonEngine>(model, order);
+    const auto cached = ext::make_shared<AnalyticHestonEngine>(model, order);
+    cached->enableChFCaching();
+
+    const Date maturityDate = today + 1 * Years;
+    const auto atm = ext::make_shared<PlainVanillaPayoff>(Option::Call, 100.0);
+    const auto otm = ext::make_shared<PlainVanillaPayoff>(Option::Put, 80.0);
+
+    const Array params = model->params();
+    for (Size n=0; n < 2; ++n) {
+        if (n == 1) {
+            Array bumped = params;
+            bumped[3] += 0.1;
+            model->setParams(bumped);
+        }
+
+        for (const auto& payoff : {atm, otm}) {
+            const Real calculated = priceOneByOne(cached, maturityDate, payoff);
+            const Real expected = priceOneByOne(reference, maturityDate, payoff);
+
+            const Size expectedEvaluations = (payoff == atm) ? 2*order : 0;
+            if (cached->numberOfEvaluations() != expectedEvaluations)
+                BOOST_ERROR("unexpected number of characteristic-function "
+                            "evaluations with caching"
+                            << "\n    calculated: " << cached->numberOfEvaluations()
+                            << "\n    expected:   " << expectedEvaluations);
+
+            if (std::fabs(calculated - expected) > tol)
+                BOOST_ERROR("failed to reproduce uncached price with caching"
+                            << std::setprecision(12)
+                            << "\n    strike:     " << payoff->strike()
+                            << "\n    calculated: " << calculated
+                            << "\n    expected:   " << expected);
+        }
+    }
+
+    // the add-on term of hybrid engines depends on the Hull-White model
+    const auto hullWhite = ext::make_shared<HullWhite>(riskFreeTS, 0.1, 0.01);
+    const auto hybrid =
+        ext::make_shared<AnalyticHestonHullWhiteEngine>(model, hullWhite, order);
+    BOOST_CHECK_THROW(hybrid->enableChFCaching(), Error);
+}
+
+
+void HestonModelTest::testAnalyticSensitivities() {
+    BOOST_TEST_MESSAGE(
+       "Testing analytic Heston parameter sensitivities...");
+
+    SavedSettings backup;
+
+    const Date today = Date(27, December, 2022);
+    Settings::instance().evaluationDate() = today;
+
+    const DayCounter dayCounter = Actual365Fixed();
+    const Calendar calendar = NullCalendar();
+    const Handle<YieldTermStructure> riskFreeTS(flatRate(0.05, dayCounter));
+    const Handle<YieldTermStructure> dividendTS(flatRate(0.02, dayCounter));
+    const Handle<Quote> s0(ext::make_shared<SimpleQuote>(100.0));
+
+    const Real theta = 0.06, kappa = 1.5, sigma = 0.5, rho = -0.6, v0 = 0.04;
+    const auto model = ext::make_shared<HestonModel>(
+        ext::make_shared<HestonProcess>(
+            riskFreeTS, dividendTS, s0, v0, kappa, theta, sigma, rho));
+
+    typedef AnalyticHestonEngine::Integration Integration;
+    const ext::shared_ptr<AnalyticHestonEngine> engines[] = {
+        ext::make_shared<AnalyticHestonEngine>(model, 192),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::OptimalCV,
+            Integration::gaussLegendre(256)),
+        ext::make_shared<AnalyticHestonEngine>(
+            model, AnalyticHestonEngine::AndersenPiterbarg,
+            Integration::gaussLobatto(1e-12, 1e-12, 100000))
+    };
+
+    const Array params = model->params();
+    const Real h = 1e-5;
+    const Real tol = 1e-5;
+
+    for (Size e=0; e < LENGTH(engines); ++e) {
+        for (const Period& maturity : {3 * Months, 2 * Years}) {
+            for (Real strike : {70.0, 100.0, 130.0}) {
+                for (Option::Type type : {Option::Call, Option::Put}) {
+                    const Date maturityDate = today + maturity;
+                    const PlainVanillaPayoff payoff(type, strike);
+
+                    VanillaOption option(
+                        ext::make_shared<PlainVanillaPayoff>(payoff),
+                        ext::make_shared<EuropeanExercise>(maturityDate));
+                    option.setPricingEngine(engines[e]);
+
+                    const Array calculated =
+                        engines[e]->priceSensitivities(maturityDate, payoff);
+
+                    for (Size i=0; i < params.size(); ++i) {
+                        Array bumped = params;
+                        bumped[i] = params[i] + h;
+                        model->setParams(bumped);
+                        const Real up = option.NPV();
+                        bumped[i] = params[i] - h;
+                        model->setParams(bumped);
+                        const Real down = option.NPV();
+                        model->setParams(params);
+
+                        const Real expected = (up - down)/(2*h);
+                        if (std::fabs(calculated[i] - expected) > tol) {
+                            BOOST_ERROR("failed to reproduce finite-difference "
+                                        "parameter sensitivity"
+                                        << "\n    engine:     " << e
+                                        << "\n    maturity:   " << maturity
+                                        << "\n    strike:     " << strike
+                                        << "\n    type:       " << type
+                                        << "\n    parameter:  " << i
+                                        << std::setprecision(10)
+                                        << "\n    calculated: " << calculated[i]
+                                        << "\n    expected:   " << expected);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // calibration using the analytic Jacobian recovers the parameters
+    // used to generate the market quotes
+    std::vector<ext::shared_ptr<CalibrationHelper> > helpers;
+    const auto engine = ext::make_shared<AnalyticHestonEngine>(model, 192);
+    for (const Period& maturity : {3 * Months, 6 * Months, 1 * Years, 2 * Years}) {
+        for (Real strike : {80.0, 90.0, 100.0, 110.0, 120.0}) {
+            const auto vol = ext::make_shared<SimpleQuote>(0.2);
+            const auto helper = ext::make_shared<HestonModelHelper>(
+                maturity, calendar, s0, strike, Handle<Quote>(vol),
+                riskFreeTS, dividendTS, BlackCalibrationHelper::ImpliedVolError);
+            helper->setPricingEngine(engine);
+            vol->setValue(helper->impliedVolatility(
+                helper->modelValue(), 1e-12, 1000, 0.01, 2.0));
+            helpers.push_back(helper);
+        }
+    }
+
+    model->setParams(Array({0.04, 1.0, 0.3, -0.3, 0.06}));
+
+    LevenbergMarquardt om(1e-8, 1e-8, 1e-8, true);
+    model->calibrate(helpers, om, EndCriteria(400, 40, 1.0e-12, 1.0e-12, 1.0e-12));
+
+    const Real calibrationTol = 1e-5;
+    const Array calibrated = model->params();
+    for (Size i=0; i < params.size(); ++i) {
+        if (std::fabs(calibrated[i] - params[i]) > calibrationTol) {
+            BOOST_ERROR("failed to recover Heston parameter with "
+                        "analytic Jacobian"
+                        << "\n    parameter:  " << i
+                        << "\n    calibrated: " << calibrated[i]
+                        << "\n    expected:   " << params[i]);
+        }
+    }
+}
+
+
 test_suite* HestonModelTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Heston model tests");
 
@@ -3396,6 +3703,9 @@ test_suite* HestonModelTest::suite(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testOptimalControlVariateChoice));
     suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testAsymptoticControlVariate));
     suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testLocalVolFromHestonModel));
+    suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testParallelCalibration));
+    suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testBatchPricing));
+    suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testAnalyticSensitivities));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testDifferentIntegrals));
@@ -63,6 +63,9 @@ class HestonModelTest {
     static void testOptimalControlVariateChoice();
     static void testAsymptoticControlVariate();
     static void testLocalVolFromHestonModel();
+    static void testParallelCalibration();
+    static void testBatchPricing();
+    static void testAnalyticSensitivities();
     
 
     static boost::unit_test_framework::test_suite* suite(SpeedLevel);
@@ -88,6 +88,7 @@
 #include <boost/math/special_functions/gamma.hpp>
 #include <boost/multi_array.hpp>
 #include <iomanip>
+#include <sstream>
 
 using namespace QuantLib;
 using boost::unit_test_framework::test_suite;
@@ -2748,6 +2749,100 @@ void HestonSLVModelTest::testBarrierPricingMixedModelsMonteCarloVsFdmPricing() {
     }
 }
 
+void HestonSLVModelTest::testParallelCalibration() {
+    BOOST_TEST_MESSAGE(
+        "Testing parallel leverage function calibration and persistence...");
+
+    SavedSettings backup;
+
+    const DayCounter dc = Actual365Fixed();
+    const Date todaysDate(5, Jan, 2016);
+    const Date maturityDate = todaysDate + Period(1, Years);
+    Settings::instance().evaluationDate() = todaysDate;
+
+    const Handle<Quote> spot(ext::make_shared<SimpleQuote>(100.0));
+    const Handle<YieldTermStructure> rTS(flatRate(0.05, dc));
+    const Handle<YieldTermStructure> qTS(flatRate(0.02, dc));
+
+    const Handle<LocalVolTermStructure> localVol(
+        ext::make_shared<LocalConstantVol>(todaysDate, 0.3, dc));
+
+    const Handle<HestonModel> hestonModel(
+        ext::make_shared<HestonModel>(
+            ext::make_shared<HestonProcess>(
+                rTS, qTS, spot, 0.09, 1.0, 0.06, 0.4, -0.75)));
+
+    const ext::shared_ptr<BrownianGeneratorFactory> generatorFactory
+        = ext::make_shared<MTBrownianGeneratorFactory>(1234UL);
+
+    HestonSLVMCModel serialMC(
+        localVol, hestonModel, generatorFactory, maturityDate, 52, 50, 5000);
+    HestonSLVMCModel parallelMC(
+        localVol, hestonModel, generatorFactory, maturityDate, 52, 50, 5000);
+    parallelMC.enableParallelCalibration();
+
+    const HestonSLVFokkerPlanckFdmParams fdmParams = {
+        51, 51, 100, 25, 100.0, 5, 2,
+        0.1, 1e-4, 10000,
+        1e-5, 1e-5, 0.0000025,
+        1.0, 0.1, 0.9, 1e-5,
+        FdmHestonGreensFct::ZeroCorrelation,
+        FdmSquareRootFwdOp::Log,
+        FdmSchemeDesc::ModifiedCraigSneyd()
+    };
+
+    HestonSLVFDMModel serialFDM(localVol, hestonModel, maturityDate, fdmParams);
+    HestonSLVFDMModel parallelFDM(localVol, hestonModel, maturityDate, fdmParams);
+    parallelFDM.enableParallelCalibration();
+
+    const std::string names[] = { "Monte-Carlo", "FDM" };
+    const ext::shared_ptr<FixedLocalVolSurface> serial[] = {
+        serialMC.leverageFunction(), serialFDM.leverageFunction() };
+    const ext::shared_ptr<FixedLocalVolSurface> parallel[] = {
+        parallelMC.leverageFunction(), parallelFDM.leverageFunction() };
+
+    for (Size m=0; m < 2; ++m) {
+        const Matrix& expected = serial[m]->localVolMatrix();
+        const Matrix& calculated = parallel[m]->localVolMatrix();
+
+        for (Size i=0; i < expected.rows(); ++i)
+            for (Size j=0; j < expected.columns(); ++j)
+                if (expected[i][j] != calculated[i][j])
+                    BOOST_FAIL("parallel " << names[m] << " calibration "
+                               "differs from serial calibration"
+                               << "\n  row:        " << i
+                               << "\n  column:     " << j
+                               << "\n  serial:     " << expected[i][j]
+                               << "\n  parallel:   " << calculated[i][j]);
+
+        std::stringstream stream;
+        serial[m]->save(stream);
+        const ext::shared_ptr<FixedLocalVolSurface> loaded
+            = FixedLocalVolSurface::load(stream, dc);
+
+        if (loaded->referenceDate() != serial[m]->referenceDate()
+            || loaded->maxDate() != serial[m]->maxDate())
+            BOOST_ERROR("failed to reload " << names[m]
+                        << " leverage function dates");
+
+        for (Time t=0.0; t < 1.0; t+=0.05) {
+            for (Real strike=50.0; strike < 200.0; strike+=7.5) {
+                const Volatility expected = serial[m]->localVol(t, strike, true);
+                const Volatility calculated = loaded->localVol(t, strike, true);
+
+                if (expected != calculated)
+                    BOOST_ERROR("failed to reload " << names[m]
+                                << " leverage function"
+                                << std::setprecision(16)
+                                << "\n  time:       " << t
+                                << "\n  strike:     " << strike
+                                << "\n  expected:   " << expected
+                                << "\n  calculated: " << calculated);
+            }
+        }
+    }
+}
+
 test_suite* HestonSLVModelTest::experimental(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Heston Stochastic Local Volatility tests");
 
@@ -2760,6 +2855,7 @@ test_suite* HestonSLVModelTest::experimental(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&HestonSLVModelTest::testBarrierPricingViaHestonLocalVol));
     suite->add(QUANTLIB_TEST_CASE(&HestonSLVModelTest::testLocalVolsvSLVPropDensity));
     suite->add(QUANTLIB_TEST_CASE(&HestonSLVModelTest::testDiffusionAndDriftSlvProcess));
+    suite->add(QUANTLIB_TEST_CASE(&HestonSLVModelTest::testParallelCalibration));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&HestonSLVModelTest::testHestonFokkerPlanckFwdEquationLogLVLeverage));
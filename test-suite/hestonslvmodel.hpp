@@ -48,6 +48,7 @@ public:
     static void testMoustacheGraph();
     static void testForwardSkewSLV();
     static void testDiffusionAndDriftSlvProcess();
+    static void testParallelCalibration();
 
     static boost::unit_test_framework::test_suite* experimental(SpeedLevel);
 
@@ -37,6 +37,8 @@
 #include <ql/math/interpolations/kernelinterpolation2d.hpp>
 #include <ql/math/interpolations/lagrangeinterpolation.hpp>
 #include <ql/math/interpolations/linearinterpolation.hpp>
+#include <ql/math/interpolations/loginterpolation.hpp>
+#include <ql/math/interpolations/multichebyshevinterpolation.hpp>
 #include <ql/math/interpolations/multicubicspline.hpp>
 #include <ql/math/interpolations/sabrinterpolation.hpp>
 #include <ql/math/kernelfunctions.hpp>
@@ -1991,6 +1993,85 @@ void InterpolationTest::testSabrSingleCases() {
 
 }
 
+void InterpolationTest::testSabrAnalyticJacobian() {
+
+    BOOST_TEST_MESSAGE("Testing Sabr volatility gradient and analytic calibration...");
+
+    std::vector<Real> strikes = { 0.01, 0.015, 0.02, 0.025, 0.035,
+                                  0.04, 0.05, 0.06, 0.08 };
+    Real forward = 0.03, expiry = 2.5, shift = 0.01;
+    Real alpha = 0.05, beta = 0.6, nu = 0.4, rho = -0.3;
+
+    for (auto volatilityType : { VolatilityType::ShiftedLognormal, VolatilityType::Normal }) {
+        std::vector<Real> vols =
+            shiftedSabrVolatilities(strikes, forward, expiry, alpha, beta,
+                                    nu, rho, shift, volatilityType);
+        for (Size i=0; i<strikes.size(); ++i) {
+            Real expected = shiftedSabrVolatility(strikes[i], forward, expiry, alpha,
+                                                  beta, nu, rho, shift, volatilityType);
+            if (vols[i] != expected)
+                BOOST_ERROR("failed to reproduce single-strike Sabr volatility"
+                            << "\n    strike:     " << strikes[i]
+                            << "\n    expected:   " << expected
+                            << "\n    calculated: " << vols[i]);
+
+            Array gradient;
+            Real vol = unsafeShiftedSabrVolatilityGradient(
+                strikes[i], forward, expiry, alpha, beta, nu, rho, shift,
+                volatilityType, gradient);
+            if (std::fabs(vol - expected) > 1e-15)
+                BOOST_ERROR("failed to reproduce Sabr volatility with gradient"
+                            << "\n    strike:     " << strikes[i]
+                            << "\n    expected:   " << expected
+                            << "\n    calculated: " << vol);
+
+            Real params[] = { alpha, beta, nu, rho };
+            const char* names[] = { "alpha", "beta", "nu", "rho" };
+            const Real h = 1e-5;
+            for (Size j=0; j<4; ++j) {
+                Real up[] = { alpha, beta, nu, rho };
+                Real down[] = { alpha, beta, nu, rho };
+                up[j] = params[j] + h;
+                down[j] = params[j] - h;
+                Real fd = (shiftedSabrVolatility(strikes[i], forward, expiry, up[0],
+                                                 up[1], up[2], up[3], shift, volatilityType)
+                           - shiftedSabrVolatility(strikes[i], forward, expiry, down[0],
+                                                   down[1], down[2], down[3], shift,
+                                                   volatilityType)) / (2*h);
+                if (std::fabs(fd - gradient[j]) > 1e-6*std::max(1.0, std::fabs(fd)))
+                    BOOST_ERROR("failed to reproduce Sabr derivative w.r.t. " << names[j]
+                                << "\n    strike:        " << strikes[i]
+                                << "\n    finite diff.:  " << fd
+                                << "\n    analytic:      " << gradient[j]);
+            }
+        }
+    }
+
+    // calibration using the analytic Jacobian recovers the parameters
+    std::vector<Real> vols =
+        shiftedSabrVolatilities(strikes, forward, expiry, alpha, beta, nu, rho, shift);
+    ext::shared_ptr<EndCriteria> endCriteria(
+        new EndCriteria(100000, 100, 1e-12, 1e-12, 1e-12));
+    ext::shared_ptr<OptimizationMethod> method(
+        new LevenbergMarquardt(1e-12, 1e-12, 1e-12, true));
+    SABRInterpolation sabr(strikes.begin(), strikes.end(), vols.begin(), expiry,
+                           forward, 0.04, 0.5, 0.3, 0.0, false, false, false, false,
+                           false, endCriteria, method, 1e-10, false, 50, shift);
+    sabr.update();
+
+    Real tolerance = 1e-6;
+    if (std::fabs(sabr.alpha() - alpha) > tolerance
+        || std::fabs(sabr.beta() - beta) > tolerance
+        || std::fabs(sabr.nu() - nu) > tolerance
+        || std::fabs(sabr.rho() - rho) > tolerance)
+        BOOST_ERROR("failed to recover Sabr parameters with analytic Jacobian"
+                    << "\n    alpha: " << sabr.alpha() << " (expected " << alpha << ")"
+                    << "\n    beta:  " << sabr.beta() << " (expected " << beta << ")"
+                    << "\n    nu:    " << sabr.nu() << " (expected " << nu << ")"
+                    << "\n    rho:   " << sabr.rho() << " (expected " << rho << ")"
+                    << "\n    rms error: " << sabr.rmsError());
+}
+
 void InterpolationTest::testTransformations() {
 
     BOOST_TEST_MESSAGE("Testing Sabr and no-arbitrage Sabr transformation functions...");
@@ -2520,6 +2601,167 @@ void InterpolationTest::testChebyshevInterpolationUpdateY() {
     }
 }
 
+void InterpolationTest::testHintedEvaluation() {
+    BOOST_TEST_MESSAGE("Testing hinted and bulk interpolation lookup...");
+
+    const std::vector<Real> x = { 0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 15.0, 20.0, 30.0 };
+    const std::vector<Real> y = { 1.2, 1.1, 1.6, 1.4, 2.0, 2.2, 1.9, 2.5, 2.4, 2.6 };
+
+    std::vector<Real> increasing;
+    for (Real t=0.0; t <= 32.0; t+=0.125)
+        increasing.push_back(t);
+    // nodes themselves must be found as well
+    increasing.insert(increasing.end(), x.begin(), x.end());
+    std::sort(increasing.begin(), increasing.end());
+
+    std::vector<Real> decreasing(increasing.rbegin(), increasing.rend());
+
+    std::vector<Real> shuffled(increasing);
+    for (Size i=0; i < shuffled.size(); ++i)
+        std::swap(shuffled[i], shuffled[(7*i + 3) % shuffled.size()]);
+
+    const std::vector<std::pair<std::string, Interpolation> > interpolations = {
+        { "linear", LinearInterpolation(x.begin(), x.end(), y.begin()) },
+        { "cubic", CubicNaturalSpline(x.begin(), x.end(), y.begin()) },
+        { "log-linear", LogLinearInterpolation(x.begin(), x.end(), y.begin()) },
+        { "backward-flat", BackwardFlatInterpolation(x.begin(), x.end(), y.begin()) },
+        { "forward-flat", ForwardFlatInterpolation(x.begin(), x.end(), y.begin()) }
+    };
+
+    // far jumps ahead of the hinted segment
+    const std::vector<Real> sparse = { 0.25, 0.75, 2.0, 2.5, 25.0, 29.5, 30.0, 31.0 };
+
+    const std::vector<std::pair<std::string, std::vector<Real> > > abscissae = {
+        { "increasing", increasing },
+        { "decreasing", decreasing },
+        { "shuffled", shuffled },
+        { "sparse", sparse }
+    };
+
+    for (const auto& interpolation : interpolations) {
+        const Interpolation& f = interpolation.second;
+        const bool hasPrimitive = (interpolation.first != "log-linear");
+
+        for (const auto& points : abscissae) {
+            std::vector<Real> bulkValues, bulkPrimitives;
+            f(points.second, bulkValues, true);
+            if (hasPrimitive)
+                f.primitive(points.second, bulkPrimitives, true);
+
+            Size valueHint = 0, primitiveHint = 0;
+            for (Size i=0; i < points.second.size(); ++i) {
+                const Real t = points.second[i];
+                const Real expected = f(t, true);
+                const Real hinted = f(t, valueHint, true);
+
+                if (hinted != expected || bulkValues[i] != expected)
+                    BOOST_ERROR("failed to reproduce " << interpolation.first
+                                << " interpolation value at "
+                                << points.second.size() << " "
+                                << points.first << " abscissae"
+                                << std::setprecision(16)
+                                << "\n    x         : " << t
+                                << "\n    expected  : " << expected
+                                << "\n    hinted    : " << hinted
+                                << "\n    bulk      : " << bulkValues[i]);
+
+                if (hasPrimitive) {
+                    const Real expectedPrimitive = f.primitive(t, true);
+                    const Real hintedPrimitive = f.primitive(t, primitiveHint, true);
+
+                    if (hintedPrimitive != expectedPrimitive
+                        || bulkPrimitives[i] != expectedPrimitive)
+                        BOOST_ERROR("failed to reproduce " << interpolation.first
+                                    << " interpolation primitive at "
+                                    << points.first << " abscissae"
+                                    << std::setprecision(16)
+                                    << "\n    x         : " << t
+                                    << "\n    expected  : " << expectedPrimitive
+                                    << "\n    hinted    : " << hintedPrimitive
+                                    << "\n    bulk      : " << bulkPrimitives[i]);
+                }
+            }
+        }
+    }
+}
+
+
+void InterpolationTest::testMultiChebyshevInterpolation() {
+    BOOST_TEST_MESSAGE("Testing tensor-product Chebyshev interpolation...");
+
+    // polynomials of lower degree than the number of nodes are exact
+    const auto polynomial = [](const Array& x) {
+        return 1.0 + 2.0*x[0] - x[0]*x[0]*x[1] + 0.5*x[1]*x[1]*x[1]*x[2]
+            + x[0]*x[0]*x[0]*x[2]*x[2];
+    };
+    const std::vector<Real> lower = { -1.0, 0.5, 2.0 };
+    const std::vector<Real> upper = { 2.0, 1.5, 4.0 };
+    const std::vector<Size> nodes = { 5, 4, 3 };
+
+    const MultiChebyshevInterpolation interpolation(
+        lower, upper, nodes, ext::function<Real(const Array&)>(polynomial));
+
+    const std::vector<Array> gridPoints =
+        MultiChebyshevInterpolation::gridPoints(lower, upper, nodes);
+    std::vector<Real> values(gridPoints.size());
+    for (Size i=0; i < gridPoints.size(); ++i)
+        values[i] = polynomial(gridPoints[i]);
+    const MultiChebyshevInterpolation fromValues(lower, upper, nodes, values);
+
+    const Real tol = 1e-10;
+    for (Real x0 = -1.0; x0 <= 2.0; x0 += 0.37)
+        for (Real x1 = 0.5; x1 <= 1.5; x1 += 0.23)
+            for (Real x2 = 2.0; x2 <= 4.0; x2 += 0.41) {
+                Array x(3);
+                x[0] = x0; x[1] = x1; x[2] = x2;
+
+                const Real expected[] = {
+                    polynomial(x),
+                    2.0 - 2.0*x0*x1 + 3.0*x0*x0*x2*x2,
+                    3.0*x1*x2 };
+                const Real calculated[] = {
+                    interpolation(x),
+                    interpolation.derivative(x, 0),
+                    interpolation.secondDerivative(x, 1) };
+
+                for (Size k=0; k < LENGTH(expected); ++k)
+                    if (std::fabs(calculated[k] - expected[k]) > tol)
+                        BOOST_FAIL("failed to reproduce polynomial"
+                                   << "\n    order:      " << k
+                                   << "\n    x:          " << x
+                                   << "\n    calculated: " << calculated[k]
+                                   << "\n    expected:   " << expected[k]);
+
+                if (std::fabs(fromValues(x) - expected[0]) > tol)
+                    BOOST_FAIL("failed to reproduce polynomial from samples"
+                               << "\n    x:          " << x
+                               << "\n    calculated: " << fromValues(x)
+                               << "\n    expected:   " << expected[0]);
+            }
+
+    // spectral convergence for smooth functions
+    const auto f = [](const Array& x) { return std::exp(x[0])*std::sin(x[1]); };
+    const MultiChebyshevInterpolation smooth(
+        {0.0, 0.0}, {1.0, 3.0}, {14, 20}, ext::function<Real(const Array&)>(f));
+
+    for (Real x0 = 0.0; x0 <= 1.0; x0 += 0.09)
+        for (Real x1 = 0.0; x1 <= 3.0; x1 += 0.13) {
+            Array x(2);
+            x[0] = x0; x[1] = x1;
+            const Real expectedDerivative = std::exp(x0)*std::cos(x1);
+            if (std::fabs(smooth(x) - f(x)) > 1e-12
+                || std::fabs(smooth.derivative(x, 1) - expectedDerivative) > 1e-9)
+                BOOST_FAIL("failed to interpolate smooth function"
+                           << "\n    x:          " << x
+                           << "\n    calculated: " << smooth(x)
+                           << "\n    expected:   " << f(x));
+        }
+
+    Array outside(2);
+    outside[0] = 1.1; outside[1] = 1.0;
+    BOOST_CHECK_THROW(smooth(outside), Error);
+    BOOST_CHECK_NO_THROW(smooth(outside, true));
+}
 
 test_suite* InterpolationTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Interpolation tests");
@@ -2546,6 +2788,7 @@ test_suite* InterpolationTest::suite(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testUnknownRichardsonExtrapolation));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testRichardsonExtrapolation));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testSabrSingleCases));
+    suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testSabrAnalyticJacobian));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testTransformations));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testLagrangeInterpolation));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testLagrangeInterpolationAtSupportPoint));
@@ -2556,6 +2799,8 @@ test_suite* InterpolationTest::suite(SpeedLevel speed) {
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testChebyshevInterpolation));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testChebyshevInterpolationOnNodes));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testChebyshevInterpolationUpdateY));
+    suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testHintedEvaluation));
+    suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testMultiChebyshevInterpolation));
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testNoArbSabrInterpolation));
     }
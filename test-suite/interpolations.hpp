@@ -54,6 +54,7 @@ class InterpolationTest {
     static void testRichardsonExtrapolation();
     static void testNoArbSabrInterpolation();
     static void testSabrSingleCases();
+    static void testSabrAnalyticJacobian();
     static void testFlochKennedySabrIsSmoothAroundATM();
     static void testLeFlochKennedySabrExample();
     static void testTransformations();
@@ -66,6 +67,8 @@ class InterpolationTest {
     static void testChebyshevInterpolation();
     static void testChebyshevInterpolationOnNodes();
     static void testChebyshevInterpolationUpdateY();
+    static void testHintedEvaluation();
+    static void testMultiChebyshevInterpolation();
 
 
     static boost::unit_test_framework::test_suite* suite(SpeedLevel);
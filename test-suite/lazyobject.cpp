@@ -20,7 +20,9 @@
 #include "lazyobject.hpp"
 #include "utilities.hpp"
 #include <ql/instruments/stock.hpp>
+#include <ql/patterns/lazyobjectprofiler.hpp>
 #include <ql/quotes/simplequote.hpp>
+#include <sstream>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -80,12 +82,101 @@ void LazyObjectTest::testForwardingNotifications() {
 }
 
 
+namespace {
+
+    class ChainedLazyObject : public LazyObject {
+      public:
+        explicit ChainedLazyObject(const ext::shared_ptr<Observable>& input,
+                                   ext::shared_ptr<ChainedLazyObject> next = {})
+        : next_(std::move(next)) {
+            registerWith(input);
+        }
+        void value() const { calculate(); }
+      private:
+        void performCalculations() const override {
+            if (next_ != nullptr)
+                next_->value();
+        }
+        ext::shared_ptr<ChainedLazyObject> next_;
+    };
+
+    class DisableProfiler {
+      public:
+        ~DisableProfiler() {
+            LazyObjectProfiler::instance().disable();
+            LazyObjectProfiler::instance().reset();
+        }
+    };
+
+}
+
+void LazyObjectTest::testProfiler() {
+
+    BOOST_TEST_MESSAGE("Testing the recalculation profiler...");
+
+    LazyObjectProfiler& profiler = LazyObjectProfiler::instance();
+
+    #if defined(QL_ENABLE_PROFILING)
+
+    DisableProfiler guard;
+    profiler.reset();
+    profiler.enable();
+
+    ext::shared_ptr<SimpleQuote> q(new SimpleQuote(0.0));
+    auto inner = ext::make_shared<ChainedLazyObject>(q);
+    auto outer = ext::make_shared<ChainedLazyObject>(inner, inner);
+    profiler.setLabel(inner.get(), "inner");
+    profiler.setLabel(outer.get(), "outer");
+
+    outer->value();
+    q->setValue(1.0);
+    q->setValue(2.0);
+    outer->value();
+    outer->value();
+
+    const std::vector<LazyObjectProfiler::Entry>& entries = profiler.entries();
+    BOOST_REQUIRE(entries.size() == 2);
+    for (const auto& entry : entries) {
+        if (entry.recalculations != 2 || entry.invalidations != 1)
+            BOOST_ERROR("unexpected profile for " << entry.label << ":"
+                        << "\n    recalculations: " << entry.recalculations
+                        << "\n    invalidations:  " << entry.invalidations
+                        << "\n    expected:       2 and 1");
+        if (entry.selfTime > entry.totalTime)
+            BOOST_ERROR("self time larger than total time for " << entry.label);
+    }
+
+    std::vector<LazyObjectProfiler::Edge> edges = profiler.edges();
+    BOOST_REQUIRE(edges.size() == 1);
+    if (entries[edges[0].inner].label != "inner"
+        || entries[edges[0].outer].label != "outer"
+        || edges[0].count != 2)
+        BOOST_ERROR("unexpected nesting edge recorded");
+
+    outer.reset();
+    if (entries[1].alive)
+        BOOST_ERROR("destroyed object still reported as alive");
+
+    std::ostringstream graph;
+    profiler.writeGraph(graph);
+    if (graph.str().find("n0 -> n1") == std::string::npos)
+        BOOST_ERROR("nesting edge missing from graph:\n" << graph.str());
+
+    #else
+
+    BOOST_CHECK_THROW(profiler.enable(), Error);
+
+    #endif
+}
+
+
 test_suite* LazyObjectTest::suite() {
     auto* suite = BOOST_TEST_SUITE("LazyObject tests");
     suite->add(
         QUANTLIB_TEST_CASE(&LazyObjectTest::testDiscardingNotifications));
     suite->add(
         QUANTLIB_TEST_CASE(&LazyObjectTest::testForwardingNotifications));
+    suite->add(QUANTLIB_TEST_CASE(&LazyObjectTest::testProfiler));
     return suite;
 }
 
@@ -29,6 +29,7 @@ class LazyObjectTest {
   public:
     static void testDiscardingNotifications();
     static void testForwardingNotifications();
+    static void testProfiler();
     static boost::unit_test_framework::test_suite* suite();
 };
 
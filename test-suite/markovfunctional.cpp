@@ -1678,12 +1678,92 @@ void MarkovFunctionalTest::testBermudanSwaption() {
     Settings::instance().evaluationDate() = savedEvalDate;
 }
 
+void MarkovFunctionalTest::testParallelCalibration() {
+
+    BOOST_TEST_MESSAGE("Testing parallel Markov functional calibration...");
+
+    Date savedEvalDate = Settings::instance().evaluationDate();
+    Date referenceDate(14, November, 2012);
+    Settings::instance().evaluationDate() = referenceDate;
+
+    Handle<YieldTermStructure> md0Yts_ = md0Yts();
+    Handle<SwaptionVolatilityStructure> md0SwaptionVts_ = md0SwaptionVts();
+
+    ext::shared_ptr<SwapIndex> swapIndexBase(
+        new EuriborSwapIsdaFixA(1 * Years));
+
+    std::vector<Date> volStepDates;
+    std::vector<Real> vols = {1.0};
+
+    MarkovFunctional::ModelSettings settings =
+        MarkovFunctional::ModelSettings()
+            .withYGridPoints(32)
+            .withYStdDevs(7.0)
+            .withGaussHermitePoints(16)
+            .withMarketRateAccuracy(1e-7)
+            .withDigitalGap(1e-5)
+            .withLowerRateBound(0.0)
+            .withUpperRateBound(2.0);
+
+    ext::shared_ptr<MarkovFunctional> serialModel(
+        new MarkovFunctional(md0Yts_, 0.01, volStepDates, vols, md0SwaptionVts_,
+                             expiriesCalBasket3(), tenorsCalBasket3(),
+                             swapIndexBase, settings));
+    ext::shared_ptr<MarkovFunctional> parallelModel(
+        new MarkovFunctional(md0Yts_, 0.01, volStepDates, vols, md0SwaptionVts_,
+                             expiriesCalBasket3(), tenorsCalBasket3(),
+                             swapIndexBase,
+                             MarkovFunctional::ModelSettings(settings)
+                                 .withParallelCalibration()));
+
+    // the market rates are found within the market rate accuracy in both
+    // calibrations, only the starting points of the searches differ
+
+    Real tol = 1E-6;
+
+    std::vector<Date> expiries = expiriesCalBasket3();
+    Array y = serialModel->yGrid(5.0, 8);
+    for (auto& expiry : expiries) {
+        for (Real yi : y) {
+            Real serialNumeraire = serialModel->numeraire(expiry, yi);
+            Real parallelNumeraire = parallelModel->numeraire(expiry, yi);
+            if (fabs(serialNumeraire - parallelNumeraire) > tol * serialNumeraire)
+                BOOST_ERROR("numeraire at " << expiry << ", y=" << yi
+                            << " from parallel calibration (" << parallelNumeraire
+                            << ") deviates from serial calibration ("
+                            << serialNumeraire << ")");
+        }
+    }
+
+    ext::shared_ptr<IborIndex> iborIndex(new Euribor(6 * Months, md0Yts_));
+    ext::shared_ptr<VanillaSwap> underlying =
+        MakeVanillaSwap(10 * Years, iborIndex, 0.03)
+            .withEffectiveDate(TARGET().advance(referenceDate, 2, Days));
+    Swaption bermudanSwaption(
+        underlying, ext::shared_ptr<Exercise>(new BermudanExercise(expiries)));
+
+    bermudanSwaption.setPricingEngine(ext::shared_ptr<PricingEngine>(
+        new Gaussian1dSwaptionEngine(serialModel, 64, 7.0)));
+    Real serialNpv = bermudanSwaption.NPV();
+    bermudanSwaption.setPricingEngine(ext::shared_ptr<PricingEngine>(
+        new Gaussian1dSwaptionEngine(parallelModel, 64, 7.0)));
+    Real parallelNpv = bermudanSwaption.NPV();
+
+    if (fabs(serialNpv - parallelNpv) > tol)
+        BOOST_ERROR("Bermudan swaption value from parallel calibration ("
+                    << parallelNpv << ") deviates from serial calibration ("
+                    << serialNpv << ")");
+
+    Settings::instance().evaluationDate() = savedEvalDate;
+}
+
 test_suite *MarkovFunctionalTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Markov functional model tests");
 
     suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testMfStateProcess));
     suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testKahaleSmileSection));
     suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testBermudanSwaption));
+    suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testParallelCalibration));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testCalibrationTwoInstrumentSets));
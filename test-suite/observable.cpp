@@ -398,6 +398,92 @@ void ObservableTest::testAddAndDeleteObserverDuringNotifyObservers() {
 }
 
 
+namespace {
+
+    class ForwardingCounter : public Observable, public Observer {
+      public:
+        ForwardingCounter() = default;
+        void update() override {
+            ++counter_;
+            notifyObservers();
+        }
+        Size counter() const { return counter_; }
+
+      private:
+        Size counter_ = 0;
+    };
+
+}
+
+void ObservableTest::testUpdateTransaction() {
+    BOOST_TEST_MESSAGE("Testing batched notifications in update transactions...");
+
+    // quotes -> (left, right) -> bottom -> leaf; a diamond so that
+    // the bottom node is reached along two paths
+    std::vector<ext::shared_ptr<SimpleQuote> > quotes;
+    const auto left = ext::make_shared<ForwardingCounter>();
+    const auto right = ext::make_shared<ForwardingCounter>();
+    const auto bottom = ext::make_shared<ForwardingCounter>();
+    UpdateCounter leaf;
+
+    for (Size i=0; i<10; ++i) {
+        quotes.push_back(ext::make_shared<SimpleQuote>(Real(i)));
+        left->registerWith(quotes.back());
+        right->registerWith(quotes.back());
+    }
+    bottom->registerWith(left);
+    bottom->registerWith(right);
+    leaf.registerWith(bottom);
+
+    for (const auto& q : quotes)
+        q->setValue(q->value() + 1.0);
+
+    if (left->counter() != 10 || bottom->counter() != 20 || leaf.counter() != 20)
+        BOOST_FAIL("unexpected number of updates without transaction:"
+                   << "\n    left:   " << left->counter()
+                   << "\n    bottom: " << bottom->counter()
+                   << "\n    leaf:   " << leaf.counter());
+
+    {
+        ObservableUpdateTransaction transaction;
+        for (const auto& q : quotes)
+            q->setValue(q->value() + 1.0);
+        {
+            ObservableUpdateTransaction nested;
+            quotes.front()->setValue(0.0);
+        }
+        if (left->counter() != 10 || leaf.counter() != 20)
+            BOOST_FAIL("observers updated before the transaction was committed");
+        transaction.commit();
+    }
+
+    if (left->counter() != 11 || right->counter() != 11
+        || bottom->counter() != 21 || leaf.counter() != 21)
+        BOOST_FAIL("observers not updated exactly once on commit:"
+                   << "\n    left:   " << left->counter()
+                   << "\n    right:  " << right->counter()
+                   << "\n    bottom: " << bottom->counter()
+                   << "\n    leaf:   " << leaf.counter());
+
+    // observers destroyed while the transaction is open are not updated
+    {
+        ObservableUpdateTransaction transaction;
+        auto transient = ext::make_shared<UpdateCounter>();
+        transient->registerWith(quotes.back());
+        quotes.back()->setValue(0.0);
+        transient.reset();
+    }
+
+    if (bottom->counter() != 22 || leaf.counter() != 22)
+        BOOST_FAIL("observers not updated exactly once on commit");
+
+    // notifications sent after the transaction are synchronous again
+    quotes.back()->setValue(1.0);
+    if (bottom->counter() != 24 || leaf.counter() != 24)
+        BOOST_FAIL("notifications still batched after the transaction");
+}
+
+
 test_suite* ObservableTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Observer tests");
 
@@ -413,6 +499,9 @@ test_suite* ObservableTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&ObservableTest::testEmptyObserverList));
     suite->add(QUANTLIB_TEST_CASE(
         &ObservableTest::testAddAndDeleteObserverDuringNotifyObservers));
+#ifndef QL_ENABLE_THREAD_SAFE_OBSERVER_PATTERN
+    suite->add(QUANTLIB_TEST_CASE(&ObservableTest::testUpdateTransaction));
+#endif
     return suite;
 }
 
@@ -25,6 +25,7 @@
 #include "utilities.hpp"
 #include <ql/math/optimization/simplex.hpp>
 #include <ql/math/optimization/levenbergmarquardt.hpp>
+#include <ql/math/optimization/sparselevenbergmarquardt.hpp>
 #include <ql/math/optimization/conjugategradient.hpp>
 #include <ql/math/optimization/steepestdescent.hpp>
 #include <ql/math/optimization/bfgs.hpp>
@@ -33,6 +34,8 @@
 #include <ql/math/randomnumbers/mt19937uniformrng.hpp>
 #include <ql/math/optimization/differentialevolution.hpp>
 #include <ql/math/optimization/goldstein.hpp>
+#include <ql/experimental/math/fireflyalgorithm.hpp>
+#include <ql/experimental/math/particleswarmoptimization.hpp>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -432,6 +435,23 @@ namespace {
             return fx - p + 1.0;
         }
     };
+
+    class ThreadSafeGriewangk : public Griewangk {
+      public:
+        bool isThreadSafe() const override { return true; }
+    };
+
+    class FailingAboveThreshold : public CostFunction {
+      public:
+        Array values(const Array& x) const override {
+            return Array(x.size(),value(x));
+        }
+        Real value(const Array& x) const override {
+            QL_REQUIRE(x[0] < 1.0, "argument out of range");
+            return x[0];
+        }
+        bool isThreadSafe() const override { return true; }
+    };
 }
 
 void OptimizersTest::testDifferentialEvolution() {
@@ -543,15 +563,197 @@ void OptimizersTest::testDifferentialEvolution() {
     }
 }
 
+void OptimizersTest::testParallelPopulationEvaluation() {
+    BOOST_TEST_MESSAGE("Testing parallel evaluation of optimizer populations...");
+
+    Griewangk serialCost;
+    ThreadSafeGriewangk parallelCost;
+    BoundaryConstraint constraint(-600.0, 600.0);
+    Array initialValue(5, 100.0);
+    EndCriteria endCriteria(200, 100, 1e-12, 1e-10, Null<Real>());
+
+    // Every run needs a freshly seeded optimizer, since the random
+    // generators carry their state across minimizations.
+    auto makeMethod = [](Size i) -> ext::shared_ptr<OptimizationMethod> {
+        switch (i) {
+          case 0:
+            return ext::make_shared<DifferentialEvolution>(
+                DifferentialEvolution::Configuration()
+                .withStepsizeWeight(0.4)
+                .withBounds()
+                .withCrossoverProbability(0.35)
+                .withPopulationMembers(100)
+                .withStrategy(DifferentialEvolution::BestMemberWithJitter)
+                .withSeed(3242));
+          case 1:
+            return ext::make_shared<ParticleSwarmOptimization>(
+                50, ext::make_shared<GlobalTopology>(),
+                ext::make_shared<TrivialInertia>(), 2.05, 2.05, 3242UL);
+          default:
+            return ext::make_shared<FireflyAlgorithm>(
+                50, ext::make_shared<ExponentialIntensity>(10.0, 1e-8, 1.0),
+                ext::make_shared<GaussianWalk>(2.5, 0.9, 3242), 10, 1.0, 0.5, 3242UL);
+        }
+    };
+
+    for (Size i = 0; i < 3; ++i) {
+        Problem serial(serialCost, constraint, initialValue);
+        makeMethod(i)->minimize(serial, endCriteria);
+
+        Problem parallel(parallelCost, constraint, initialValue);
+        makeMethod(i)->minimize(parallel, endCriteria);
+
+        if (serial.functionValue() != parallel.functionValue()
+            || serial.functionEvaluation() != parallel.functionEvaluation()) {
+            BOOST_ERROR("parallel evaluation changed the result of method #" << i
+                        << "\n    serial:   " << serial.functionValue()
+                        << " (" << serial.functionEvaluation() << " evaluations)"
+                        << "\n    parallel: " << parallel.functionValue()
+                        << " (" << parallel.functionEvaluation() << " evaluations)");
+        }
+        for (Size j = 0; j < initialValue.size(); ++j) {
+            if (serial.currentValue()[j] != parallel.currentValue()[j])
+                BOOST_ERROR("parallel evaluation changed the minimum of method #" << i
+                            << "\n    serial:   " << serial.currentValue()
+                            << "\n    parallel: " << parallel.currentValue());
+        }
+    }
+
+    // a second minimization with the same optimizer must start from
+    // a fresh population
+    for (Size i = 0; i < 3; ++i) {
+        const ext::shared_ptr<OptimizationMethod> method = makeMethod(i);
+        for (Size run = 0; run < 2; ++run) {
+            Problem problem(parallelCost, constraint, initialValue);
+            method->minimize(problem, endCriteria);
+
+            const Real expected = parallelCost.value(problem.currentValue());
+            if (std::fabs(problem.functionValue() - expected) > 1e-12
+                || problem.functionValue() > parallelCost.value(initialValue)) {
+                BOOST_ERROR("inconsistent result of run #" << run
+                            << " of method #" << i
+                            << "\n    function value: " << problem.functionValue()
+                            << "\n    value at minimum: " << expected);
+            }
+        }
+    }
+
+    FailingAboveThreshold failing;
+    NoConstraint noConstraint;
+    Problem problem(failing, noConstraint, Array(1, 0.0));
+    std::vector<Array> points = { Array(1, 0.5), Array(1, 2.0), Array(1, 0.25) };
+
+    std::vector<Real> values = problem.value(points, QL_MAX_REAL);
+    if (values[0] != 0.5 || values[1] != QL_MAX_REAL || values[2] != 0.25)
+        BOOST_ERROR("failed evaluations not replaced by the given value"
+                    << "\n    values: " << values[0] << ", " << values[1]
+                    << ", " << values[2]);
+    if (Size(problem.functionEvaluation()) != points.size())
+        BOOST_ERROR("wrong number of function evaluations: "
+                    << problem.functionEvaluation()
+                    << "\n    expected: " << points.size());
+
+    BOOST_CHECK_THROW(problem.value(points), Error);
+}
+
+namespace {
+
+    // chained Rosenbrock residuals, each depending on at most two
+    // neighbouring parameters
+    class ChainedRosenbrock : public SparseCostFunction {
+      public:
+        Real value(const Array& x) const override {
+            Array r = values(x);
+            return DotProduct(r, r);
+        }
+        Array values(const Array& x) const override {
+            Array r(2 * (x.size() - 1));
+            for (Size i = 0; i + 1 < x.size(); ++i) {
+                r[2 * i] = 10.0 * (x[i + 1] - x[i] * x[i]);
+                r[2 * i + 1] = 1.0 - x[i];
+            }
+            return r;
+        }
+        std::vector<std::vector<Size> > sparsityPattern(const Array& x) const override {
+            std::vector<std::vector<Size> > pattern;
+            for (Size i = 0; i + 1 < x.size(); ++i) {
+                pattern.push_back({i, i + 1});
+                pattern.push_back({i});
+            }
+            return pattern;
+        }
+        void sparseJacobian(SparseMatrix& jac, const Array& x) const override {
+            for (Size i = 0; i + 1 < x.size(); ++i) {
+                jac(2 * i, i) = -20.0 * x[i];
+                jac(2 * i, i + 1) = 10.0;
+                jac(2 * i + 1, i) = -1.0;
+            }
+        }
+    };
+
+}
+
+void OptimizersTest::testSparseLevenbergMarquardt() {
+    BOOST_TEST_MESSAGE("Testing Levenberg-Marquardt with sparse jacobians...");
+
+    ChainedRosenbrock cost;
+    NoConstraint constraint;
+    Array initialValue(20, -1.2);
+    EndCriteria endCriteria(1000, 100, 1e-12, 1e-12, 1e-12);
+    const Real tolerance = 1e-6;
+
+    Problem dense(cost, constraint, initialValue);
+    LevenbergMarquardt(1e-12, 1e-12, 1e-12).minimize(dense, endCriteria);
+
+    struct Variant {
+        const char* name;
+        bool analytic;
+        Size broydenUpdates;
+        bool geodesic;
+    };
+    Variant variants[] = { { "finite differences", false, 0, false },
+                           { "analytic jacobian", true, 0, false },
+                           { "Broyden updates", false, 5, false },
+                           { "geodesic acceleration", false, 0, true } };
+
+    for (const auto& v : variants) {
+        SparseLevenbergMarquardt method(1e-8, v.analytic, v.broydenUpdates, v.geodesic);
+        Problem problem(cost, constraint, initialValue);
+        method.minimize(problem, endCriteria);
+
+        for (Size j = 0; j < initialValue.size(); ++j) {
+            if (std::fabs(problem.currentValue()[j] - 1.0) > tolerance)
+                BOOST_ERROR("failed to minimize with " << v.name
+                            << "\n    minimum:  " << problem.currentValue()
+                            << "\n    expected: 1.0 in each component");
+        }
+        if (problem.functionEvaluation() >= dense.functionEvaluation())
+            BOOST_ERROR("no evaluations saved with " << v.name
+                        << "\n    sparse: " << problem.functionEvaluation()
+                        << "\n    dense:  " << dense.functionEvaluation());
+        if (Size(problem.functionEvaluation()) != method.functionEvaluations())
+            BOOST_ERROR("wrong number of function evaluations with " << v.name
+                        << "\n    problem:   " << problem.functionEvaluation()
+                        << "\n    optimizer: " << method.functionEvaluations());
+        if (v.broydenUpdates > 0 && method.broydenUpdates() == 0)
+            BOOST_ERROR("no Broyden updates performed");
+        if (v.geodesic && method.acceleratedSteps() == 0)
+            BOOST_ERROR("no accelerated steps taken");
+    }
+}
+
 test_suite* OptimizersTest::suite(SpeedLevel speed) {
     auto* suite = BOOST_TEST_SUITE("Optimizers tests");
 
     suite->add(QUANTLIB_TEST_CASE(&OptimizersTest::test));
     suite->add(QUANTLIB_TEST_CASE(&OptimizersTest::nestedOptimizationTest));
+    suite->add(QUANTLIB_TEST_CASE(&OptimizersTest::testSparseLevenbergMarquardt));
 
     if (speed <= Fast) {
         suite->add(QUANTLIB_TEST_CASE(
             &OptimizersTest::testDifferentialEvolution));
+        suite->add(QUANTLIB_TEST_CASE(
+            &OptimizersTest::testParallelPopulationEvaluation));
     }
 
     return suite;
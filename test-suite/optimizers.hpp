@@ -30,6 +30,8 @@ class OptimizersTest {
     static void test();
     static void nestedOptimizationTest();
     static void testDifferentialEvolution();
+    static void testParallelPopulationEvaluation();
+    static void testSparseLevenbergMarquardt();
     static boost::unit_test_framework::test_suite* suite(SpeedLevel);
 };
 
@@ -21,6 +21,7 @@
 #include "utilities.hpp"
 #include <ql/cashflows/iborcoupon.hpp>
 #include <ql/indexes/bmaindex.hpp>
+#include <ql/indexes/ibor/estr.hpp>
 #include <ql/indexes/ibor/euribor.hpp>
 #include <ql/indexes/ibor/jpylibor.hpp>
 #include <ql/indexes/ibor/usdlibor.hpp>
@@ -33,12 +34,15 @@
 #include <ql/math/interpolations/cubicinterpolation.hpp>
 #include <ql/math/interpolations/linearinterpolation.hpp>
 #include <ql/math/interpolations/loginterpolation.hpp>
+#include <ql/math/optimization/sparselevenbergmarquardt.hpp>
 #include <ql/pricingengines/bond/discountingbondengine.hpp>
 #include <ql/pricingengines/swap/discountingswapengine.hpp>
 #include <ql/quotes/simplequote.hpp>
 #include <ql/termstructures/globalbootstrap.hpp>
+#include <ql/termstructures/yield/curvebootstrapscheduler.hpp>
 #include <ql/termstructures/yield/bondhelpers.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
+#include <ql/termstructures/yield/oisratehelper.hpp>
 #include <ql/termstructures/yield/piecewiseyieldcurve.hpp>
 #include <ql/termstructures/yield/ratehelpers.hpp>
 #include <ql/time/asx.hpp>
@@ -1320,6 +1324,21 @@ void PiecewiseYieldCurveTest::testGlobalBootstrap() {
         QL_CHECK_SMALL(std::fabs(refZeroRate[i] - curve->zeroRate(refDate[i], Actual360(), Continuous).rate()),
                           1E-6);
     }
+
+    // the same curve, minimized with an explicitly given optimizer
+    ext::shared_ptr<Curve> explicitOptimizerCurve = ext::make_shared<Curve>(
+        2, TARGET(), helpers, Actual365Fixed(), std::vector<Handle<Quote> >(), std::vector<Date>(),
+        Linear(),
+        Curve::bootstrap_type(additionalHelpers, additionalDates(),
+                              additionalErrors(additionalHelpers), 1.0e-12,
+                              ext::make_shared<SparseLevenbergMarquardt>(),
+                              ext::make_shared<EndCriteria>(1000, 10, 1.0e-12, 1.0e-12, 1.0e-12)));
+    explicitOptimizerCurve->enableExtrapolation();
+
+    for (Size i = 0; i < LENGTH(refZeroRate); ++i) {
+        QL_CHECK_SMALL(std::fabs(refZeroRate[i] - explicitOptimizerCurve->zeroRate(refDate[i], Actual360(), Continuous).rate()),
+                          1E-6);
+    }
 }
 
 /* This test attempts to build an ARS collateralised in USD curve as of 25 Sep 2019. Using the default 
@@ -1431,6 +1450,156 @@ void PiecewiseYieldCurveTest::testIterativeBootstrapRetries() {
     QL_CHECK_SMALL(calcFwd - expFwd, 1e-10);
 }
 
+void PiecewiseYieldCurveTest::testBootstrapScheduler() {
+    BOOST_TEST_MESSAGE("Testing scheduled bootstrap of interdependent curves...");
+
+    SavedSettings backup;
+
+    Date today(16, March, 2023);
+    Settings::instance().evaluationDate() = today;
+
+    Calendar calendar = TARGET();
+    DayCounter dayCounter = Actual365Fixed();
+    std::vector<Period> tenors = { 1*Years, 2*Years, 3*Years, 5*Years, 10*Years };
+    std::vector<Rate> rates = { 0.030, 0.031, 0.032, 0.033, 0.035 };
+
+    typedef PiecewiseYieldCurve<Discount, LogLinear> Curve;
+    typedef std::vector<ext::shared_ptr<RateHelper> > Helpers;
+
+    auto oisHelpers = [&](Spread shift) {
+        auto index = ext::make_shared<Estr>();
+        Helpers helpers;
+        for (Size i=0; i<tenors.size(); ++i)
+            helpers.push_back(ext::make_shared<OISRateHelper>(
+                2, tenors[i], Handle<Quote>(ext::make_shared<SimpleQuote>(rates[i] + shift)), index));
+        return helpers;
+    };
+
+    auto swapHelpers = [&](Spread shift,
+                           const ext::shared_ptr<IborIndex>& index,
+                           const Handle<YieldTermStructure>& discountCurve) {
+        Helpers helpers;
+        for (Size i=0; i<tenors.size(); ++i)
+            helpers.push_back(ext::make_shared<SwapRateHelper>(
+                Handle<Quote>(ext::make_shared<SimpleQuote>(rates[i] + shift)), tenors[i], calendar,
+                Annual, Unadjusted, Thirty360(Thirty360::BondBasis),
+                index, Handle<Quote>(), 0*Days, discountCurve));
+        return helpers;
+    };
+
+    // builds an OIS curve, a 6M curve discounted on it, a 3M curve
+    // discounted on the 6M one, and an unrelated OIS curve
+    struct Setup {
+        std::vector<ext::shared_ptr<Curve> > curves;
+        std::vector<Helpers> helpers;
+    };
+    auto setup = [&]() {
+        Setup s;
+        s.helpers.push_back(oisHelpers(0.0));
+        s.curves.push_back(ext::make_shared<Curve>(today, s.helpers.back(), dayCounter));
+        Handle<YieldTermStructure> ois(s.curves.back());
+
+        s.helpers.push_back(swapHelpers(0.002, ext::make_shared<Euribor6M>(), ois));
+        s.curves.push_back(ext::make_shared<Curve>(today, s.helpers.back(), dayCounter));
+        Handle<YieldTermStructure> euribor6m(s.curves.back());
+
+        s.helpers.push_back(swapHelpers(0.001, ext::make_shared<Euribor3M>(), euribor6m));
+        s.curves.push_back(ext::make_shared<Curve>(today, s.helpers.back(), dayCounter));
+
+        s.helpers.push_back(oisHelpers(-0.005));
+        s.curves.push_back(ext::make_shared<Curve>(today, s.helpers.back(), dayCounter));
+        return s;
+    };
+
+    Setup scheduled = setup();
+    CurveBootstrapScheduler scheduler;
+    // added in reverse order; the scheduler sorts them out
+    for (Size i=scheduled.curves.size(); i>0; --i)
+        scheduler.add(scheduled.curves[i-1], scheduled.helpers[i-1]);
+
+    // positions in the scheduler: other OIS is 0, 3M is 1, 6M is 2, OIS is 3
+    std::vector<std::vector<Size> > expectedLevels = { { 0, 3 }, { 2 }, { 1 } };
+    if (scheduler.levels() != expectedLevels)
+        BOOST_ERROR("unexpected bootstrap levels");
+    if (!scheduler.dependencies(0).empty() ||
+        scheduler.dependencies(1) != std::vector<Size>(1, 2) ||
+        scheduler.dependencies(2) != std::vector<Size>(1, 3) ||
+        !scheduler.dependencies(3).empty())
+        BOOST_ERROR("unexpected curve dependencies");
+
+    BOOST_CHECK_THROW(scheduler.add(scheduled.curves[0], Helpers()), Error);
+    BOOST_CHECK_THROW(scheduler.add(ext::make_shared<FlatForward>(today, 0.01, dayCounter),
+                                    Helpers(1, scheduled.helpers[0][0])),
+                      Error);
+
+    scheduler.bootstrap();
+
+    // the same curves, bootstrapped lazily on first access
+    Setup lazy = setup();
+    for (Size i=0; i<lazy.curves.size(); ++i) {
+        for (const auto& h : scheduled.helpers[i]) {
+            Date d = h->pillarDate();
+            Real expected = lazy.curves[i]->discount(d);
+            Real calculated = scheduled.curves[i]->discount(d);
+            if (std::fabs(expected - calculated) > 1.0e-14)
+                BOOST_ERROR("curve #" << i << " bootstrapped with scheduler "
+                            "differs from lazy bootstrap at " << d << ":"
+                            << std::scientific << std::setprecision(12)
+                            << "\n    scheduled: " << calculated
+                            << "\n    lazy:      " << expected);
+        }
+    }
+
+    // two curves in the same level discounted on a shared OIS curve
+    // outside the schedule, which must be calculated beforehand
+    auto sharedSetup = [&]() {
+        Setup s;
+        s.helpers.push_back(oisHelpers(0.0));
+        s.curves.push_back(ext::make_shared<Curve>(today, s.helpers.back(), dayCounter));
+        Handle<YieldTermStructure> ois(s.curves.back());
+
+        s.helpers.push_back(swapHelpers(0.002, ext::make_shared<Euribor6M>(), ois));
+        s.curves.push_back(ext::make_shared<Curve>(today, s.helpers.back(), dayCounter));
+        s.helpers.push_back(swapHelpers(0.001, ext::make_shared<Euribor3M>(), ois));
+        s.curves.push_back(ext::make_shared<Curve>(today, s.helpers.back(), dayCounter));
+        return s;
+    };
+
+    Setup shared = sharedSetup();
+    CurveBootstrapScheduler sharedScheduler;
+    sharedScheduler.add(shared.curves[1], shared.helpers[1]);
+    sharedScheduler.add(shared.curves[2], shared.helpers[2]);
+
+    if (sharedScheduler.levels() != std::vector<std::vector<Size> >(1, { 0, 1 }))
+        BOOST_ERROR("unexpected bootstrap levels with shared discount curve");
+    for (Size i=0; i<2; ++i) {
+        const std::vector<ext::shared_ptr<LazyObject> >& unscheduled =
+            sharedScheduler.unscheduledDependencies(i);
+        if (std::find(unscheduled.begin(), unscheduled.end(),
+                      ext::dynamic_pointer_cast<LazyObject>(shared.curves[0]))
+            == unscheduled.end())
+            BOOST_ERROR("shared discount curve not found among the "
+                        "unscheduled dependencies of curve #" << i);
+    }
+
+    sharedScheduler.bootstrap();
+
+    Setup sharedLazy = sharedSetup();
+    for (Size i=0; i<sharedLazy.curves.size(); ++i) {
+        for (const auto& h : shared.helpers[i]) {
+            Date d = h->pillarDate();
+            Real expected = sharedLazy.curves[i]->discount(d);
+            Real calculated = shared.curves[i]->discount(d);
+            if (std::fabs(expected - calculated) > 1.0e-14)
+                BOOST_ERROR("curve #" << i << " bootstrapped with shared "
+                            "discount curve differs from lazy bootstrap at " << d << ":"
+                            << std::scientific << std::setprecision(12)
+                            << "\n    scheduled: " << calculated
+                            << "\n    lazy:      " << expected);
+        }
+    }
+}
+
 test_suite* PiecewiseYieldCurveTest::suite() {
 
     auto* suite = BOOST_TEST_SUITE("Piecewise yield curve tests");
@@ -1484,6 +1653,7 @@ test_suite* PiecewiseYieldCurveTest::suite() {
     }
 
     suite->add(QUANTLIB_TEST_CASE(&PiecewiseYieldCurveTest::testIterativeBootstrapRetries));
+    suite->add(QUANTLIB_TEST_CASE(&PiecewiseYieldCurveTest::testBootstrapScheduler));
 
     return suite;
 }
@@ -57,6 +57,7 @@ class PiecewiseYieldCurveTest {
     static void testGlobalBootstrap();
 
     static void testIterativeBootstrapRetries();
+    static void testBootstrapScheduler();
 
     static boost::unit_test_framework::test_suite* suite();
 };
@@ -24,6 +24,7 @@
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/time/calendars/nullcalendar.hpp>
 #include <ql/time/daycounters/thirty360.hpp>
+#include <ql/time/daycounters/actual360.hpp>
 #include <ql/time/daycounters/actual365fixed.hpp>
 #include <ql/time/daycounters/simpledaycounter.hpp>
 #include <ql/time/schedule.hpp>
@@ -34,6 +35,7 @@
 #include <ql/utilities/dataformatters.hpp>
 #include <ql/cashflows/cashflows.hpp>
 #include <ql/cashflows/couponpricer.hpp>
+#include <ql/cashflows/staticleg.hpp>
 #include <ql/currencies/europe.hpp>
 
 using namespace QuantLib;
@@ -343,6 +345,87 @@ void SwapTest::testThirdWednesdayAdjustment() {
     }
 }
 
+void SwapTest::testStaticLegConsistency() {
+
+    BOOST_TEST_MESSAGE("Testing static-leg pricing against cash-flow analysis...");
+
+    using namespace swap_test;
+
+    CommonVars vars;
+    IndexHistoryCleaner cleaner;
+
+    ext::shared_ptr<VanillaSwap> swap = vars.makeSwap(10, 0.05, 0.002);
+    Real tolerance = 1.0e-12;
+
+    auto check = [&](const std::string& scenario) {
+        Date refDate = vars.termStructure->referenceDate();
+        for (Size j=0; j<swap->numberOfLegs(); ++j) {
+            Real sign = swap->payer(j) ? -1.0 : 1.0;
+            Real npv, bps;
+            std::tie(npv, bps) =
+                CashFlows::npvbps(swap->leg(j), **vars.termStructure,
+                                  Settings::instance().includeReferenceDateEvents(),
+                                  refDate, refDate);
+            if (std::fabs(swap->legNPV(j) - sign*npv) > tolerance ||
+                std::fabs(swap->legBPS(j) - sign*bps) > tolerance)
+                BOOST_ERROR("leg #" << j << " mismatch (" << scenario << "):"
+                            << std::scientific << std::setprecision(12)
+                            << "\n    static NPV:    " << swap->legNPV(j)
+                            << "\n    expected NPV:  " << sign*npv
+                            << "\n    static BPS:    " << swap->legBPS(j)
+                            << "\n    expected BPS:  " << sign*bps);
+        }
+    };
+
+    StaticLeg floatingLeg(swap->floatingLeg());
+    if (floatingLeg.forecastCoupons() != swap->floatingLeg().size())
+        BOOST_ERROR("unexpected number of forecast coupons:"
+                    << "\n    calculated: " << floatingLeg.forecastCoupons()
+                    << "\n    expected:   " << swap->floatingLeg().size());
+
+    check("initial curve");
+
+    // alternating curves with different day counters replace the cached times
+    const ext::shared_ptr<YieldTermStructure> curves[] = {
+        flatRate(vars.settlement, 0.03, Actual365Fixed()),
+        flatRate(vars.settlement, 0.03, Actual360()) };
+    for (Size k=0; k<4; ++k) {
+        const YieldTermStructure& curve = *curves[k % 2];
+        Real npv = floatingLeg.npv(curve, false, vars.settlement);
+        Real expected = CashFlows::npv(swap->floatingLeg(), curve, false,
+                                       vars.settlement);
+        if (std::fabs(npv - expected) > tolerance)
+            BOOST_ERROR("static leg mismatch with curve #" << k % 2 << ":"
+                        << std::scientific << std::setprecision(12)
+                        << "\n    static NPV:    " << npv
+                        << "\n    expected NPV:  " << expected);
+    }
+
+    vars.termStructure.linkTo(curves[0]);
+    check("relinked curve");
+
+    // move past the first fixings, which are then taken from the index
+    Date later = vars.calendar.advance(vars.today, 15, Months);
+    for (const auto& cf : swap->floatingLeg()) {
+        auto coupon = ext::dynamic_pointer_cast<IborCoupon>(cf);
+        if (coupon->fixingDate() <= later)
+            vars.index->addFixing(coupon->fixingDate(), 0.04);
+    }
+    Settings::instance().evaluationDate() = later;
+    check("seasoned swap");
+
+    // a convexity-adjusted pricer must not be bypassed
+    Handle<OptionletVolatilityStructure> vol(
+        ext::make_shared<ConstantOptionletVolatility>(
+            later, vars.calendar, Following, 0.20, Actual365Fixed()));
+    setCouponPricer(swap->floatingLeg(),
+                    ext::make_shared<BlackIborCouponPricer>(
+                        vol, BlackIborCouponPricer::BivariateLognormal));
+    if (floatingLeg.isCurrentFor(swap->floatingLeg()))
+        BOOST_ERROR("static leg not invalidated by new coupon pricer");
+    check("bivariate-lognormal pricer");
+}
+
 test_suite* SwapTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Swap tests");
     suite->add(QUANTLIB_TEST_CASE(&SwapTest::testFairRate));
@@ -352,6 +435,7 @@ test_suite* SwapTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&SwapTest::testInArrears));
     suite->add(QUANTLIB_TEST_CASE(&SwapTest::testCachedValue));
     suite->add(QUANTLIB_TEST_CASE(&SwapTest::testThirdWednesdayAdjustment));
+    suite->add(QUANTLIB_TEST_CASE(&SwapTest::testStaticLegConsistency));
     return suite;
 }
 
@@ -34,6 +34,7 @@ class SwapTest {
     static void testInArrears();
     static void testCachedValue();
     static void testThirdWednesdayAdjustment();
+    static void testStaticLegConsistency();
     static boost::unit_test_framework::test_suite* suite();
 };
 
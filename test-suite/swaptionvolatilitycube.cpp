@@ -586,6 +586,175 @@ void SwaptionVolatilityCubeTest::testSabrParameters() {
 }
 
 
+void SwaptionVolatilityCubeTest::testParallelCalibration() {
+    BOOST_TEST_MESSAGE("Testing parallel calibration of SABR swaption cube...");
+
+    using namespace swaption_volatility_cube_test;
+
+    CommonVars vars;
+
+    std::vector<std::vector<Handle<Quote> > >
+        parametersGuess(vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size());
+    for (auto& guess : parametersGuess) {
+        guess = std::vector<Handle<Quote> >(4);
+        guess[0] = Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.2)));
+        guess[1] = Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.5)));
+        guess[2] = Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.4)));
+        guess[3] = Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.0)));
+    }
+    std::vector<bool> isParameterFixed(4, false);
+
+    SwaptionVolCube1 serialCube(vars.atmVolMatrix,
+                                vars.cube.tenors.options,
+                                vars.cube.tenors.swaps,
+                                vars.cube.strikeSpreads,
+                                vars.cube.volSpreadsHandle,
+                                vars.swapIndexBase,
+                                vars.shortSwapIndexBase,
+                                vars.vegaWeighedSmileFit,
+                                parametersGuess,
+                                isParameterFixed,
+                                true);
+    SwaptionVolCube1 parallelCube(vars.atmVolMatrix,
+                                  vars.cube.tenors.options,
+                                  vars.cube.tenors.swaps,
+                                  vars.cube.strikeSpreads,
+                                  vars.cube.volSpreadsHandle,
+                                  vars.swapIndexBase,
+                                  vars.shortSwapIndexBase,
+                                  vars.vegaWeighedSmileFit,
+                                  parametersGuess,
+                                  isParameterFixed,
+                                  true);
+    parallelCube.enableParallelCalibration();
+
+    Matrix serial = serialCube.denseSabrParameters();
+    Matrix parallel = parallelCube.denseSabrParameters();
+    for (Size i=0; i<serial.rows(); ++i) {
+        for (Size j=0; j<serial.columns(); ++j) {
+            if (serial[i][j] != parallel[i][j])
+                BOOST_ERROR("parallel calibration gives different SABR parameters"
+                            << "\n    row:      " << i
+                            << "\n    column:   " << j
+                            << "\n    serial:   " << serial[i][j]
+                            << "\n    parallel: " << parallel[i][j]);
+        }
+    }
+
+    BOOST_CHECK_THROW(
+        SwaptionVolCube1(vars.atmVolMatrix,
+                         vars.cube.tenors.options,
+                         vars.cube.tenors.swaps,
+                         vars.cube.strikeSpreads,
+                         vars.cube.volSpreadsHandle,
+                         vars.swapIndexBase,
+                         vars.shortSwapIndexBase,
+                         vars.vegaWeighedSmileFit,
+                         parametersGuess,
+                         isParameterFixed,
+                         true,
+                         ext::shared_ptr<EndCriteria>(),
+                         Null<Real>(),
+                         ext::make_shared<LevenbergMarquardt>())
+        .enableParallelCalibration(),
+        Error);
+}
+void SwaptionVolatilityCubeTest::testSmileSectionCache() {
+    BOOST_TEST_MESSAGE("Testing smile-section cache of swaption cubes...");
+
+    using namespace swaption_volatility_cube_test;
+
+    CommonVars vars;
+
+    SwaptionVolCube2 cachedCube(vars.atmVolMatrix,
+                                vars.cube.tenors.options,
+                                vars.cube.tenors.swaps,
+                                vars.cube.strikeSpreads,
+                                vars.cube.volSpreadsHandle,
+                                vars.swapIndexBase,
+                                vars.shortSwapIndexBase,
+                                vars.vegaWeighedSmileFit);
+    SwaptionVolCube2 uncachedCube(vars.atmVolMatrix,
+                                  vars.cube.tenors.options,
+                                  vars.cube.tenors.swaps,
+                                  vars.cube.strikeSpreads,
+                                  vars.cube.volSpreadsHandle,
+                                  vars.swapIndexBase,
+                                  vars.shortSwapIndexBase,
+                                  vars.vegaWeighedSmileFit);
+    uncachedCube.setSmileSectionCacheSize(0);
+
+    const Period optionTenor(7, Years), swapTenor(15, Years);
+    const Rate strike = 0.035;
+
+    const ext::shared_ptr<SmileSection> smile
+        = cachedCube.smileSection(optionTenor, swapTenor);
+    if (cachedCube.smileSection(optionTenor, swapTenor) != smile)
+        BOOST_ERROR("smile section not taken from the cache");
+    if (uncachedCube.smileSection(optionTenor, swapTenor)
+        == uncachedCube.smileSection(optionTenor, swapTenor))
+        BOOST_ERROR("smile section cached although the cache is disabled");
+
+    // the cache must be emptied when a quote changes
+    const ext::shared_ptr<SimpleQuote> quote
+        = ext::dynamic_pointer_cast<SimpleQuote>(
+            vars.cube.volSpreadsHandle[4][0].currentLink());
+    quote->setValue(quote->value() + 0.01);
+
+    const ext::shared_ptr<SmileSection> updatedSmile
+        = cachedCube.smileSection(optionTenor, swapTenor);
+    if (updatedSmile == smile)
+        BOOST_ERROR("outdated smile section taken from the cache");
+
+    const Volatility cached = cachedCube.volatility(optionTenor, swapTenor, strike);
+    const Volatility uncached = uncachedCube.volatility(optionTenor, swapTenor, strike);
+    if (cached != uncached)
+        BOOST_ERROR("cached smile section gives different volatility"
+                    << "\n    cached:   " << cached
+                    << "\n    uncached: " << uncached);
+    if (updatedSmile->volatility(strike) == smile->volatility(strike))
+        BOOST_ERROR("quote change not reflected in the smile section");
+
+    // SABR smile sections are cached as well and dropped on recalibration
+    std::vector<std::vector<Handle<Quote> > >
+        parametersGuess(vars.cube.tenors.options.size()*vars.cube.tenors.swaps.size());
+    for (auto& guess : parametersGuess) {
+        guess = std::vector<Handle<Quote> >(4);
+        guess[0] = Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.2)));
+        guess[1] = Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.5)));
+        guess[2] = Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.4)));
+        guess[3] = Handle<Quote>(ext::shared_ptr<Quote>(new SimpleQuote(0.0)));
+    }
+    std::vector<bool> isParameterFixed(4, false);
+    isParameterFixed[1] = true;
+
+    SwaptionVolCube1 sabrCube(vars.atmVolMatrix,
+                              vars.cube.tenors.options,
+                              vars.cube.tenors.swaps,
+                              vars.cube.strikeSpreads,
+                              vars.cube.volSpreadsHandle,
+                              vars.swapIndexBase,
+                              vars.shortSwapIndexBase,
+                              vars.vegaWeighedSmileFit,
+                              parametersGuess,
+                              isParameterFixed,
+                              true);
+
+    // the cube hides the inherited smileSection overloads
+    const SwaptionVolatilityStructure& sabrVol = sabrCube;
+
+    const ext::shared_ptr<SmileSection> sabrSmile
+        = sabrVol.smileSection(optionTenor, swapTenor);
+    if (sabrVol.smileSection(optionTenor, swapTenor) != sabrSmile)
+        BOOST_ERROR("SABR smile section not taken from the cache");
+
+    sabrCube.recalibration(0.7, vars.cube.tenors.swaps[1]);
+    if (sabrVol.smileSection(optionTenor, swapTenor) == sabrSmile)
+        BOOST_ERROR("outdated SABR smile section taken from the cache "
+                    "after recalibration");
+}
+
+
 test_suite* SwaptionVolatilityCubeTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Swaption Volatility Cube tests");
 
@@ -601,6 +770,8 @@ test_suite* SwaptionVolatilityCubeTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testSpreadedCube));
     suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testObservability));
     suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testSabrParameters));
+    suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testParallelCalibration));
+    suite->add(QUANTLIB_TEST_CASE(&SwaptionVolatilityCubeTest::testSmileSectionCache));
 
 
     return suite;
@@ -35,6 +35,8 @@ class SwaptionVolatilityCubeTest {
     static void testSpreadedCube();
     static void testObservability();
     static void testSabrParameters();
+    static void testParallelCalibration();
+    static void testSmileSectionCache();
 
     static boost::unit_test_framework::test_suite* suite();
 };
@@ -20,6 +20,13 @@
 #include "termstructures.hpp"
 #include "utilities.hpp"
 #include <ql/termstructures/yield/compositezeroyieldstructure.hpp>
+#include <ql/termstructures/yield/discountcurve.hpp>
+#include <ql/termstructures/yield/forwardcurve.hpp>
+#include <ql/termstructures/yield/zerocurve.hpp>
+#include <ql/math/interpolations/backwardflatinterpolation.hpp>
+#include <ql/math/interpolations/cubicinterpolation.hpp>
+#include <ql/math/interpolations/forwardflatinterpolation.hpp>
+#include <ql/quotes/simplequote.hpp>
 #include <ql/termstructures/yield/ratehelpers.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/yield/piecewiseyieldcurve.hpp>
@@ -420,6 +427,109 @@ void TermStructureTest::testCompositeZeroYieldStructures() {
     }
 }
 
+namespace term_structures_test {
+
+    void checkBulkQueries(const std::string& name,
+                          const YieldTermStructure& curve,
+                          const std::vector<Time>& times) {
+        Real tolerance = 1.0e-12;
+
+        std::vector<DiscountFactor> discounts;
+        curve.discount(times, discounts, true);
+        std::vector<Rate> zeros;
+        curve.zeroRate(times, zeros, Compounded, Semiannual, true);
+        std::vector<Time> starts(times.size()), ends(times.size());
+        for (Size i=0; i<times.size(); ++i) {
+            starts[i] = times[i];
+            // a few instantaneous forwards as well
+            ends[i] = (i % 5 == 0) ? times[i] : times[i] + 0.25;
+        }
+        std::vector<Rate> forwards;
+        curve.forwardRate(starts, ends, forwards, Simple, Annual, true);
+
+        for (Size i=0; i<times.size(); ++i) {
+            DiscountFactor d = curve.discount(times[i], true);
+            if (std::fabs(discounts[i] - d) > tolerance)
+                BOOST_ERROR(name << ": bulk discount mismatch at t = "
+                            << times[i] << std::setprecision(14)
+                            << "\n    bulk:   " << discounts[i]
+                            << "\n    scalar: " << d);
+            Rate z = curve.zeroRate(times[i], Compounded, Semiannual, true);
+            if (std::fabs(zeros[i] - z) > tolerance)
+                BOOST_ERROR(name << ": bulk zero rate mismatch at t = "
+                            << times[i] << std::setprecision(14)
+                            << "\n    bulk:   " << zeros[i]
+                            << "\n    scalar: " << z);
+            Rate f = curve.forwardRate(starts[i], ends[i], Simple, Annual, true);
+            // instantaneous forwards are finite differences of discounts
+            // over a very short period, which magnifies rounding errors
+            Real forwardTolerance = starts[i] == ends[i] ? 1.0e-10 : tolerance;
+            if (std::fabs(forwards[i] - f) > forwardTolerance)
+                BOOST_ERROR(name << ": bulk forward rate mismatch between t = "
+                            << starts[i] << " and t = " << ends[i]
+                            << std::setprecision(14)
+                            << "\n    bulk:   " << forwards[i]
+                            << "\n    scalar: " << f);
+        }
+    }
+
+}
+
+void TermStructureTest::testBulkQueries() {
+    BOOST_TEST_MESSAGE("Testing bulk queries on yield term structures...");
+
+    using namespace term_structures_test;
+
+    CommonVars vars;
+
+    Date today = Settings::instance().evaluationDate();
+    std::vector<Date> dates = {today, today + 1*Years, today + 2*Years,
+                               today + 5*Years, today + 10*Years, today + 30*Years};
+    std::vector<Rate> rates = {0.010, 0.012, 0.018, 0.025, 0.030, 0.028};
+    std::vector<DiscountFactor> discounts = {1.0, 0.988, 0.965, 0.885, 0.745, 0.43};
+    std::vector<Handle<Quote> > jumps = {
+        Handle<Quote>(ext::make_shared<SimpleQuote>(0.9995)),
+        Handle<Quote>(ext::make_shared<SimpleQuote>(0.9990))
+    };
+    std::vector<Date> jumpDates = {today + 6*Months, today + 3*Years};
+    DayCounter dc = Actual365Fixed();
+
+    // sorted times, including nodes and extrapolation, and an unsorted copy
+    std::vector<Time> times;
+    for (Time t = 0.0; t < 40.0; t += 0.137)
+        times.push_back(t);
+    for (const Date& d : dates)
+        times.push_back(dc.yearFraction(today, d));
+    std::sort(times.begin(), times.end());
+    std::vector<Time> unsorted(times.rbegin(), times.rend());
+    std::swap(unsorted[3], unsorted[unsorted.size()/2]);
+
+    std::vector<std::pair<std::string, ext::shared_ptr<YieldTermStructure> > > curves = {
+        {"piecewise discount curve", vars.termStructure},
+        {"discount curve", ext::make_shared<DiscountCurve>(dates, discounts, dc)},
+        {"discount curve with jumps",
+         ext::make_shared<DiscountCurve>(dates, discounts, dc, NullCalendar(),
+                                         jumps, jumpDates)},
+        {"zero curve", ext::make_shared<ZeroCurve>(dates, rates, dc)},
+        {"cubic zero curve",
+         ext::make_shared<InterpolatedZeroCurve<Cubic> >(dates, rates, dc)},
+        {"forward curve", ext::make_shared<ForwardCurve>(dates, rates, dc)},
+        {"forward-flat forward curve",
+         ext::make_shared<InterpolatedForwardCurve<ForwardFlat> >(dates, rates, dc)},
+        {"linear forward curve",
+         ext::make_shared<InterpolatedForwardCurve<Linear> >(dates, rates, dc)},
+        {"flat forward", ext::make_shared<FlatForward>(today, 0.02, dc)}
+    };
+
+    for (const auto& curve : curves) {
+        checkBulkQueries(curve.first, *curve.second, times);
+        checkBulkQueries(curve.first + " (unsorted)", *curve.second, unsorted);
+    }
+
+    std::vector<DiscountFactor> result;
+    BOOST_CHECK_THROW(curves[1].second->discount(times, result), Error);
+}
+
 test_suite* TermStructureTest::suite() {
     auto* suite = BOOST_TEST_SUITE("Term structure tests");
     suite->add(QUANTLIB_TEST_CASE(&TermStructureTest::testReferenceChange));
@@ -435,6 +545,7 @@ test_suite* TermStructureTest::suite() {
                              &TermStructureTest::testLinkToNullUnderlying));
     suite->add(QUANTLIB_TEST_CASE(
                     &TermStructureTest::testCompositeZeroYieldStructures));
+    suite->add(QUANTLIB_TEST_CASE(&TermStructureTest::testBulkQueries));
     return suite;
 }
 
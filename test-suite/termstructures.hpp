@@ -37,6 +37,7 @@ class TermStructureTest {
     static void testCreateWithNullUnderlying();
     static void testLinkToNullUnderlying();
     static void testCompositeZeroYieldStructures();
+    static void testBulkQueries();
     static boost::unit_test_framework::test_suite* suite();
 };
 